@@ -500,6 +500,9 @@ public:
 		ParseFormatString(format);
 		
 		_debugger->ProcessConfigChange();
+
+		//The trace logger's hooks are only called while it is enabled
+		_debugger->RefreshHookFlags();
 	}
 
 	int64_t GetRowId(uint32_t offset) override
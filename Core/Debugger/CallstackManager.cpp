@@ -4,11 +4,13 @@
 #include "Debugger/IDebugger.h"
 #include "Debugger/DebugBreakHelper.h"
 #include "Debugger/Profiler.h"
+#include "Debugger/SamplingProfiler.h"
 
 CallstackManager::CallstackManager(Debugger* debugger, IDebugger* cpuDebugger)
 {
 	_debugger = debugger;
 	_profiler.reset(new Profiler(debugger, cpuDebugger));
+	_samplingProfiler.reset(new SamplingProfiler(debugger, cpuDebugger, this));
 }
 
 CallstackManager::~CallstackManager()
@@ -89,6 +91,19 @@ void CallstackManager::GetCallstack(StackFrameInfo* callstackArray, uint32_t &ca
 	callstackSize = i;
 }
 
+uint32_t CallstackManager::GetFunctionStack(AddressInfo* frames, uint32_t* relFrames, uint32_t maxDepth)
+{
+	//Returns the function addresses of the top-most "maxDepth" frames, outermost first
+	uint32_t depth = std::min<uint32_t>((uint32_t)_callstack.size(), maxDepth);
+	size_t start = _callstack.size() - depth;
+	for(uint32_t i = 0; i < depth; i++) {
+		StackFrameInfo& frame = _callstack[start + i];
+		frames[i] = frame.AbsTarget;
+		relFrames[i] = frame.Target;
+	}
+	return depth;
+}
+
 int32_t CallstackManager::GetReturnAddress()
 {
 	DebugBreakHelper helper(_debugger);
@@ -112,6 +127,11 @@ Profiler* CallstackManager::GetProfiler()
 	return _profiler.get();
 }
 
+SamplingProfiler* CallstackManager::GetSamplingProfiler()
+{
+	return _samplingProfiler.get();
+}
+
 void CallstackManager::Clear()
 {
 	_callstack.clear();
@@ -4,6 +4,7 @@
 
 class Debugger;
 class Profiler;
+class SamplingProfiler;
 class IDebugger;
 
 class CallstackManager
@@ -12,6 +13,7 @@ private:
 	Debugger* _debugger;
 	deque<StackFrameInfo> _callstack;
 	unique_ptr<Profiler> _profiler;
+	unique_ptr<SamplingProfiler> _samplingProfiler;
 
 public:
 	CallstackManager(Debugger* debugger, IDebugger* cpuDebugger);
@@ -36,9 +38,11 @@ public:
 	}
 
 	void GetCallstack(StackFrameInfo* callstackArray, uint32_t &callstackSize);
+	uint32_t GetFunctionStack(AddressInfo* frames, uint32_t* relFrames, uint32_t maxDepth);
 	int32_t GetReturnAddress();
 	int64_t GetReturnStackPointer();
 	Profiler* GetProfiler();
+	SamplingProfiler* GetSamplingProfiler();
 
 	void Clear();
 };
\ No newline at end of file
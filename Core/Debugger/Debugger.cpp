@@ -14,6 +14,7 @@
 #include "Debugger/ScriptManager.h"
 #include "Debugger/ScriptHost.h"
 #include "Debugger/CallstackManager.h"
+#include "Debugger/SamplingProfiler.h"
 #include "Debugger/ExpressionEvaluator.h"
 #include "Debugger/BaseEventManager.h"
 #include "Debugger/TraceLogFileSaver.h"
@@ -60,6 +61,17 @@
 
 uint64_t ITraceLogger::NextRowId = 0;
 
+//Calls the callback with the features enabled for the cpu-specific debugger as a compile-time constant
+template<typename T>
+static __forceinline void DispatchCpuHooks(uint8_t hookFlags, T&& callback)
+{
+	#define DISPATCH_CASE(hooks) case hooks: callback(std::integral_constant<uint8_t, hooks>()); break;
+	switch(hookFlags & DebugHookFlags::AllCpu) {
+		DEBUG_CPU_HOOK_COMBINATIONS(DISPATCH_CASE)
+	}
+	#undef DISPATCH_CASE
+}
+
 Debugger::Debugger(Emulator* emu, IConsole* console)
 {
 	_executionStopped = true;
@@ -109,7 +121,11 @@ Debugger::Debugger(Emulator* emu, IConsole* console)
 	for(CpuType type : _cpuTypes) {
 		_debuggers[(int)type].Debugger->Init();
 		_debuggers[(int)type].Debugger->ProcessConfigChange();
+
+		CallstackManager* callstackManager = _debuggers[(int)type].Debugger->GetCallstackManager();
+		_debuggers[(int)type].Sampler = callstackManager ? callstackManager->GetSamplingProfiler() : nullptr;
 	}
+	RefreshHookFlags();
 
 	_breakRequestCount = 0;
 	_suspendRequestCount = 0;
@@ -210,6 +226,25 @@ bool Debugger::ProcessStepBack(IDebugger* debugger)
 
 template<CpuType type>
 void Debugger::ProcessInstruction()
+{
+	//Each combination needs its own case - e.g the sampler is null for CPUs that have no callstack manager (GSU, etc.)
+	constexpr uint8_t scripts = DebugHookFlags::Scripts;
+	constexpr uint8_t sampler = DebugHookFlags::SamplingProfiler;
+	constexpr uint8_t stepBack = DebugHookFlags::StepBackCheckpoints;
+	switch(_debuggers[(int)type].HookFlags & DebugHookFlags::All) {
+		case DebugHookFlags::None: InternalProcessInstruction<type, DebugHookFlags::None>(); break;
+		case scripts: InternalProcessInstruction<type, scripts>(); break;
+		case sampler: InternalProcessInstruction<type, sampler>(); break;
+		case scripts | sampler: InternalProcessInstruction<type, scripts | sampler>(); break;
+		case stepBack: InternalProcessInstruction<type, stepBack>(); break;
+		case stepBack | scripts: InternalProcessInstruction<type, stepBack | scripts>(); break;
+		case stepBack | sampler: InternalProcessInstruction<type, stepBack | sampler>(); break;
+		case stepBack | scripts | sampler: InternalProcessInstruction<type, stepBack | scripts | sampler>(); break;
+	}
+}
+
+template<CpuType type, uint8_t hooks>
+void Debugger::InternalProcessInstruction()
 {
 	IDebugger* debugger = _debuggers[(int)type].Debugger.get();
 	if(debugger->IsStepBack() && ProcessStepBack(debugger)) {
@@ -219,28 +254,44 @@ void Debugger::ProcessInstruction()
 		return;
 	}
 
+	if constexpr(hooks & DebugHookFlags::StepBackCheckpoints) {
+		debugger->ProcessStepBackCheckpoint();
+	}
+
 	debugger->IgnoreBreakpoints = false;
 	debugger->AllowChangeProgramCounter = true;
 
-	switch(type) {
-		case CpuType::Snes: GetDebugger<type, SnesDebugger>()->ProcessInstruction(); break;
-		case CpuType::Spc: GetDebugger<type, SpcDebugger>()->ProcessInstruction(); break;
-		case CpuType::NecDsp: GetDebugger<type, NecDspDebugger>()->ProcessInstruction(); break;
-		case CpuType::Sa1: GetDebugger<type, SnesDebugger>()->ProcessInstruction(); break;
-		case CpuType::Gsu: GetDebugger<type, GsuDebugger>()->ProcessInstruction(); break;
-		case CpuType::Cx4: GetDebugger<type, Cx4Debugger>()->ProcessInstruction(); break;
-		case CpuType::St018: GetDebugger<type, St018Debugger>()->ProcessInstruction(); break;
-		case CpuType::Gameboy: GetDebugger<type, GbDebugger>()->ProcessInstruction(); break;
-		case CpuType::Nes: GetDebugger<type, NesDebugger>()->ProcessInstruction(); break;
-		case CpuType::Pce: GetDebugger<type, PceDebugger>()->ProcessInstruction(); break;
-		case CpuType::Sms: GetDebugger<type, SmsDebugger>()->ProcessInstruction(); break;
-		case CpuType::Gba: GetDebugger<type, GbaDebugger>()->ProcessInstruction(); break;
-		case CpuType::Ws: GetDebugger<type, WsDebugger>()->ProcessInstruction(); break;
-	}
+	DispatchCpuHooks(_debuggers[(int)type].HookFlags, [this](auto cpuHookFlags) {
+		constexpr uint8_t cpuHooks = decltype(cpuHookFlags)::value;
+		switch(type) {
+			case CpuType::Snes: GetDebugger<type, SnesDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Spc: GetDebugger<type, SpcDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::NecDsp: GetDebugger<type, NecDspDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Sa1: GetDebugger<type, SnesDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Gsu: GetDebugger<type, GsuDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Cx4: GetDebugger<type, Cx4Debugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::St018: GetDebugger<type, St018Debugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Gameboy: GetDebugger<type, GbDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Nes: GetDebugger<type, NesDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Pce: GetDebugger<type, PceDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Sms: GetDebugger<type, SmsDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Gba: GetDebugger<type, GbaDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+			case CpuType::Ws: GetDebugger<type, WsDebugger>()->template ProcessInstruction<cpuHooks>(); break;
+		}
+
+		if constexpr(!(cpuHooks & DebugHookFlags::BreakChecks)) {
+			//The cpu debugger skipped its break checks, but break requests (e.g DebugBreakHelper) must still be processed
+			SleepOnBreakRequest<type>();
+		}
+	});
 
 	debugger->AllowChangeProgramCounter = false;
+
+	if constexpr(hooks & DebugHookFlags::SamplingProfiler) {
+		_debuggers[(int)type].Sampler->ProcessInstruction(_emu->GetMasterClock());
+	}
 	
-	if(_scriptManager->HasCpuMemoryCallbacks()) {
+	if constexpr(hooks & DebugHookFlags::Scripts) {
 		MemoryOperationInfo memOp = debugger->InstructionProgress.LastMemOperation;
 		AddressInfo relAddr = { (int32_t)memOp.Address, memOp.MemType };
 		uint8_t value = (uint8_t)memOp.Value;
@@ -250,66 +301,92 @@ void Debugger::ProcessInstruction()
 
 template<CpuType type, uint8_t accessWidth, MemoryAccessFlags flags, typename T>
 void Debugger::ProcessMemoryRead(uint32_t addr, T& value, MemoryOperationType opType)
+{
+	if(_debuggers[(int)type].HookFlags & DebugHookFlags::Scripts) {
+		InternalProcessMemoryRead<type, accessWidth, flags, DebugHookFlags::Scripts>(addr, value, opType);
+	} else {
+		InternalProcessMemoryRead<type, accessWidth, flags, DebugHookFlags::None>(addr, value, opType);
+	}
+}
+
+template<CpuType type, uint8_t accessWidth, MemoryAccessFlags flags, uint8_t hooks, typename T>
+void Debugger::InternalProcessMemoryRead(uint32_t addr, T& value, MemoryOperationType opType)
 {
 	if(_debuggers[(int)type].Debugger->IsStepBack()) {
 		SleepOnBreakRequest<type>();
 		return;
 	}
 
-	switch(type) {
-		case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->ProcessRead<flags>(addr, value, opType); break;
-		case CpuType::NecDsp: GetDebugger<CpuType::NecDsp, NecDspDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Sa1: GetDebugger<CpuType::Sa1, SnesDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Gsu: GetDebugger<CpuType::Gsu, GsuDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Cx4: GetDebugger<CpuType::Cx4, Cx4Debugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::St018: GetDebugger<CpuType::St018, St018Debugger>()->ProcessRead<accessWidth>(addr, value, opType); break;
-		case CpuType::Gameboy: GetDebugger<CpuType::Gameboy, GbDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Nes: GetDebugger<CpuType::Nes, NesDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Pce: GetDebugger<CpuType::Pce, PceDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Sms: GetDebugger<CpuType::Sms, SmsDebugger>()->ProcessRead(addr, value, opType); break;
-		case CpuType::Gba: GetDebugger<CpuType::Gba, GbaDebugger>()->ProcessRead<accessWidth>(addr, value, opType); break;
-		case CpuType::Ws:
-			if constexpr(accessWidth <= 2) {
-				GetDebugger<CpuType::Ws, WsDebugger>()->ProcessRead<accessWidth>(addr, value, opType);
-			}
-			break;
-	}
+	DispatchCpuHooks(_debuggers[(int)type].HookFlags, [&](auto cpuHookFlags) {
+		constexpr uint8_t cpuHooks = decltype(cpuHookFlags)::value;
+		switch(type) {
+			case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->template ProcessRead<flags, cpuHooks>(addr, value, opType); break;
+			case CpuType::NecDsp: GetDebugger<CpuType::NecDsp, NecDspDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Sa1: GetDebugger<CpuType::Sa1, SnesDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Gsu: GetDebugger<CpuType::Gsu, GsuDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Cx4: GetDebugger<CpuType::Cx4, Cx4Debugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::St018: GetDebugger<CpuType::St018, St018Debugger>()->template ProcessRead<accessWidth, cpuHooks>(addr, value, opType); break;
+			case CpuType::Gameboy: GetDebugger<CpuType::Gameboy, GbDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Nes: GetDebugger<CpuType::Nes, NesDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Pce: GetDebugger<CpuType::Pce, PceDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Sms: GetDebugger<CpuType::Sms, SmsDebugger>()->template ProcessRead<cpuHooks>(addr, value, opType); break;
+			case CpuType::Gba: GetDebugger<CpuType::Gba, GbaDebugger>()->template ProcessRead<accessWidth, cpuHooks>(addr, value, opType); break;
+			case CpuType::Ws:
+				if constexpr(accessWidth <= 2) {
+					GetDebugger<CpuType::Ws, WsDebugger>()->template ProcessRead<accessWidth, cpuHooks>(addr, value, opType);
+				}
+				break;
+		}
+	});
 
-	if(_scriptManager->HasCpuMemoryCallbacks()) {
+	if constexpr(hooks & DebugHookFlags::Scripts) {
 		ProcessScripts<type>(addr, value, opType);
 	}
 }
 
 template<CpuType type, uint8_t accessWidth, MemoryAccessFlags flags, typename T>
 bool Debugger::ProcessMemoryWrite(uint32_t addr, T& value, MemoryOperationType opType)
+{
+	if(_debuggers[(int)type].HookFlags & DebugHookFlags::Scripts) {
+		return InternalProcessMemoryWrite<type, accessWidth, flags, DebugHookFlags::Scripts>(addr, value, opType);
+	} else {
+		return InternalProcessMemoryWrite<type, accessWidth, flags, DebugHookFlags::None>(addr, value, opType);
+	}
+}
+
+template<CpuType type, uint8_t accessWidth, MemoryAccessFlags flags, uint8_t hooks, typename T>
+bool Debugger::InternalProcessMemoryWrite(uint32_t addr, T& value, MemoryOperationType opType)
 {
 	if(_debuggers[(int)type].Debugger->IsStepBack()) {
 		SleepOnBreakRequest<type>();
 		return !_debuggers[(int)type].Debugger->GetFrozenAddressManager().IsFrozenAddress(addr);
 	}
 
-	switch(type) {
-		case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->ProcessWrite<flags>(addr, value, opType); break;
-		case CpuType::NecDsp: GetDebugger<CpuType::NecDsp, NecDspDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Sa1: GetDebugger<CpuType::Sa1, SnesDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Gsu: GetDebugger<CpuType::Gsu, GsuDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Cx4: GetDebugger<CpuType::Cx4, Cx4Debugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::St018: GetDebugger<CpuType::St018, St018Debugger>()->ProcessWrite<accessWidth>(addr, value, opType); break;
-		case CpuType::Gameboy: GetDebugger<CpuType::Gameboy, GbDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Nes: GetDebugger<CpuType::Nes, NesDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Pce: GetDebugger<CpuType::Pce, PceDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Sms: GetDebugger<CpuType::Sms, SmsDebugger>()->ProcessWrite(addr, value, opType); break;
-		case CpuType::Gba: GetDebugger<CpuType::Gba, GbaDebugger>()->ProcessWrite<accessWidth>(addr, value, opType); break;
-		case CpuType::Ws:
-			if constexpr(accessWidth <= 2) {
-				GetDebugger<CpuType::Ws, WsDebugger>()->ProcessWrite<accessWidth>(addr, value, opType);
-			}
-			break;
-	}
+	DispatchCpuHooks(_debuggers[(int)type].HookFlags, [&](auto cpuHookFlags) {
+		constexpr uint8_t cpuHooks = decltype(cpuHookFlags)::value;
+		switch(type) {
+			case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->template ProcessWrite<flags, cpuHooks>(addr, value, opType); break;
+			case CpuType::NecDsp: GetDebugger<CpuType::NecDsp, NecDspDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Sa1: GetDebugger<CpuType::Sa1, SnesDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Gsu: GetDebugger<CpuType::Gsu, GsuDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Cx4: GetDebugger<CpuType::Cx4, Cx4Debugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::St018: GetDebugger<CpuType::St018, St018Debugger>()->template ProcessWrite<accessWidth, cpuHooks>(addr, value, opType); break;
+			case CpuType::Gameboy: GetDebugger<CpuType::Gameboy, GbDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Nes: GetDebugger<CpuType::Nes, NesDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Pce: GetDebugger<CpuType::Pce, PceDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Sms: GetDebugger<CpuType::Sms, SmsDebugger>()->template ProcessWrite<cpuHooks>(addr, value, opType); break;
+			case CpuType::Gba: GetDebugger<CpuType::Gba, GbaDebugger>()->template ProcessWrite<accessWidth, cpuHooks>(addr, value, opType); break;
+			case CpuType::Ws:
+				if constexpr(accessWidth <= 2) {
+					GetDebugger<CpuType::Ws, WsDebugger>()->template ProcessWrite<accessWidth, cpuHooks>(addr, value, opType);
+				}
+				break;
+		}
+	});
 	
-	if(_scriptManager->HasCpuMemoryCallbacks()) {
+	if constexpr(hooks & DebugHookFlags::Scripts) {
 		ProcessScripts<type>(addr, value, opType);
 	}
 	
@@ -342,11 +419,13 @@ void Debugger::ProcessMemoryAccess(uint32_t addr, T& value)
 		case CpuType::Ws: GetDebugger<CpuType::Ws, WsDebugger>()->ProcessMemoryAccess<opType, T>(addr, value, memType); break;
 	}
 
-	if(_scriptManager->HasCpuMemoryCallbacks()) {
+	if(_debuggers[(int)cpuType].HookFlags & DebugHookFlags::Scripts) {
 		ProcessScripts<cpuType>(addr, value, memType, opType);
 	}
 
-	ProcessBreakConditions<accessWidth>(cpuType, *debugger->GetStepRequest(), debugger->GetBreakpointManager(), operation, addressInfo);
+	if(_debuggers[(int)cpuType].HookFlags & DebugHookFlags::BreakChecks) {
+		ProcessBreakConditions<accessWidth>(cpuType, *debugger->GetStepRequest(), debugger->GetBreakpointManager(), operation, addressInfo);
+	}
 }
 
 template<CpuType type>
@@ -604,6 +683,12 @@ void Debugger::ProcessEvent(EventType type, std::optional<CpuType> cpuTypeOpt)
 			break;
 		}
 
+		case EventType::EndFrame:
+			if(evtCpuType == _mainCpuType) {
+				_memoryAccessCounter->ProcessEndFrame();
+			}
+			break;
+
 		case EventType::Reset:
 			Reset();
 			break;
@@ -619,6 +704,7 @@ void Debugger::ProcessEvent(EventType type, std::optional<CpuType> cpuTypeOpt)
 				CallstackManager* callstackManager = _debuggers[(int)cpuType].Debugger->GetCallstackManager();
 				if(callstackManager) {
 					callstackManager->Clear();
+					callstackManager->GetSamplingProfiler()->ResetSampleClock();
 				}
 			}
 			break;
@@ -647,6 +733,50 @@ void Debugger::ProcessConfigChange()
 			_debuggers[i].Debugger->ProcessConfigChange();
 		}
 	}
+	RefreshHookFlags();
+}
+
+void Debugger::RefreshHookFlags()
+{
+	//Selects which instantiation of the instruction/memory hooks is used for each cpu
+	//Called from the UI thread (config changes, trace logger options, etc.), the emulation must be paused while the flags change
+	DebugBreakHelper helper(this);
+
+	uint8_t scriptFlags = _scriptManager && _scriptManager->HasCpuMemoryCallbacks() ? DebugHookFlags::Scripts : DebugHookFlags::None;
+	bool cdlEnabled = !_settings->GetDebugConfig().DisableCdlLogging;
+	for(int i = 0; i <= (int)DebugUtilities::GetLastCpuType(); i++) {
+		uint8_t flags = scriptFlags;
+		if(_debuggers[i].Sampler && _debuggers[i].Sampler->IsEnabled()) {
+			flags |= DebugHookFlags::SamplingProfiler;
+		}
+
+		IDebugger* dbg = _debuggers[i].Debugger.get();
+		if(dbg) {
+			if(dbg->IsStepBackCheckpointsEnabled()) {
+				flags |= DebugHookFlags::StepBackCheckpoints;
+			}
+			if(cdlEnabled) {
+				flags |= DebugHookFlags::CodeDataLogger;
+			}
+
+			//Break options are only processed when the cpu's debugger window is opened
+			StepRequest* step = dbg->GetStepRequest();
+			if(IsDebugWindowOpened((CpuType)i) || step->HasRequest || step->Type != StepType::Step || dbg->GetBreakpointManager()->HasBreakpoints()) {
+				flags |= DebugHookFlags::BreakChecks;
+			}
+
+			ITraceLogger* traceLogger = dbg->GetTraceLogger();
+			if(traceLogger && traceLogger->IsEnabled()) {
+				flags |= DebugHookFlags::TraceLogger;
+			}
+
+			//Events are always recorded, so the event viewer can display the last frame's events when it is opened
+			if(dbg->GetEventManager()) {
+				flags |= DebugHookFlags::EventManager;
+			}
+		}
+		_debuggers[i].HookFlags = flags;
+	}
 }
 
 void Debugger::GetTokenList(CpuType cpuType, char* tokenList)
@@ -675,9 +805,11 @@ void Debugger::Run()
 	for(int i = 0; i <= (int)DebugUtilities::GetLastCpuType(); i++) {
 		if(_debuggers[i].Debugger) {
 			_debuggers[i].Debugger->ResetStepBackCache();
+			_debuggers[i].Debugger->SetStepBackCheckpointsEnabled(false);
 			_debuggers[i].Debugger->Run();
 		}
 	}
+	RefreshHookFlags();
 	_waitForBreakResume = false;
 }
 
@@ -716,6 +848,9 @@ void Debugger::Step(CpuType cpuType, int32_t stepCount, StepType type, BreakSour
 			debugger->StepBack(stepCount);
 		}
 
+		//Keep checkpoints while stepping, to speed up step back operations
+		debugger->SetStepBackCheckpointsEnabled(true);
+
 		debugger->Step(stepCount, type);
 		debugger->GetStepRequest()->SetBreakSource(source, false);
 	}
@@ -723,10 +858,12 @@ void Debugger::Step(CpuType cpuType, int32_t stepCount, StepType type, BreakSour
 	for(int i = 0; i <= (int)DebugUtilities::GetLastCpuType(); i++) {
 		if(_debuggers[i].Debugger && _debuggers[i].Debugger.get() != debugger) {
 			_debuggers[i].Debugger->ResetStepBackCache();
+			_debuggers[i].Debugger->SetStepBackCheckpointsEnabled(false);
 			_debuggers[i].Debugger->Run();
 		}
 	}
 
+	RefreshHookFlags();
 	_waitForBreakResume = false;
 }
 
@@ -1029,6 +1166,7 @@ void Debugger::SetBreakpoints(Breakpoint breakpoints[], uint32_t length)
 			_debuggers[i].Debugger->GetBreakpointManager()->SetBreakpoints(breakpoints, length);
 		}
 	}
+	RefreshHookFlags();
 }
 
 void Debugger::SetInputOverrides(uint32_t index, DebugControllerState state)
@@ -36,6 +36,7 @@ class IDebugger;
 class ITraceLogger;
 class TraceLogFileSaver;
 class FrozenAddressManager;
+class SamplingProfiler;
 
 struct TraceRow;
 struct BaseState;
@@ -44,10 +45,45 @@ enum class EventType;
 enum class MemoryOperationType;
 enum class EvalResultType : int32_t;
 
+namespace DebugHookFlags
+{
+	//Optional features processed by the generic hooks - each combination has its own instantiation of the hooks
+	enum DebugHookFlags : uint8_t
+	{
+		None = 0,
+		Scripts = 0x01,
+		SamplingProfiler = 0x02,
+		StepBackCheckpoints = 0x04,
+		All = Scripts | SamplingProfiler | StepBackCheckpoints,
+
+		//Optional features processed by the cpu-specific debuggers' ProcessInstruction/ProcessRead/ProcessWrite
+		CodeDataLogger = 0x08,
+		BreakChecks = 0x10, //Step requests, breakpoints and break options
+		TraceLogger = 0x20,
+		EventManager = 0x40,
+		AllCpu = CodeDataLogger | BreakChecks | TraceLogger | EventManager
+	};
+}
+
+//Calls the macro with each combination of the flags processed by the cpu-specific debuggers (AllCpu)
+#define DEBUG_CPU_HOOK_COMBINATIONS(macro) \
+	DEBUG_CPU_HOOK_COMBINATIONS_CDL_BRK(macro, DebugHookFlags::None) \
+	DEBUG_CPU_HOOK_COMBINATIONS_CDL_BRK(macro, DebugHookFlags::TraceLogger) \
+	DEBUG_CPU_HOOK_COMBINATIONS_CDL_BRK(macro, DebugHookFlags::EventManager) \
+	DEBUG_CPU_HOOK_COMBINATIONS_CDL_BRK(macro, DebugHookFlags::TraceLogger | DebugHookFlags::EventManager)
+
+#define DEBUG_CPU_HOOK_COMBINATIONS_CDL_BRK(macro, flags) \
+	macro((flags)) \
+	macro((flags) | DebugHookFlags::CodeDataLogger) \
+	macro((flags) | DebugHookFlags::BreakChecks) \
+	macro((flags) | DebugHookFlags::CodeDataLogger | DebugHookFlags::BreakChecks)
+
 struct CpuInfo
 {
 	unique_ptr<IDebugger> Debugger;
 	unique_ptr<ExpressionEvaluator> Evaluator;
+	SamplingProfiler* Sampler = nullptr;
+	uint8_t HookFlags = DebugHookFlags::None;
 };
 
 class Debugger
@@ -94,6 +130,10 @@ private:
 	template<CpuType type> uint64_t GetCpuCycleCount();
 	template<CpuType type, typename T> void ProcessScripts(uint32_t addr, T& value, MemoryOperationType opType);
 	template<CpuType type, typename T> void ProcessScripts(uint32_t addr, T& value, MemoryType memType, MemoryOperationType opType);
+
+	template<CpuType type, uint8_t hooks> void InternalProcessInstruction();
+	template<CpuType type, uint8_t accessWidth, MemoryAccessFlags flags, uint8_t hooks, typename T> void InternalProcessMemoryRead(uint32_t addr, T& value, MemoryOperationType opType);
+	template<CpuType type, uint8_t accessWidth, MemoryAccessFlags flags, uint8_t hooks, typename T> bool InternalProcessMemoryWrite(uint32_t addr, T& value, MemoryOperationType opType);
 	
 	bool IsDebugWindowOpened(CpuType cpuType);
 	bool IsBreakOptionEnabled(BreakSource src);
@@ -126,6 +166,7 @@ public:
 	void ProcessEvent(EventType type, std::optional<CpuType> cpuType);
 
 	void ProcessConfigChange();
+	void RefreshHookFlags();
 
 	void GetTokenList(CpuType cpuType, char* tokenList);
 	int64_t EvaluateExpression(string expression, CpuType cpuType, EvalResultType &resultType, bool useCache);
@@ -39,6 +39,9 @@ public:
 	bool CheckStepBack() { return _stepBackManager->CheckStepBack(); }
 	bool IsStepBack() { return _stepBackManager->IsRewinding(); }
 	void ResetStepBackCache() { return _stepBackManager->ResetCache(); }
+	void SetStepBackCheckpointsEnabled(bool enabled) { _stepBackManager->SetCheckpointsEnabled(enabled); }
+	bool IsStepBackCheckpointsEnabled() { return _stepBackManager->IsCheckpointsEnabled(); }
+	void ProcessStepBackCheckpoint() { _stepBackManager->ProcessInstruction(); }
 	void StepBack(int32_t stepCount) { return _stepBackManager->StepBack((StepBackType)stepCount); }
 	virtual StepBackConfig GetStepBackConfig() { return { GetCpuCycleCount(), 0, 0 }; }
 
@@ -4,6 +4,111 @@
 #include "Debugger/DebugUtilities.h"
 #include "Debugger/DebugBreakHelper.h"
 
+void LabelHashIndex::Reserve(uint32_t count)
+{
+	uint32_t slotCount = 16;
+	while(slotCount < count * 2) {
+		slotCount <<= 1;
+	}
+
+	if(slotCount > _slots.size()) {
+		Rehash(slotCount);
+	}
+}
+
+void LabelHashIndex::Rehash(uint32_t slotCount)
+{
+	vector<Slot> slots = std::move(_slots);
+	_slots.assign(slotCount, { 0, LabelHashIndex::EmptySlot });
+	_mask = slotCount - 1;
+	_count = 0;
+
+	for(Slot& slot : slots) {
+		if(slot.Index != LabelHashIndex::EmptySlot) {
+			Insert(slot.Key, slot.Index);
+		}
+	}
+}
+
+void LabelHashIndex::Clear()
+{
+	_slots.clear();
+	_mask = 0;
+	_count = 0;
+}
+
+uint32_t LabelHashIndex::Find(uint64_t key)
+{
+	if(_slots.empty()) {
+		return LabelHashIndex::NotFound;
+	}
+
+	for(uint32_t i = GetSlot(key);; i = (i + 1) & _mask) {
+		Slot& slot = _slots[i];
+		if(slot.Index == LabelHashIndex::EmptySlot) {
+			return LabelHashIndex::NotFound;
+		} else if(slot.Key == key) {
+			return slot.Index;
+		}
+	}
+}
+
+void LabelHashIndex::Insert(uint64_t key, uint32_t index)
+{
+	if((_count + 1) * 2 > _slots.size()) {
+		//Keep the load factor under 50%
+		Rehash(std::max<uint32_t>(16, (uint32_t)_slots.size() * 2));
+	}
+
+	for(uint32_t i = GetSlot(key);; i = (i + 1) & _mask) {
+		Slot& slot = _slots[i];
+		if(slot.Index == LabelHashIndex::EmptySlot) {
+			slot.Key = key;
+			slot.Index = index;
+			_count++;
+			return;
+		} else if(slot.Key == key) {
+			slot.Index = index;
+			return;
+		}
+	}
+}
+
+void LabelHashIndex::Erase(uint64_t key)
+{
+	if(_slots.empty()) {
+		return;
+	}
+
+	uint32_t i = GetSlot(key);
+	while(_slots[i].Key != key || _slots[i].Index == LabelHashIndex::EmptySlot) {
+		if(_slots[i].Index == LabelHashIndex::EmptySlot) {
+			return;
+		}
+		i = (i + 1) & _mask;
+	}
+
+	//Backward shift deletion - move the following entries of the cluster back into the free slot when their
+	//home slot allows it, to avoid the need for tombstones
+	uint32_t j = i;
+	while(true) {
+		j = (j + 1) & _mask;
+		if(_slots[j].Index == LabelHashIndex::EmptySlot) {
+			break;
+		}
+
+		uint32_t home = GetSlot(_slots[j].Key);
+		bool canStay = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+		if(!canStay) {
+			_slots[i] = _slots[j];
+			i = j;
+		}
+	}
+
+	_slots[i].Index = LabelHashIndex::EmptySlot;
+	_count--;
+}
+
 LabelManager::LabelManager(Debugger *debugger)
 {
 	_debugger = debugger;
@@ -12,36 +117,109 @@ LabelManager::LabelManager(Debugger *debugger)
 void LabelManager::ClearLabels()
 {
 	DebugBreakHelper helper(_debugger);
-	_codeLabels.clear();
+	_labels.clear();
+	_labelIndex.Clear();
 	_codeLabelReverseLookup.clear();
+	_rangeKeys.clear();
+	_maxRangeLength = 0;
 }
 
 void LabelManager::SetLabel(uint32_t address, MemoryType memType, string label, string comment)
 {
 	DebugBreakHelper helper(_debugger);
+	InternalSetLabel(address, memType, 1, label, comment, true);
+}
+
+void LabelManager::SetLabels(CodeLabelInfo labels[], uint32_t count)
+{
+	DebugBreakHelper helper(_debugger);
+
+	size_t totalCount = _labels.size() + count;
+	_labels.reserve(totalCount);
+	_labelIndex.Reserve((uint32_t)totalCount);
+	_codeLabelReverseLookup.reserve(totalCount);
+
+	for(uint32_t i = 0; i < count; i++) {
+		CodeLabelInfo& info = labels[i];
+		InternalSetLabel(info.Address, info.MemType, info.Length, info.Label ? info.Label : "", info.Comment ? info.Comment : "", false);
+	}
+
+	//Sort the multi-byte labels once, rather than once per label
+	RebuildRangeKeys();
+}
+
+void LabelManager::InternalSetLabel(uint32_t address, MemoryType memType, uint32_t length, string label, string comment, bool updateRangeKeys)
+{
 	uint64_t key = GetLabelKey(address, memType);
 
-	auto existingLabel = _codeLabels.find(key);
-	if(existingLabel != _codeLabels.end()) {
-		_codeLabelReverseLookup.erase(existingLabel->second.Label);
+	uint32_t existingIndex = _labelIndex.Find(key);
+	if(existingIndex != LabelHashIndex::NotFound) {
+		RemoveLabel(existingIndex, updateRangeKeys);
 	}
 
-	_codeLabels.erase(key);
 	if(!label.empty() || !comment.empty()) {
 		if(label.size() > 400) {
 			//Restrict labels to 400 bytes
 			label = label.substr(0, 400);
 		}
 
-		LabelInfo labelInfo;
-		labelInfo.Label = label;
-		labelInfo.Comment = comment;
+		LabelEntry entry;
+		entry.Key = key;
+		entry.Length = std::max<uint32_t>(length, 1);
+		entry.Info.Label = label;
+		entry.Info.Comment = comment;
 
-		_codeLabels.emplace(key, labelInfo);
-		_codeLabelReverseLookup.emplace(label, key);
+		_labelIndex.Insert(key, (uint32_t)_labels.size());
+		_codeLabelReverseLookup.emplace(GetReverseLookupName(entry), key);
+		if(entry.Length > 1 && updateRangeKeys) {
+			_rangeKeys.insert(std::upper_bound(_rangeKeys.begin(), _rangeKeys.end(), key), key);
+			_maxRangeLength = std::max(_maxRangeLength, entry.Length);
+		}
+		_labels.push_back(std::move(entry));
 	}
 }
 
+void LabelManager::RemoveLabel(uint32_t index, bool updateRangeKeys)
+{
+	LabelEntry& entry = _labels[index];
+	_codeLabelReverseLookup.erase(GetReverseLookupName(entry));
+	_labelIndex.Erase(entry.Key);
+
+	if(entry.Length > 1 && updateRangeKeys) {
+		auto result = std::lower_bound(_rangeKeys.begin(), _rangeKeys.end(), entry.Key);
+		if(result != _rangeKeys.end() && *result == entry.Key) {
+			_rangeKeys.erase(result);
+		}
+	}
+
+	//Move the last label into the free slot to keep the list contiguous
+	uint32_t lastIndex = (uint32_t)_labels.size() - 1;
+	if(index != lastIndex) {
+		_labels[index] = std::move(_labels[lastIndex]);
+		_labelIndex.Insert(_labels[index].Key, index);
+	}
+	_labels.pop_back();
+}
+
+void LabelManager::RebuildRangeKeys()
+{
+	_rangeKeys.clear();
+	_maxRangeLength = 0;
+	for(LabelEntry& entry : _labels) {
+		if(entry.Length > 1) {
+			_rangeKeys.push_back(entry.Key);
+			_maxRangeLength = std::max(_maxRangeLength, entry.Length);
+		}
+	}
+	std::sort(_rangeKeys.begin(), _rangeKeys.end());
+}
+
+string LabelManager::GetReverseLookupName(LabelEntry& entry)
+{
+	//Multi-byte labels are referred to as "label+0" (see GetLabelRelativeAddress)
+	return entry.Length > 1 ? entry.Info.Label + "+0" : entry.Info.Label;
+}
+
 int64_t LabelManager::GetLabelKey(uint32_t absoluteAddr, MemoryType memType)
 {
 	return absoluteAddr | ((uint64_t)memType << 32);
@@ -52,6 +230,38 @@ MemoryType LabelManager::GetKeyMemoryType(uint64_t key)
 	return (MemoryType)(key >> 32);
 }
 
+LabelManager::LabelEntry* LabelManager::FindLabel(AddressInfo address, uint32_t& offset)
+{
+	int64_t key = GetLabelKey(address.Address, address.Type);
+	if(key < 0) {
+		return nullptr;
+	}
+
+	offset = 0;
+	uint32_t index = _labelIndex.Find(key);
+	if(index != LabelHashIndex::NotFound) {
+		return &_labels[index];
+	}
+
+	//Check if the address is inside a multi-byte label
+	//Labels can overlap, so walk back over all the labels that start close enough to contain the address (the nearest one wins)
+	auto result = std::upper_bound(_rangeKeys.begin(), _rangeKeys.end(), (uint64_t)key);
+	while(result != _rangeKeys.begin()) {
+		uint64_t startKey = *(--result);
+		if((startKey >> 32) != ((uint64_t)key >> 32) || key - startKey >= _maxRangeLength) {
+			break;
+		}
+
+		index = _labelIndex.Find(startKey);
+		if(index != LabelHashIndex::NotFound && key - startKey < _labels[index].Length) {
+			offset = (uint32_t)(key - startKey);
+			return &_labels[index];
+		}
+	}
+
+	return nullptr;
+}
+
 string LabelManager::GetLabel(AddressInfo address, bool checkRegisterLabels)
 {
 	string label;
@@ -72,26 +282,22 @@ string LabelManager::GetLabel(AddressInfo address, bool checkRegisterLabels)
 
 bool LabelManager::InternalGetLabel(AddressInfo address, string &label)
 {
-	int64_t key = GetLabelKey(address.Address, address.Type);
-	if(key >= 0) {
-		auto result = _codeLabels.find(key);
-		if(result != _codeLabels.end()) {
-			label = result->second.Label;
-			return true;
-		}
+	uint32_t offset;
+	LabelEntry* entry = FindLabel(address, offset);
+	if(entry) {
+		label = entry->Length > 1 ? entry->Info.Label + "+" + std::to_string(offset) : entry->Info.Label;
+		return true;
 	}
 	return false;
 }
 
 string LabelManager::GetComment(AddressInfo absAddress)
 {
-	uint64_t key = GetLabelKey(absAddress.Address, absAddress.Type);
-
-	if(key >= 0) {
-		auto result = _codeLabels.find(key);
-		if(result != _codeLabels.end()) {
-			return result->second.Comment;
-		}
+	uint32_t offset;
+	LabelEntry* entry = FindLabel(absAddress, offset);
+	if(entry && offset == 0) {
+		//Comments are only shown on the first byte of multi-byte labels
+		return entry->Info.Comment;
 	}
 
 	return "";
@@ -104,14 +310,28 @@ bool LabelManager::GetLabelAndComment(AddressInfo address, LabelInfo &labelInfo)
 	}
 
 	if(address.Address >= 0) {
-		int64_t key = GetLabelKey(address.Address, address.Type);
+		uint32_t offset;
+		LabelEntry* entry = FindLabel(address, offset);
+		if(entry) {
+			labelInfo.Label = entry->Length > 1 ? entry->Info.Label + "+" + std::to_string(offset) : entry->Info.Label;
+			labelInfo.Comment = offset == 0 ? entry->Info.Comment : "";
+			return true;
+		}
+	}
+	return false;
+}
+
+bool LabelManager::GetLabelContaining(AddressInfo address, LabelInfo& labelInfo, uint32_t& offset)
+{
+	if(DebugUtilities::IsRelativeMemory(address.Type)) {
+		address = _debugger->GetAbsoluteAddress(address);
+	}
 
-		if(key >= 0) {
-			auto result = _codeLabels.find(key);
-			if(result != _codeLabels.end()) {
-				labelInfo = result->second;
-				return true;
-			}
+	if(address.Address >= 0) {
+		LabelEntry* entry = FindLabel(address, offset);
+		if(entry) {
+			labelInfo = entry->Info;
+			return true;
 		}
 	}
 	return false;
@@ -162,10 +382,8 @@ bool LabelManager::HasLabelOrComment(AddressInfo address)
 	}
 
 	if(address.Address >= 0) {
-		uint64_t key = GetLabelKey(address.Address, address.Type);
-		if(key >= 0) {
-			return _codeLabels.find(key) != _codeLabels.end();
-		}
+		uint32_t offset;
+		return FindLabel(address, offset) != nullptr;
 	}
 	return false;
 }
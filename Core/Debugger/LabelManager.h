@@ -22,22 +22,87 @@ struct LabelInfo
 	string Comment;
 };
 
+struct CodeLabelInfo
+{
+	uint32_t Address;
+	MemoryType MemType;
+	uint32_t Length;
+	const char* Label;
+	const char* Comment;
+};
+
+//Open addressing (linear probing) hash table, maps label keys to their index in the label list
+class LabelHashIndex
+{
+private:
+	static constexpr uint32_t EmptySlot = UINT32_MAX;
+
+	struct Slot
+	{
+		uint64_t Key;
+		uint32_t Index;
+	};
+
+	vector<Slot> _slots;
+	uint32_t _mask = 0;
+	uint32_t _count = 0;
+
+	__forceinline uint32_t GetSlot(uint64_t key)
+	{
+		//Fibonacci hashing, spreads out consecutive addresses and memory types
+		return (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & _mask;
+	}
+
+	void Rehash(uint32_t slotCount);
+
+public:
+	static constexpr uint32_t NotFound = EmptySlot;
+
+	void Reserve(uint32_t count);
+	void Clear();
+
+	uint32_t Find(uint64_t key);
+	void Insert(uint64_t key, uint32_t index);
+	void Erase(uint64_t key);
+};
+
 class LabelManager
 {
 private:
-	unordered_map<uint64_t, LabelInfo, AddressHasher> _codeLabels;
+	struct LabelEntry
+	{
+		uint64_t Key;
+		uint32_t Length;
+		LabelInfo Info;
+	};
+
+	vector<LabelEntry> _labels;
+	LabelHashIndex _labelIndex;
 	unordered_map<string, uint64_t> _codeLabelReverseLookup;
 
+	//Sorted start keys of all multi-byte labels, used to find the label that contains a given address
+	vector<uint64_t> _rangeKeys;
+	//Length of the longest multi-byte label (not reduced when labels are removed), limits the search for overlapping labels
+	uint32_t _maxRangeLength = 0;
+
 	Debugger *_debugger;
 
 	int64_t GetLabelKey(uint32_t absoluteAddr, MemoryType memType);
 	MemoryType GetKeyMemoryType(uint64_t key);
+	string GetReverseLookupName(LabelEntry& entry);
+
+	void InternalSetLabel(uint32_t address, MemoryType memType, uint32_t length, string label, string comment, bool updateRangeKeys);
+	void RemoveLabel(uint32_t index, bool updateRangeKeys);
+	void RebuildRangeKeys();
+
+	LabelEntry* FindLabel(AddressInfo address, uint32_t& offset);
 	bool InternalGetLabel(AddressInfo address, string& label);
 
 public:
 	LabelManager(Debugger *debugger);
 
 	void SetLabel(uint32_t address, MemoryType memType, string label, string comment);
+	void SetLabels(CodeLabelInfo labels[], uint32_t count);
 	void ClearLabels();
 
 	AddressInfo GetLabelAbsoluteAddress(string& label);
@@ -46,6 +111,7 @@ public:
 	string GetLabel(AddressInfo address, bool checkRegisterLabels = true);
 	string GetComment(AddressInfo absAddress);
 	bool GetLabelAndComment(AddressInfo address, LabelInfo &label);
+	bool GetLabelContaining(AddressInfo address, LabelInfo& label, uint32_t& offset);
 
 	bool ContainsLabel(string &label);
 
@@ -1,10 +1,12 @@
 #include "pch.h"
 #include "Debugger/MemoryAccessCounter.h"
+#include "Debugger/MemoryAccessHeatmap.h"
 #include "Debugger/DebugBreakHelper.h"
 #include "Debugger/Debugger.h"
 #include "Debugger/DebugUtilities.h"
 #include "Debugger/MemoryDumper.h"
 #include "Shared/Interfaces/IConsole.h"
+#include "Shared/Emulator.h"
 
 MemoryAccessCounter::MemoryAccessCounter(Debugger* debugger)
 {
@@ -16,9 +18,21 @@ MemoryAccessCounter::MemoryAccessCounter(Debugger* debugger)
 	for(int i = (int)DebugUtilities::GetLastCpuMemoryType() + 1; i < DebugUtilities::GetMemoryTypeCount(); i++) {
 		uint32_t memSize = _debugger->GetMemoryDumper()->GetMemorySize((MemoryType)i);
 		if(memSize > 0) {
-			_counters[i] = vector<AddressCounters>(memSize);
+			_counters[i].resize((memSize + PageMask) >> PageShift);
+			_memorySize[i] = memSize;
 		}
 	}
+
+	_heatmap.reset(new MemoryAccessHeatmap(_memorySize));
+}
+
+MemoryAccessCounter::~MemoryAccessCounter()
+{
+}
+
+void MemoryAccessCounter::AllocatePage(unique_ptr<AddressCounters[]>& page)
+{
+	page.reset(new AddressCounters[PageSize]());
 }
 
 template<uint8_t accessWidth>
@@ -30,12 +44,16 @@ ReadResult MemoryAccessCounter::ProcessMemoryRead(AddressInfo &addressInfo, uint
 
 	ReadResult result = ReadResult::Normal;
 	for(int i = 0; i < accessWidth; i++) {
-		AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address+i];
+		AddressCounters& counts = GetCounters(addressInfo.Type, addressInfo.Address+i);
 		if(_enableBreakOnUninitRead && counts.WriteStamp == 0 && DebugUtilities::IsVolatileRam(addressInfo.Type)) {
 			result = (ReadResult)((int)result | (int)(counts.ReadStamp == 0 ? ReadResult::FirstUninitRead : ReadResult::UninitRead));
 		}
 		counts.ReadStamp = masterClock;
 		counts.ReadCounter++;
+
+		if(_heatmapEnabled) {
+			_heatmap->ProcessRead(addressInfo.Type, addressInfo.Address+i);
+		}
 	}
 	return result;
 }
@@ -48,9 +66,13 @@ void MemoryAccessCounter::ProcessMemoryWrite(AddressInfo& addressInfo, uint64_t
 	}
 
 	for(int i = 0; i < accessWidth; i++) {
-		AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address+i];
+		AddressCounters& counts = GetCounters(addressInfo.Type, addressInfo.Address+i);
 		counts.WriteStamp = masterClock;
 		counts.WriteCounter++;
+
+		if(_heatmapEnabled) {
+			_heatmap->ProcessWrite(addressInfo.Type, addressInfo.Address+i);
+		}
 	}
 }
 
@@ -62,9 +84,13 @@ void MemoryAccessCounter::ProcessMemoryExec(AddressInfo& addressInfo, uint64_t m
 	}
 
 	for(int i = 0; i < accessWidth; i++) {
-		AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address+i];
+		AddressCounters& counts = GetCounters(addressInfo.Type, addressInfo.Address+i);
 		counts.ExecStamp = masterClock;
 		counts.ExecCounter++;
+
+		if(_heatmapEnabled) {
+			_heatmap->ProcessExec(addressInfo.Type, addressInfo.Address+i);
+		}
 	}
 }
 
@@ -72,11 +98,43 @@ void MemoryAccessCounter::ResetCounts()
 {
 	DebugBreakHelper helper(_debugger);
 	for(int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
-		memset(_counters[i].data(), 0, _counters[i].size() * sizeof(AddressCounters));
+		for(unique_ptr<AddressCounters[]>& page : _counters[i]) {
+			if(page) {
+				memset(page.get(), 0, PageSize * sizeof(AddressCounters));
+			}
+		}
 	}
 	_enableBreakOnUninitRead = _debugger->GetConsole()->GetMasterClock() < 1000;
 }
 
+void MemoryAccessCounter::ProcessEndFrame()
+{
+	if(_heatmapEnabled && !_heatmap->ProcessEndFrame(_debugger->GetEmulator()->GetFrameCount())) {
+		//Requested number of frames has been captured - write the last frame and close the file
+		_heatmapEnabled = false;
+		_heatmap->Stop();
+	}
+}
+
+bool MemoryAccessCounter::StartHeatmapCapture(string filename, uint32_t frameCount)
+{
+	DebugBreakHelper helper(_debugger);
+	_heatmapEnabled = frameCount > 0 && _heatmap->Start(filename, frameCount);
+	return _heatmapEnabled;
+}
+
+void MemoryAccessCounter::StopHeatmapCapture()
+{
+	DebugBreakHelper helper(_debugger);
+	_heatmapEnabled = false;
+	_heatmap->Stop();
+}
+
+bool MemoryAccessCounter::IsHeatmapCaptureRunning()
+{
+	return _heatmapEnabled;
+}
+
 void MemoryAccessCounter::GetAccessCounts(uint32_t offset, uint32_t length, MemoryType memoryType, AddressCounters counts[])
 {
 	if(DebugUtilities::IsRelativeMemory(memoryType)) {
@@ -86,12 +144,23 @@ void MemoryAccessCounter::GetAccessCounts(uint32_t offset, uint32_t length, Memo
 			addr.Address = offset + i;
 			AddressInfo info = _debugger->GetAbsoluteAddress(addr);
 			if(info.Address >= 0) {
-				counts[i] = _counters[(int)info.Type][info.Address];
+				unique_ptr<AddressCounters[]>& page = _counters[(int)info.Type][info.Address >> PageShift];
+				counts[i] = page ? page[info.Address & PageMask] : AddressCounters {};
 			}
 		}
 	} else {
-		if(offset + length <= _counters[(int)memoryType].size()) {
-			memcpy(counts, _counters[(int)memoryType].data() + offset, length * sizeof(AddressCounters));
+		if(offset + length <= _memorySize[(int)memoryType]) {
+			for(uint32_t i = 0; i < length;) {
+				uint32_t addr = offset + i;
+				uint32_t count = std::min(PageSize - (addr & PageMask), length - i);
+				unique_ptr<AddressCounters[]>& page = _counters[(int)memoryType][addr >> PageShift];
+				if(page) {
+					memcpy(counts + i, page.get() + (addr & PageMask), count * sizeof(AddressCounters));
+				} else {
+					memset(counts + i, 0, count * sizeof(AddressCounters));
+				}
+				i += count;
+			}
 		}
 	}
 }
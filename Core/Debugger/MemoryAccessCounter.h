@@ -12,6 +12,7 @@ class Sa1;
 class Gsu;
 class Cx4;
 class Gameboy;
+class MemoryAccessHeatmap;
 
 struct AddressCounters
 {
@@ -33,19 +34,45 @@ enum class ReadResult
 class MemoryAccessCounter
 {
 private:
-	vector<AddressCounters> _counters[DebugUtilities::GetMemoryTypeCount()];
+	static constexpr uint32_t PageShift = 12;
+	static constexpr uint32_t PageSize = 1 << PageShift;
+	static constexpr uint32_t PageMask = PageSize - 1;
+
+	//Counters are allocated in 4 KB pages, on first access (most of the ROM is usually never accessed)
+	vector<unique_ptr<AddressCounters[]>> _counters[DebugUtilities::GetMemoryTypeCount()];
+	uint32_t _memorySize[DebugUtilities::GetMemoryTypeCount()] = {};
+
+	unique_ptr<MemoryAccessHeatmap> _heatmap;
+	bool _heatmapEnabled = false;
 
 	Debugger* _debugger = nullptr;
 	bool _enableBreakOnUninitRead = false;
 
+	__noinline void AllocatePage(unique_ptr<AddressCounters[]>& page);
+
+	__forceinline AddressCounters& GetCounters(MemoryType memType, uint32_t addr)
+	{
+		unique_ptr<AddressCounters[]>& page = _counters[(int)memType][addr >> PageShift];
+		if(!page) {
+			AllocatePage(page);
+		}
+		return page[addr & PageMask];
+	}
+
 public:
 	MemoryAccessCounter(Debugger *debugger);
+	~MemoryAccessCounter();
 
 	template<uint8_t accessWidth = 1> ReadResult ProcessMemoryRead(AddressInfo& addressInfo, uint64_t masterClock);
 	template<uint8_t accessWidth = 1> void ProcessMemoryWrite(AddressInfo& addressInfo, uint64_t masterClock);
 	template<uint8_t accessWidth = 1> void ProcessMemoryExec(AddressInfo& addressInfo, uint64_t masterClock);
 
 	void ResetCounts();
+	void ProcessEndFrame();
+
+	bool StartHeatmapCapture(string filename, uint32_t frameCount);
+	void StopHeatmapCapture();
+	bool IsHeatmapCaptureRunning();
 
 	void GetAccessCounts(uint32_t offset, uint32_t length, MemoryType memoryType, AddressCounters counts[]);
 };
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "Debugger/MemoryAccessHeatmap.h"
+
+MemoryAccessHeatmap::MemoryAccessHeatmap(uint32_t memorySize[DebugUtilities::GetMemoryTypeCount()])
+{
+	_writePending = false;
+	_stopFlag = false;
+
+	for(HeatmapBuffer& buffer : _buffers) {
+		for(int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
+			buffer.Pages[i].resize((memorySize[i] + PageMask) >> PageShift);
+		}
+	}
+}
+
+MemoryAccessHeatmap::~MemoryAccessHeatmap()
+{
+	Stop();
+}
+
+bool MemoryAccessHeatmap::Start(string filename, uint32_t frameCount)
+{
+	Stop();
+
+	_file.open(filename, ios::out | ios::binary);
+	if(!_file) {
+		return false;
+	}
+
+	_file.write("MHMP", 4);
+	_file.write((char*)&FileVersion, sizeof(FileVersion));
+	_file.write((char*)&PageSize, sizeof(PageSize));
+
+	_framesLeft = frameCount;
+	_stopFlag = false;
+	_writePending = false;
+	_frameReady.Reset();
+	_writeDone.Reset();
+	_writeThread.reset(new thread(&MemoryAccessHeatmap::WriteThread, this));
+	return true;
+}
+
+void MemoryAccessHeatmap::Stop()
+{
+	if(_writeThread) {
+		//Let the writer thread finish the frame it is currently writing
+		_stopFlag = true;
+		_frameReady.Signal();
+		_writeThread->join();
+		_writeThread.reset();
+	}
+
+	if(_file) {
+		_file.close();
+	}
+
+	//Discard the partial frame that was being captured
+	for(HeatmapBuffer& buffer : _buffers) {
+		for(auto& [memType, pageIndex] : buffer.UsedPages) {
+			HeatmapPage* page = buffer.Pages[(int)memType][pageIndex].get();
+			memset(page, 0, sizeof(HeatmapPage));
+		}
+		buffer.UsedPages.clear();
+	}
+}
+
+MemoryAccessHeatmap::HeatmapPage* MemoryAccessHeatmap::AllocatePage(MemoryType memType, uint32_t pageIndex)
+{
+	unique_ptr<HeatmapPage>& page = _front->Pages[(int)memType][pageIndex];
+	if(!page) {
+		page.reset(new HeatmapPage());
+	}
+	page->Used = true;
+	_front->UsedPages.push_back({ memType, pageIndex });
+	return page.get();
+}
+
+bool MemoryAccessHeatmap::ProcessEndFrame(uint32_t frameNumber)
+{
+	if(!_writeThread || _framesLeft == 0) {
+		return false;
+	}
+
+	//Wait for the previous frame to be written, this only blocks if the disk can't keep up
+	while(_writePending) {
+		_writeDone.Wait(10);
+	}
+
+	_front->FrameNumber = frameNumber;
+	std::swap(_front, _back);
+	_writePending = true;
+	_frameReady.Signal();
+
+	_framesLeft--;
+	return _framesLeft > 0;
+}
+
+void MemoryAccessHeatmap::WriteThread()
+{
+	while(true) {
+		_frameReady.Wait();
+		if(_writePending) {
+			WriteFrame(*_back);
+			_writePending = false;
+			_writeDone.Signal();
+		}
+
+		if(_stopFlag) {
+			break;
+		}
+	}
+	_file.flush();
+}
+
+void MemoryAccessHeatmap::WriteFrame(HeatmapBuffer& buffer)
+{
+	uint32_t pageCount = (uint32_t)buffer.UsedPages.size();
+	_file.write((char*)&buffer.FrameNumber, sizeof(buffer.FrameNumber));
+	_file.write((char*)&pageCount, sizeof(pageCount));
+
+	for(auto& [memType, pageIndex] : buffer.UsedPages) {
+		HeatmapPage* page = buffer.Pages[(int)memType][pageIndex].get();
+		uint8_t type = (uint8_t)memType;
+		_file.write((char*)&type, sizeof(type));
+		_file.write((char*)&pageIndex, sizeof(pageIndex));
+		_file.write((char*)page->Read, sizeof(page->Read));
+		_file.write((char*)page->Write, sizeof(page->Write));
+		_file.write((char*)page->Exec, sizeof(page->Exec));
+
+		//Clear the page so it can be reused when this buffer becomes the front buffer again
+		memset(page, 0, sizeof(HeatmapPage));
+	}
+	buffer.UsedPages.clear();
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "pch.h"
+#include "Debugger/DebugUtilities.h"
+#include "Shared/MemoryType.h"
+#include "Utilities/AutoResetEvent.h"
+
+//Captures per-frame read/write/exec histograms and streams them to a file.
+//File format (little endian):
+//  Header: "MHMP" (4 bytes), version (uint32), page size (uint32)
+//  For each frame: frame number (uint32), page count (uint32), then for each page:
+//    memory type (uint8), page index (uint32), read/write/exec counters (3 x page size x uint16)
+//Only pages that were accessed during the frame are written.
+class MemoryAccessHeatmap
+{
+public:
+	static constexpr uint32_t PageShift = 12;
+	static constexpr uint32_t PageSize = 1 << PageShift;
+	static constexpr uint32_t PageMask = PageSize - 1;
+
+private:
+	static constexpr uint32_t FileVersion = 1;
+
+	struct HeatmapPage
+	{
+		uint16_t Read[PageSize];
+		uint16_t Write[PageSize];
+		uint16_t Exec[PageSize];
+		bool Used;
+	};
+
+	struct HeatmapBuffer
+	{
+		vector<unique_ptr<HeatmapPage>> Pages[DebugUtilities::GetMemoryTypeCount()];
+		vector<std::pair<MemoryType, uint32_t>> UsedPages;
+		uint32_t FrameNumber = 0;
+	};
+
+	//The emulation thread fills the front buffer while the writer thread streams the back buffer to disk
+	HeatmapBuffer _buffers[2];
+	HeatmapBuffer* _front = &_buffers[0];
+	HeatmapBuffer* _back = &_buffers[1];
+
+	ofstream _file;
+	unique_ptr<thread> _writeThread;
+	AutoResetEvent _frameReady;
+	AutoResetEvent _writeDone;
+	atomic<bool> _writePending;
+	atomic<bool> _stopFlag;
+	uint32_t _framesLeft = 0;
+
+	void WriteThread();
+	void WriteFrame(HeatmapBuffer& buffer);
+
+	__noinline HeatmapPage* AllocatePage(MemoryType memType, uint32_t pageIndex);
+
+	__forceinline HeatmapPage* GetPage(MemoryType memType, uint32_t addr)
+	{
+		uint32_t pageIndex = addr >> PageShift;
+		HeatmapPage* page = _front->Pages[(int)memType][pageIndex].get();
+		if(!page || !page->Used) {
+			return AllocatePage(memType, pageIndex);
+		}
+		return page;
+	}
+
+	__forceinline void Increment(uint16_t& counter)
+	{
+		//Saturate at 65535 accesses per frame
+		counter += counter != 0xFFFF;
+	}
+
+public:
+	MemoryAccessHeatmap(uint32_t memorySize[DebugUtilities::GetMemoryTypeCount()]);
+	~MemoryAccessHeatmap();
+
+	bool Start(string filename, uint32_t frameCount);
+	void Stop();
+
+	__forceinline void ProcessRead(MemoryType memType, uint32_t addr) { Increment(GetPage(memType, addr)->Read[addr & PageMask]); }
+	__forceinline void ProcessWrite(MemoryType memType, uint32_t addr) { Increment(GetPage(memType, addr)->Write[addr & PageMask]); }
+	__forceinline void ProcessExec(MemoryType memType, uint32_t addr) { Increment(GetPage(memType, addr)->Exec[addr & PageMask]); }
+
+	//Returns false once the requested number of frames has been captured
+	bool ProcessEndFrame(uint32_t frameNumber);
+};
@@ -0,0 +1,166 @@
+#include "pch.h"
+#include "Debugger/SamplingProfiler.h"
+#include "Debugger/CallstackManager.h"
+#include "Debugger/DebugBreakHelper.h"
+#include "Debugger/Debugger.h"
+#include "Debugger/IDebugger.h"
+#include "Debugger/LabelManager.h"
+#include "Utilities/HexUtilities.h"
+
+SamplingProfiler::SamplingProfiler(Debugger* debugger, IDebugger* cpuDebugger, CallstackManager* callstackManager)
+{
+	_debugger = debugger;
+	_cpuDebugger = cpuDebugger;
+	_callstackManager = callstackManager;
+}
+
+void SamplingProfiler::SetOptions(SamplingProfilerOptions options)
+{
+	DebugBreakHelper helper(_debugger);
+
+	_sampleInterval = std::max<uint32_t>(options.SampleInterval, 1);
+	_stackDepth = std::clamp<uint32_t>(options.StackDepth, 1, SamplingProfiler::MaxStackDepth);
+	_includePc = options.IncludeProgramCounter;
+
+	if(options.Enabled) {
+		if(!_samples) {
+			_samples.reset(new ProfilerSample[SamplingProfiler::BufferSize]);
+		}
+		if(!IsEnabled()) {
+			_nextSampleClock = 0;
+		}
+	} else {
+		_nextSampleClock = SamplingProfiler::DisabledClock;
+	}
+
+	_debugger->RefreshHookFlags();
+}
+
+void SamplingProfiler::Reset()
+{
+	DebugBreakHelper helper(_debugger);
+	_sampleCount = 0;
+	_totalSamples = 0;
+	_foldedStacks.clear();
+	_relativeAddresses.clear();
+}
+
+void SamplingProfiler::ResetSampleClock()
+{
+	if(IsEnabled()) {
+		//Sample again right away, otherwise no samples are taken until the clock catches up to its previous value
+		_nextSampleClock = 0;
+	}
+}
+
+void SamplingProfiler::TakeSample(uint64_t masterClock)
+{
+	_nextSampleClock = masterClock + _sampleInterval;
+
+	ProfilerSample& sample = _samples[_sampleCount];
+	MemoryOperationInfo& op = _cpuDebugger->InstructionProgress.LastMemOperation;
+	sample.RelProgramCounter = op.Address;
+	sample.ProgramCounter = _includePc ? _debugger->GetAbsoluteAddress({ (int32_t)op.Address, op.MemType }) : AddressInfo { -1, MemoryType::None };
+	sample.Depth = _callstackManager->GetFunctionStack(sample.Frames, sample.RelFrames, _stackDepth);
+
+	_sampleCount++;
+	if(_sampleCount == SamplingProfiler::BufferSize) {
+		//Ring buffer is full, aggregate its content (this is the only costly operation, and it happens once every BufferSize samples)
+		FoldSamples();
+	}
+}
+
+void SamplingProfiler::FoldSamples()
+{
+	vector<uint64_t> stack;
+	stack.reserve(SamplingProfiler::MaxStackDepth + 1);
+
+	auto addFrame = [&](AddressInfo& absAddr, uint32_t relAddr) {
+		uint64_t key = GetFrameKey(absAddr, relAddr);
+		if(_relativeAddresses.find(key) == _relativeAddresses.end()) {
+			_relativeAddresses[key] = relAddr;
+		}
+		stack.push_back(key);
+	};
+
+	for(uint32_t i = 0; i < _sampleCount; i++) {
+		ProfilerSample& sample = _samples[i];
+		stack.clear();
+		for(uint32_t j = 0; j < sample.Depth; j++) {
+			addFrame(sample.Frames[j], sample.RelFrames[j]);
+		}
+		if(_includePc) {
+			addFrame(sample.ProgramCounter, sample.RelProgramCounter);
+		}
+		_foldedStacks[stack]++;
+	}
+
+	_totalSamples += _sampleCount;
+	_sampleCount = 0;
+}
+
+uint64_t SamplingProfiler::GetFrameKey(AddressInfo& absAddr, uint32_t relAddr)
+{
+	if(absAddr.Address < 0) {
+		//Unmapped code (e.g open bus), use the relative address instead
+		return relAddr | ((uint64_t)0xFF << 32);
+	}
+	return (uint32_t)absAddr.Address | ((uint64_t)absAddr.Type << 32);
+}
+
+string SamplingProfiler::GetFrameName(uint64_t key)
+{
+	uint32_t relAddr = _relativeAddresses[key];
+	if((key >> 32) != 0xFF) {
+		AddressInfo absAddr = { (int32_t)(key & 0xFFFFFFFF), (MemoryType)(key >> 32) };
+		string label = _debugger->GetLabelManager()->GetLabel(absAddr);
+		if(!label.empty()) {
+			return label;
+		}
+	}
+	return "$" + HexUtilities::ToHex(relAddr);
+}
+
+uint64_t SamplingProfiler::GetSampleCount()
+{
+	DebugBreakHelper helper(_debugger);
+	return _totalSamples + _sampleCount;
+}
+
+string SamplingProfiler::GetFoldedStacks()
+{
+	DebugBreakHelper helper(_debugger);
+	FoldSamples();
+
+	//Folded stack format (as used by flamegraph.pl, speedscope, etc.): "outer;inner;leaf count"
+	unordered_map<uint64_t, string> names;
+	stringstream out;
+	for(auto& [stack, count] : _foldedStacks) {
+		if(stack.empty()) {
+			out << "[none]";
+		}
+		for(size_t i = 0; i < stack.size(); i++) {
+			auto result = names.find(stack[i]);
+			if(result == names.end()) {
+				result = names.emplace(stack[i], GetFrameName(stack[i])).first;
+			}
+			if(i > 0) {
+				out << ";";
+			}
+			out << result->second;
+		}
+		out << " " << count << "\n";
+	}
+	return out.str();
+}
+
+bool SamplingProfiler::ExportFoldedStacks(string filename)
+{
+	ofstream file(filename, ios::out | ios::binary);
+	if(!file) {
+		return false;
+	}
+	file << GetFoldedStacks();
+	file.close();
+	return true;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "pch.h"
+#include <map>
+#include "Debugger/DebugTypes.h"
+
+class Debugger;
+class IDebugger;
+class CallstackManager;
+
+struct SamplingProfilerOptions
+{
+	bool Enabled;
+	bool IncludeProgramCounter;
+	uint32_t SampleInterval;
+	uint32_t StackDepth;
+};
+
+class SamplingProfiler
+{
+public:
+	static constexpr uint32_t MaxStackDepth = 16;
+
+private:
+	static constexpr uint32_t BufferSize = 0x4000;
+	static constexpr uint64_t DisabledClock = UINT64_MAX;
+
+	struct ProfilerSample
+	{
+		AddressInfo ProgramCounter;
+		uint32_t RelProgramCounter;
+		uint32_t Depth;
+		AddressInfo Frames[MaxStackDepth];
+		uint32_t RelFrames[MaxStackDepth];
+	};
+
+	Debugger* _debugger = nullptr;
+	IDebugger* _cpuDebugger = nullptr;
+	CallstackManager* _callstackManager = nullptr;
+
+	unique_ptr<ProfilerSample[]> _samples;
+	uint32_t _sampleCount = 0;
+
+	//Samples are folded into this map (outermost frame first) whenever the ring buffer is full
+	std::map<vector<uint64_t>, uint64_t> _foldedStacks;
+	unordered_map<uint64_t, uint32_t> _relativeAddresses;
+	uint64_t _totalSamples = 0;
+
+	uint64_t _nextSampleClock = DisabledClock;
+	uint32_t _sampleInterval = 10000;
+	uint32_t _stackDepth = 8;
+	bool _includePc = true;
+
+	void TakeSample(uint64_t masterClock);
+	void FoldSamples();
+	uint64_t GetFrameKey(AddressInfo& absAddr, uint32_t relAddr);
+	string GetFrameName(uint64_t key);
+
+public:
+	SamplingProfiler(Debugger* debugger, IDebugger* cpuDebugger, CallstackManager* callstackManager);
+
+	__forceinline bool IsEnabled() { return _nextSampleClock != DisabledClock; }
+
+	__forceinline void ProcessInstruction(uint64_t masterClock)
+	{
+		if(masterClock >= _nextSampleClock) {
+			TakeSample(masterClock);
+		}
+	}
+
+	void SetOptions(SamplingProfilerOptions options);
+	void Reset();
+
+	//Called when the master clock can move backwards (e.g state loaded, rewind)
+	void ResetSampleClock();
+
+	uint64_t GetSampleCount();
+	string GetFoldedStacks();
+	bool ExportFoldedStacks(string filename);
+};
@@ -31,6 +31,7 @@ int ScriptManager::LoadScript(string name, string path, string content, int32_t
 		scriptId = script->GetScriptId();
 		_scripts.push_back(std::move(script));
 		_hasScript = true;
+		_debugger->RefreshHookFlags();
 		return scriptId;
 	} else {
 		auto result = std::find_if(_scripts.begin(), _scripts.end(), [=](unique_ptr<ScriptHost> &script) {
@@ -76,6 +77,15 @@ void ScriptManager::RefreshMemoryCallbackFlags()
 	for(unique_ptr<ScriptHost>& script : _scripts) {
 		script->RefreshMemoryCallbackFlags();
 	}
+	_debugger->RefreshHookFlags();
+}
+
+void ScriptManager::EnableCpuMemoryCallbacks()
+{
+	if(!_isCpuMemoryCallbackEnabled) {
+		_isCpuMemoryCallbackEnabled = true;
+		_debugger->RefreshHookFlags();
+	}
 }
 
 string ScriptManager::GetScriptLog(int32_t scriptId)
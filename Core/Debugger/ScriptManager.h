@@ -31,7 +31,7 @@ public:
 	string GetScriptLog(int32_t scriptId);
 	void ProcessEvent(EventType type, CpuType cpuType);
 
-	void EnableCpuMemoryCallbacks() { _isCpuMemoryCallbackEnabled = true; }
+	void EnableCpuMemoryCallbacks();
 	bool HasCpuMemoryCallbacks() { return _scripts.size() && _isCpuMemoryCallbackEnabled; }
 
 	void EnablePpuMemoryCallbacks() { _isPpuMemoryCallbackEnabled = true; }
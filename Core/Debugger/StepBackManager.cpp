@@ -5,6 +5,7 @@
 #include "Shared/SaveStateManager.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/RewindManager.h"
+#include "Shared/BaseControlDevice.h"
 
 StepBackManager::StepBackManager(Emulator* emu, IDebugger* debugger)
 {
@@ -13,6 +14,14 @@ StepBackManager::StepBackManager(Emulator* emu, IDebugger* debugger)
 	_debugger = debugger;
 }
 
+StepBackManager::~StepBackManager()
+{
+	if(_active) {
+		_rewindManager->StopStepBackReplay();
+	}
+	SetCheckpointsEnabled(false);
+}
+
 void StepBackManager::StepBack(StepBackType type)
 {
 	if(!_active) {
@@ -28,6 +37,7 @@ void StepBackManager::StepBack(StepBackType type)
 		_targetClock = (uint64_t)std::max<int64_t>(0, target);
 		
 		_active = true;
+		_replaying = false;
 		_allowRetry = true;
 		_stateClockLimit = StepBackManager::DefaultClockLimit;
 	}
@@ -41,7 +51,7 @@ bool StepBackManager::CheckStepBack()
 
 	uint64_t clock = _debugger->GetStepBackConfig().CurrentCycle;
 
-	if(!_rewindManager->IsStepBack()) {
+	if(!_replaying) {
 		if(_cache.size() > 1) {
 			//Check to see if previous instruction is already in cache
 			if(_cache.back().Clock == _targetClock) {
@@ -49,9 +59,7 @@ bool StepBackManager::CheckStepBack()
 				_cache.pop_back();
 				if(_cache.size()) {
 					//If cache isn't empty, load the last state
-					_emu->Deserialize(_cache.back().SaveState, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
-
-					_emu->GetRewindManager()->StopRewinding(true, true);
+					LoadCacheEntry(_cache.back());
 					_active = false;
 					_prevClock = clock;
 					return true;
@@ -64,35 +72,34 @@ bool StepBackManager::CheckStepBack()
 
 		//Start rewinding on next instruction after StepBack() is called
 		_cache.clear();
-		_rewindManager->StartRewinding(true);
+		StartReplay();
 		clock = _debugger->GetStepBackConfig().CurrentCycle;
 	}
 
 	if(clock < _targetClock && _targetClock - clock < _stateClockLimit) {
 		//Create a save state every instruction for the last X clocks
 		_cache.push_back(StepBackCacheEntry());
-		_cache.back().Clock = clock;
-		_emu->Serialize(_cache.back().SaveState, true, 0);
+		SaveState(_cache.back(), clock);
 	}
 
 	if(clock >= _targetClock) {
 		//If the CPU is back to where it was before step back, check if the cache contains data
 		if(_cache.size() > 0) {
-			_emu->Deserialize(_cache.back().SaveState, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
-			_rewindManager->StopRewinding(true, true);
+			LoadCacheEntry(_cache.back());
 		} else if(_allowRetry && clock > _prevClock && (clock - _prevClock) > StepBackManager::DefaultClockLimit) {
 			//Cache is empty, this can happen when a single instruction takes more than X clocks (e.g block transfers, dma)
 			//In this case, re-run the step back process again but start recordings state earlier
-			_rewindManager->StopRewinding(true);
-			_rewindManager->StartRewinding(true);
 			_stateClockLimit = (clock - _prevClock) + StepBackManager::DefaultClockLimit;
 			_allowRetry = false;
+			StartReplay();
 			return false;
 		} else {
 			//Stop rewinding, even if the target was not found
 			_rewindManager->StopRewinding(true);
+			_rewindManager->StopStepBackReplay();
 		}
 		_active = false;
+		_replaying = false;
 		_prevClock = clock;
 		return true;
 	}
@@ -100,3 +107,177 @@ bool StepBackManager::CheckStepBack()
 	_prevClock = clock;
 	return false;
 }
+
+void StepBackManager::StartReplay()
+{
+	_replaying = true;
+	_fromCheckpoint = LoadCheckpoint();
+	if(_fromCheckpoint) {
+		//The frames are replayed without the rewind manager, it still needs to mute the audio and hide the frames until the target is reached
+		_rewindManager->StartStepBackReplay();
+	} else {
+		//No usable checkpoint, go back to the last rewind save state and run forward from there instead
+		//The rewind history is modified by this process, so the checkpoints can't be used after this
+		ClearCheckpoints();
+		_rewindManager->StopStepBackReplay();
+		_rewindManager->StopRewinding(true);
+		_rewindManager->StartRewinding(true);
+	}
+}
+
+void StepBackManager::SaveState(StepBackCacheEntry& entry, uint64_t clock)
+{
+	entry.Clock = clock;
+	entry.InputPosition = _inputPosition;
+	entry.HistoryPosition = _rewindManager->GetHistoryPosition();
+	_emu->Serialize(entry.SaveState, true, 0);
+}
+
+void StepBackManager::LoadState(StepBackCacheEntry& entry)
+{
+	entry.SaveState.seekg(0);
+	_emu->Deserialize(entry.SaveState, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
+	_inputPosition = entry.InputPosition;
+
+	//Checkpoints taken after this point in time are no longer valid
+	TrimCheckpoints(entry.Clock);
+}
+
+void StepBackManager::LoadCacheEntry(StepBackCacheEntry& entry)
+{
+	LoadState(entry);
+
+	//When running forward from a checkpoint, the rewind history needs to be truncated to match the state that was loaded
+	//When running forward from a rewind save state, the rewind manager takes care of this instead
+	_rewindManager->RestoreHistoryPosition(entry.HistoryPosition);
+	_rewindManager->StopRewinding(true, true);
+	_rewindManager->StopStepBackReplay();
+}
+
+void StepBackManager::AddCheckpoint()
+{
+	_instructionCount = 0;
+	if(_active || _rewindManager->IsRewinding()) {
+		return;
+	}
+
+	_checkpoints.push_back(StepBackCacheEntry());
+	StepBackCacheEntry& checkpoint = _checkpoints.back();
+	SaveState(checkpoint, _debugger->GetStepBackConfig().CurrentCycle);
+	_checkpointMemoryUsage += checkpoint.SaveState.tellp();
+
+	//Drop the oldest checkpoints when over the memory limit
+	while(_checkpointMemoryUsage > StepBackManager::CheckpointMemoryLimit && _checkpoints.size() > 1) {
+		_checkpointMemoryUsage -= _checkpoints.front().SaveState.tellp();
+		_checkpoints.pop_front();
+	}
+
+	TrimInputLog();
+}
+
+void StepBackManager::TrimInputLog()
+{
+	//Input polled before the oldest checkpoint can never be played back
+	uint32_t start = _checkpoints.empty() ? _inputPosition : _checkpoints.front().InputPosition;
+	while(_inputLogStart < start && !_inputLog.empty()) {
+		_inputLog.pop_front();
+		_inputLogStart++;
+	}
+
+	if(_inputLog.empty()) {
+		_inputLogStart = std::max(_inputLogStart, start);
+	}
+}
+
+bool StepBackManager::LoadCheckpoint()
+{
+	//Find the most recent checkpoint before the target
+	for(int i = (int)_checkpoints.size() - 1; i >= 0; i--) {
+		StepBackCacheEntry& checkpoint = _checkpoints[i];
+		if(checkpoint.Clock < _targetClock) {
+			if(!_rewindManager->RestoreHistoryPosition(checkpoint.HistoryPosition)) {
+				//Checkpoint is older than the rewind history's current block, it can't be used
+				return false;
+			}
+			LoadState(checkpoint);
+			return true;
+		}
+	}
+	return false;
+}
+
+void StepBackManager::TrimCheckpoints(uint64_t clock)
+{
+	while(_checkpoints.size() > 0 && _checkpoints.back().Clock > clock) {
+		_checkpointMemoryUsage -= _checkpoints.back().SaveState.tellp();
+		_checkpoints.pop_back();
+	}
+
+	TrimInputLog();
+}
+
+void StepBackManager::ClearCheckpoints()
+{
+	_checkpoints.clear();
+	_checkpointMemoryUsage = 0;
+	_inputLog.clear();
+	_inputLogStart = 0;
+	_inputPosition = 0;
+}
+
+void StepBackManager::SetCheckpointsEnabled(bool enabled)
+{
+	if(_checkpointsEnabled == enabled) {
+		return;
+	}
+
+	_checkpointsEnabled = enabled;
+	if(enabled) {
+		//Take a checkpoint on the next instruction
+		_instructionCount = StepBackManager::CheckpointInterval;
+		_emu->RegisterInputRecorder(this);
+		_emu->RegisterInputProvider(this);
+	} else {
+		_emu->UnregisterInputRecorder(this);
+		_emu->UnregisterInputProvider(this);
+		ClearCheckpoints();
+	}
+}
+
+void StepBackManager::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
+{
+	if(_active) {
+		if(_fromCheckpoint) {
+			//Input was played back from the log
+			_inputPosition++;
+		}
+		return;
+	}
+
+	if(_rewindManager->IsRewinding()) {
+		return;
+	}
+
+	if(_checkpoints.empty()) {
+		//Nothing to play the input back from
+		_inputPosition++;
+		TrimInputLog();
+		return;
+	}
+
+	_inputLog.resize(_inputPosition - _inputLogStart);
+	_inputLog.push_back(StepBackInputEntry());
+	for(shared_ptr<BaseControlDevice>& device : devices) {
+		_inputLog.back().States[device->GetPort()] = device->GetRawState();
+	}
+	_inputPosition++;
+}
+
+bool StepBackManager::SetInput(BaseControlDevice* device)
+{
+	if(_active && _fromCheckpoint && _inputPosition >= _inputLogStart && _inputPosition - _inputLogStart < _inputLog.size()) {
+		device->SetRawState(_inputLog[_inputPosition - _inputLogStart].States[device->GetPort()]);
+		return true;
+	}
+	return false;
+}
@@ -1,6 +1,8 @@
 #pragma once
 #include "pch.h"
 #include "Shared/RewindManager.h"
+#include "Shared/Interfaces/IInputProvider.h"
+#include "Shared/Interfaces/IInputRecorder.h"
 
 class Emulator;
 class IDebugger;
@@ -9,6 +11,13 @@ struct StepBackCacheEntry
 {
 	stringstream SaveState;
 	uint64_t Clock;
+	uint32_t InputPosition;
+	RewindHistoryPosition HistoryPosition;
+};
+
+struct StepBackInputEntry
+{
+	ControlDeviceState States[BaseControlDevice::PortCount];
 };
 
 struct StepBackConfig
@@ -25,10 +34,12 @@ enum class StepBackType
 	Frame
 };
 
-class StepBackManager
+class StepBackManager : public IInputRecorder, public IInputProvider
 {
 private:
 	static constexpr uint64_t DefaultClockLimit = 600; //Default to 600 clocks to avoid retry when NES sprite DMA occurs (~512 cycles)
+	static constexpr uint32_t CheckpointInterval = 10000; //Number of instructions between each checkpoint
+	static constexpr uint64_t CheckpointMemoryLimit = 64 * 1024 * 1024;
 
 	Emulator* _emu = nullptr;
 	RewindManager* _rewindManager = nullptr;
@@ -38,15 +49,56 @@ private:
 	uint64_t _targetClock = 0;
 	uint64_t _prevClock = 0;
 	bool _active = false;
+	bool _replaying = false;
 	bool _allowRetry = false;
 	uint64_t _stateClockLimit = StepBackManager::DefaultClockLimit;
 
+	//Checkpoints are taken while the debugger is stepping, step back restores the nearest one and runs forward
+	//from there, instead of rewinding to the last rewind save state (which can be up to 60 frames in the past)
+	deque<StepBackCacheEntry> _checkpoints;
+	uint64_t _checkpointMemoryUsage = 0;
+	uint32_t _instructionCount = 0;
+	bool _checkpointsEnabled = false;
+	bool _fromCheckpoint = false;
+
+	//Input polled since the oldest checkpoint, played back when running forward from a checkpoint
+	//Positions are absolute, _inputLogStart is the position of the first entry in the log
+	deque<StepBackInputEntry> _inputLog;
+	uint32_t _inputLogStart = 0;
+	uint32_t _inputPosition = 0;
+
+	void StartReplay();
+	void SaveState(StepBackCacheEntry& entry, uint64_t clock);
+	void LoadState(StepBackCacheEntry& entry);
+	void LoadCacheEntry(StepBackCacheEntry& entry);
+
+	void AddCheckpoint();
+	bool LoadCheckpoint();
+	void TrimCheckpoints(uint64_t clock);
+	void TrimInputLog();
+	void ClearCheckpoints();
+
 public:
 	StepBackManager(Emulator* emu, IDebugger* debugger);
+	virtual ~StepBackManager();
 
 	void StepBack(StepBackType type);
 	bool CheckStepBack();
 
+	__forceinline void ProcessInstruction()
+	{
+		_instructionCount++;
+		if(_instructionCount >= StepBackManager::CheckpointInterval) {
+			AddCheckpoint();
+		}
+	}
+
+	void SetCheckpointsEnabled(bool enabled);
+	bool IsCheckpointsEnabled() { return _checkpointsEnabled; }
+
+	void RecordInput(vector<shared_ptr<BaseControlDevice>> devices) override;
+	bool SetInput(BaseControlDevice* device) override;
+
 	void ResetCache() { _cache.clear(); }
 	bool IsRewinding() { return _active || _rewindManager->IsRewinding(); }
-};
\ No newline at end of file
+};
@@ -81,16 +81,17 @@ void GbaDebugger::Reset()
 	ResetPrevOpCode();
 }
 
+template<uint8_t hooks>
 void GbaDebugger::ProcessInstruction()
 {
 	if(GbaDisUtils::IsThumbMode(_cpu->GetState().CPSR.ToInt32())) {
-		ProcessInstruction<2>();
+		ProcessInstruction<2, hooks>();
 	} else {
-		ProcessInstruction<4>();
+		ProcessInstruction<4, hooks>();
 	}
 }
 
-template<uint8_t accessWidth>
+template<uint8_t accessWidth, uint8_t hooks>
 void GbaDebugger::ProcessInstruction()
 {
 	GbaCpuState& state = _cpu->GetState();
@@ -105,18 +106,22 @@ void GbaDebugger::ProcessInstruction()
 	InstructionProgress.StartCycle = _memoryManager->GetMasterClock();
 
 	if(addressInfo.Type != MemoryType::None) {
-		if(addressInfo.Type == MemoryType::GbaPrgRom) {
-			_codeDataLogger->SetCode<accessWidth>(addressInfo.Address, GbaDisUtils::GetOpFlags(_prevOpCode, _prevFlags, pc, _prevProgramCounter) | flags);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::GbaPrgRom) {
+				_codeDataLogger->SetCode<accessWidth>(addressInfo.Address, GbaDisUtils::GetOpFlags(_prevOpCode, _prevFlags, pc, _prevProgramCounter) | flags);
+			}
 		}
 		_disassembler->BuildCache(addressInfo, flags, CpuType::Gba);
 	}
 
 	ProcessCallStackUpdates(addressInfo, pc);
 
-	if(_settings->CheckDebuggerFlag(DebuggerFlags::GbaDebuggerEnabled)) {
-		if(((accessWidth == 2 && opCode == 0x46DB) || (accessWidth == 4 && opCode == 0xE1A0B00B)) && _settings->GetDebugConfig().GbaBreakOnNopLoad) {
-			//Break on MOV R11, R11
-			_step->Break(BreakSource::GbaNopLoad);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		if(_settings->CheckDebuggerFlag(DebuggerFlags::GbaDebuggerEnabled)) {
+			if(((accessWidth == 2 && opCode == 0x46DB) || (accessWidth == 4 && opCode == 0xE1A0B00B)) && _settings->GetDebugConfig().GbaBreakOnNopLoad) {
+				//Break on MOV R11, R11
+				_step->Break(BreakSource::GbaNopLoad);
+			}
 		}
 	}
 	
@@ -124,33 +129,37 @@ void GbaDebugger::ProcessInstruction()
 	_prevOpCode = opCode;
 	_prevProgramCounter = pc;
 
-	_step->ProcessCpuExec();
-
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec<false, false>();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _memoryManager->GetAbsoluteAddress(memOp.Address);
-				switch(_dummyCpu->GetOperationMode(i) & (GbaAccessMode::Byte | GbaAccessMode::HalfWord | GbaAccessMode::Word)) {
-					case GbaAccessMode::Byte: _debugger->ProcessPredictiveBreakpoint<1>(CpuType::Gba, _breakpointManager.get(), memOp, absAddr); break;
-					case GbaAccessMode::HalfWord: _debugger->ProcessPredictiveBreakpoint<2>(CpuType::Gba, _breakpointManager.get(), memOp, absAddr); break;
-					case GbaAccessMode::Word: _debugger->ProcessPredictiveBreakpoint<4>(CpuType::Gba, _breakpointManager.get(), memOp, absAddr); break;
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
+
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
+			_dummyCpu->SetDummyState(state);
+			_dummyCpu->Exec<false, false>();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _memoryManager->GetAbsoluteAddress(memOp.Address);
+					switch(_dummyCpu->GetOperationMode(i) & (GbaAccessMode::Byte | GbaAccessMode::HalfWord | GbaAccessMode::Word)) {
+						case GbaAccessMode::Byte: _debugger->ProcessPredictiveBreakpoint<1>(CpuType::Gba, _breakpointManager.get(), memOp, absAddr); break;
+						case GbaAccessMode::HalfWord: _debugger->ProcessPredictiveBreakpoint<2>(CpuType::Gba, _breakpointManager.get(), memOp, absAddr); break;
+						case GbaAccessMode::Word: _debugger->ProcessPredictiveBreakpoint<4>(CpuType::Gba, _breakpointManager.get(), memOp, absAddr); break;
+					}
 				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions<accessWidth>(CpuType::Gba, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions<accessWidth>(CpuType::Gba, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 
-	if(_traceLogger->IsEnabled()) {
-		DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, pc, _prevFlags, CpuType::Gba);
-		_traceLogger->Log(state, disInfo, operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, pc, _prevFlags, CpuType::Gba);
+			_traceLogger->Log(state, disInfo, operation, addressInfo);
+		}
 	}
 }
 
-template<uint8_t accessWidth>
+template<uint8_t accessWidth, uint8_t hooks>
 void GbaDebugger::ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _memoryManager->GetAbsoluteAddress(addr);
@@ -161,8 +170,10 @@ void GbaDebugger::ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType
 		_memoryAccessCounter->ProcessMemoryExec<accessWidth>(addressInfo, _console->GetMasterClock());
 	} else {
 		if(addressInfo.Address >= 0) {
-			if(addressInfo.Type == MemoryType::GbaPrgRom) {
-				_codeDataLogger->SetData<0, accessWidth>(addressInfo.Address);
+			if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+				if(addressInfo.Type == MemoryType::GbaPrgRom) {
+					_codeDataLogger->SetData<0, accessWidth>(addressInfo.Address);
+				}
 			}
 
 			ReadResult result = _memoryAccessCounter->ProcessMemoryRead<accessWidth>(addressInfo, _console->GetMasterClock());
@@ -172,31 +183,41 @@ void GbaDebugger::ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType
 					//Only warn the first time
 					_debugger->Log("[GBA] Uninitialized memory read: $" + HexUtilities::ToHex(addr));
 				}
-				if(_settings->CheckDebuggerFlag(DebuggerFlags::GbaDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				if constexpr(hooks & DebugHookFlags::BreakChecks) {
+					if(_settings->CheckDebuggerFlag(DebuggerFlags::GbaDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+						_step->Break(BreakSource::BreakOnUninitMemoryRead);
+					}
 				}
 			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
-		if(addr >= 0x04000000 && addr < 0x08000000) {
-			_eventManager->AddEvent(DebugEventType::Register, operation);
+		if constexpr(hooks & DebugHookFlags::EventManager) {
+			if(addr >= 0x04000000 && addr < 0x08000000) {
+				_eventManager->AddEvent(DebugEventType::Register, operation);
+			}
 		}
 
-		_debugger->ProcessBreakConditions<accessWidth>(CpuType::Gba, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_debugger->ProcessBreakConditions<accessWidth>(CpuType::Gba, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	}
 }
 
-template<uint8_t accessWidth>
+template<uint8_t accessWidth, uint8_t hooks>
 void GbaDebugger::ProcessWrite(uint32_t addr, uint32_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _memoryManager->GetAbsoluteAddress(addr);
 	MemoryOperationInfo operation(addr, value, type, MemoryType::GbaMemory);
 	InstructionProgress.LastMemOperation = operation;
-	_debugger->ProcessBreakConditions<accessWidth>(CpuType::Gba, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_debugger->ProcessBreakConditions<accessWidth>(CpuType::Gba, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 
 	switch(addressInfo.Type) {
 		case MemoryType::GbaIntWorkRam:
@@ -209,12 +230,16 @@ void GbaDebugger::ProcessWrite(uint32_t addr, uint32_t value, MemoryOperationTyp
 			break;
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
-	if(addr >= 0x04000000 && addr < 0x08000000) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(addr >= 0x04000000 && addr < 0x08000000) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite<accessWidth>(addressInfo, _console->GetMasterClock());
@@ -480,13 +505,14 @@ void GbaDebugger::ProcessInputOverrides(DebugControllerState inputOverrides[8])
 	controlManager->RefreshHubState();
 }
 
-template void GbaDebugger::ProcessInstruction<2>();
-template void GbaDebugger::ProcessInstruction<4>();
-
-template void GbaDebugger::ProcessRead<1>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void GbaDebugger::ProcessRead<2>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void GbaDebugger::ProcessRead<4>(uint32_t addr, uint32_t value, MemoryOperationType type);
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void GbaDebugger::ProcessInstruction<hooks>(); \
+	template void GbaDebugger::ProcessRead<1, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void GbaDebugger::ProcessRead<2, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void GbaDebugger::ProcessRead<4, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void GbaDebugger::ProcessWrite<1, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void GbaDebugger::ProcessWrite<2, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void GbaDebugger::ProcessWrite<4, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type);
 
-template void GbaDebugger::ProcessWrite<1>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void GbaDebugger::ProcessWrite<2>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void GbaDebugger::ProcessWrite<4>(uint32_t addr, uint32_t value, MemoryOperationType type);
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
@@ -51,7 +51,7 @@ class GbaDebugger final : public IDebugger
 	string _cdlFile;
 
 	__forceinline void ProcessCallStackUpdates(AddressInfo& destAddr, uint32_t destPc);
-	template<uint8_t accessWidth> void ProcessInstruction();
+	template<uint8_t accessWidth, uint8_t hooks> void ProcessInstruction();
 
 public:
 	GbaDebugger(Debugger* debugger);
@@ -60,9 +60,9 @@ public:
 	void OnBeforeBreak(CpuType cpuType) override;
 	void Reset() override;
 
-	void ProcessInstruction();
-	template<uint8_t accessWidth> void ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType type);
-	template<uint8_t accessWidth> void ProcessWrite(uint32_t addr, uint32_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessInstruction();
+	template<uint8_t accessWidth, uint8_t hooks> void ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType type);
+	template<uint8_t accessWidth, uint8_t hooks> void ProcessWrite(uint32_t addr, uint32_t value, MemoryOperationType type);
 
 	void ProcessInterrupt(uint32_t originalPc, uint32_t currentPc, bool forNmi) override;
 	void ProcessPpuCycle();
@@ -58,18 +58,25 @@ GbaConsole::~GbaConsole()
 
 LoadRomResult GbaConsole::LoadRom(VirtualFile& romFile)
 {
-	vector<uint8_t> romData;
-	romFile.ReadFile(romData);
-
-	if(romData.size() < 0xC0) {
+	//Read the ROM directly from the file (memory-mapped when possible) to avoid making extra copies of large ROMs
+	VirtualFileSpan romData = romFile.GetSpan();
+	if(romData.Size < 0xC0) {
 		return LoadRomResult::Failure;
 	}
 
 	InitCart(romFile, romData);
 
-	_prgRomSize = (uint32_t)romData.size();
+	_prgRomSize = (uint32_t)romData.Size;
+	bool isClassicSeries = romData.Data[0xAC] == 'F';
+	if(isClassicSeries && _prgRomSize == 0x100000) {
+		//Mirror up to 4 MB to fix input problems
+		_prgRomSize = 0x400000;
+	}
+
 	_prgRom = new uint8_t[_prgRomSize];
-	memcpy(_prgRom, romData.data(), _prgRomSize);
+	for(uint32_t i = 0; i < _prgRomSize; i += (uint32_t)romData.Size) {
+		memcpy(_prgRom + i, romData.Data, romData.Size);
+	}
 	_emu->RegisterMemory(MemoryType::GbaPrgRom, _prgRom, _prgRomSize);
 
 	_bootRom = new uint8_t[GbaConsole::BootRomSize];
@@ -127,11 +134,11 @@ LoadRomResult GbaConsole::LoadRom(VirtualFile& romFile)
 	return LoadRomResult::Success;
 }
 
-void GbaConsole::InitCart(VirtualFile& romFile, vector<uint8_t>& romData)
+void GbaConsole::InitCart(VirtualFile& romFile, VirtualFileSpan romData)
 {
-	string title = StringUtilities::GetString(&romData[0xA0], 12);
-	string gameCode = StringUtilities::GetString(&romData[0xAC], 4);
-	string makerCode = StringUtilities::GetString(&romData[0xB0], 2);
+	string title = StringUtilities::GetString((uint8_t*)romData.Data + 0xA0, 12);
+	string gameCode = StringUtilities::GetString((uint8_t*)romData.Data + 0xAC, 4);
+	string makerCode = StringUtilities::GetString((uint8_t*)romData.Data + 0xB0, 2);
 
 	MessageManager::Log("-----------------------------");
 	MessageManager::Log("File: " + romFile.GetFileName());
@@ -141,11 +148,6 @@ void GbaConsole::InitCart(VirtualFile& romFile, vector<uint8_t>& romData)
 	
 	if(gameCode.size() > 0 && gameCode[0] == 'F') {
 		MessageManager::Log("Classic series game detected.");
-		if(romData.size() == 0x100000) {
-			//Mirror up to 4 MB to fix input problems
-			romData.insert(romData.end(), romData.begin(), romData.end());
-			romData.insert(romData.end(), romData.begin(), romData.end());
-		}
 	}
 
 	_cartType = GbaCartridgeType::Default;
@@ -174,7 +176,7 @@ void GbaConsole::InitCart(VirtualFile& romFile, vector<uint8_t>& romData)
 	MessageManager::Log("-----------------------------");
 }
 
-void GbaConsole::InitSaveRam(string& gameCode, vector<uint8_t>& romData)
+void GbaConsole::InitSaveRam(string& gameCode, VirtualFileSpan romData)
 {
 	_saveType = _emu->GetSettings()->GetGbaConfig().SaveType;
 
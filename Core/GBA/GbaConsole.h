@@ -18,6 +18,7 @@ class GbaTimer;
 class GbaRomPrefetch;
 class GbaSerial;
 class VirtualFile;
+struct VirtualFileSpan;
 class BaseControlManager;
 
 class GbaConsole final : public IConsole
@@ -66,8 +67,8 @@ private:
 
 	uint8_t* _bootRom = nullptr;
 
-	void InitSaveRam(string& gameCode, vector<uint8_t>& romData);
-	void InitCart(VirtualFile& romFile, vector<uint8_t>& romData);
+	void InitSaveRam(string& gameCode, VirtualFileSpan romData);
+	void InitCart(VirtualFile& romFile, VirtualFileSpan romData);
 
 public:
 	GbaConsole(Emulator* emu);
@@ -315,9 +315,13 @@ uint32_t GbaMemoryManager::Read(GbaAccessModeVal mode, uint32_t addr)
 		value = isSigned ? (uint32_t)(int8_t)value : (uint8_t)value;
 		_emu->ProcessMemoryRead<CpuType::Gba, 1>(addr, value, MemoryOperationType::Read);
 	} else if(mode & GbaAccessMode::HalfWord) {
-		uint8_t b0 = InternalRead(mode, addr & ~0x01, addr);
-		uint8_t b1 = InternalRead(mode, addr | 1, addr);
-		value = b0 | (b1 << 8);
+		if(uint8_t* src = GetFastReadPointer(addr & ~0x01)) {
+			value = src[0] | (src[1] << 8);
+		} else {
+			uint8_t b0 = InternalRead(mode, addr & ~0x01, addr);
+			uint8_t b1 = InternalRead(mode, addr | 1, addr);
+			value = b0 | (b1 << 8);
+		}
 		UpdateOpenBus<2>(addr, value);
 		value = isSigned ? (uint32_t)(int16_t)value : (uint16_t)value;
 		if(!(mode & GbaAccessMode::NoRotate) && (addr & 0x01)) {
@@ -325,11 +329,15 @@ uint32_t GbaMemoryManager::Read(GbaAccessModeVal mode, uint32_t addr)
 		}
 		_emu->ProcessMemoryRead<CpuType::Gba, 2>(addr & ~0x01, value, mode & GbaAccessMode::Prefetch ? MemoryOperationType::ExecOpCode : MemoryOperationType::Read);
 	} else {
-		uint8_t b0 = InternalRead(mode, addr & ~0x03, addr);
-		uint8_t b1 = InternalRead(mode, (addr & ~0x03) | 1, addr);
-		uint8_t b2 = InternalRead(mode, (addr & ~0x03) | 2, addr);
-		uint8_t b3 = InternalRead(mode, addr | 3, addr);
-		value = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
+		if(uint8_t* src = GetFastReadPointer(addr & ~0x03)) {
+			value = src[0] | (src[1] << 8) | (src[2] << 16) | (src[3] << 24);
+		} else {
+			uint8_t b0 = InternalRead(mode, addr & ~0x03, addr);
+			uint8_t b1 = InternalRead(mode, (addr & ~0x03) | 1, addr);
+			uint8_t b2 = InternalRead(mode, (addr & ~0x03) | 2, addr);
+			uint8_t b3 = InternalRead(mode, addr | 3, addr);
+			value = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
+		}
 		UpdateOpenBus<4>(addr, value);
 		if(!(mode & GbaAccessMode::NoRotate) && (addr & 0x03)) {
 			value = RotateValue(mode, addr, value, isSigned);
@@ -384,6 +392,37 @@ void GbaMemoryManager::Write(GbaAccessModeVal mode, uint32_t addr, uint32_t valu
 	}
 }
 
+uint8_t* GbaMemoryManager::GetFastReadPointer(uint32_t addr)
+{
+	//Returns a pointer to the aligned halfword/word at addr when it is backed by plain memory
+	//(work ram or rom) with no side effects. This covers nearly all opcode fetches and lets the
+	//CPU's pipeline refill skip the per-byte InternalRead calls. Returns nullptr for everything else.
+	switch(addr >> 24) {
+		case 0x02: return _extWorkRam + (addr & (GbaConsole::ExtWorkRamSize - 1));
+		case 0x03: return _intWorkRam + (addr & (GbaConsole::IntWorkRamSize - 1));
+
+		case 0x08:
+			if(addr >= 0x80000C0 && addr < 0x80000D0) {
+				//GPIO registers (RTC, etc.) may be mapped here
+				return nullptr;
+			}
+			[[fallthrough]];
+
+		case 0x09:
+		case 0x0A:
+		case 0x0B:
+		case 0x0C: {
+			uint32_t romAddr = addr & 0x1FFFFFF;
+			if(romAddr + 3 < _prgRomSize) {
+				return _prgRom + romAddr;
+			}
+			return nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
 uint8_t GbaMemoryManager::InternalRead(GbaAccessModeVal mode, uint32_t addr, uint32_t readAddr)
 {
 	uint8_t bank = (addr >> 24);
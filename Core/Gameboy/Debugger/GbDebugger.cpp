@@ -84,6 +84,7 @@ void GbDebugger::Reset()
 	ResetPrevOpCode();
 }
 
+template<uint8_t hooks>
 void GbDebugger::ProcessInstruction()
 {
 	GbCpuState& state = _cpu->GetState();
@@ -95,27 +96,31 @@ void GbDebugger::ProcessInstruction()
 	InstructionProgress.StartCycle = state.CycleCount;
 
 	if(addressInfo.Address >= 0) {
-		if(addressInfo.Type == MemoryType::GbPrgRom) {
-			_codeDataLogger->SetCode(addressInfo.Address, GameboyDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::GbPrgRom) {
+				_codeDataLogger->SetCode(addressInfo.Address, GameboyDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+			}
 		}
 		_disassembler->BuildCache(addressInfo, 0, CpuType::Gameboy);
 	}
 
 	ProcessCallStackUpdates(addressInfo, pc, state.SP);
 
-	if(_settings->CheckDebuggerFlag(DebuggerFlags::GbDebuggerEnabled)) {
-		switch(value) {
-			case 0x40:
-				if(_settings->GetDebugConfig().GbBreakOnNopLoad) {
-					_step->Break(BreakSource::GbNopLoad);
-				}
-				break;
-
-			case 0xD3: case 0xDB: case 0xDD: case 0xE3: case 0xE4: case 0xEB: case 0xEC: case 0xED: case 0xF4: case 0xFC: case 0xFD:
-				if(_settings->GetDebugConfig().GbBreakOnInvalidOpCode) {
-					_step->Break(BreakSource::GbInvalidOpCode);
-				}
-				break;
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		if(_settings->CheckDebuggerFlag(DebuggerFlags::GbDebuggerEnabled)) {
+			switch(value) {
+				case 0x40:
+					if(_settings->GetDebugConfig().GbBreakOnNopLoad) {
+						_step->Break(BreakSource::GbNopLoad);
+					}
+					break;
+
+				case 0xD3: case 0xDB: case 0xDD: case 0xE3: case 0xE4: case 0xEB: case 0xEC: case 0xED: case 0xF4: case 0xFC: case 0xFD:
+					if(_settings->GetDebugConfig().GbBreakOnInvalidOpCode) {
+						_step->Break(BreakSource::GbInvalidOpCode);
+					}
+					break;
+			}
 		}
 	}
 	
@@ -123,23 +128,26 @@ void GbDebugger::ProcessInstruction()
 	_prevProgramCounter = pc;
 	_prevStackPointer = state.SP;
 
-	_step->ProcessCpuExec();
-
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _gameboy->GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(CpuType::Gameboy, _breakpointManager.get(), memOp, absAddr);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
+
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
+			_dummyCpu->SetDummyState(state);
+			_dummyCpu->Exec();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _gameboy->GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Gameboy, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
+template<uint8_t hooks>
 void GbDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _gameboy->GetAbsoluteAddress(addr);
@@ -147,29 +155,41 @@ void GbDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType t
 	InstructionProgress.LastMemOperation = operation;
 
 	if(type == MemoryOperationType::ExecOpCode) {
-		if(_traceLogger->IsEnabled()) {
-			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Gameboy);
-			_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Gameboy);
+				_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
+			}
 		}
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _gameboy->GetMasterClock());
 	} else if(type == MemoryOperationType::ExecOperand) {
-		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::GbPrgRom) {
-			_codeDataLogger->SetCode(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::GbPrgRom) {
+				_codeDataLogger->SetCode(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _gameboy->GetMasterClock());
-		_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	} else {
-		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::GbPrgRom) {
-			_codeDataLogger->SetData(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::GbPrgRom) {
+				_codeDataLogger->SetData(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		if(addr < 0xFE00 || addr >= 0xFF80) {
@@ -180,36 +200,49 @@ void GbDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType t
 					//Only warn the first time
 					_debugger->Log("[GB] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
 				}
-				if(_settings->CheckDebuggerFlag(DebuggerFlags::GbDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				if constexpr(hooks & DebugHookFlags::BreakChecks) {
+					if(_settings->CheckDebuggerFlag(DebuggerFlags::GbDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+						_step->Break(BreakSource::BreakOnUninitMemoryRead);
+					}
 				}
 			}
 		}
 
-		if(addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF)) {
-			_eventManager->AddEvent(DebugEventType::Register, operation);
+		if constexpr(hooks & DebugHookFlags::EventManager) {
+			if(addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF)) {
+				_eventManager->AddEvent(DebugEventType::Register, operation);
+			}
+		}
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 		}
-		_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	}
 }
 
+template<uint8_t hooks>
 void GbDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _gameboy->GetAbsoluteAddress(addr);
 	MemoryOperationInfo operation(addr, value, type, MemoryType::GameboyMemory);
 	InstructionProgress.LastMemOperation = operation;
-	_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 
 	if(addressInfo.Type == MemoryType::GbWorkRam || addressInfo.Type == MemoryType::GbCartRam || addressInfo.Type == MemoryType::GbHighRam) {
 		_disassembler->InvalidateCache(addressInfo, CpuType::Gameboy);
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
-	if(addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF)) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF)) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _gameboy->GetMasterClock());
@@ -487,3 +520,11 @@ void GbDebugger::ProcessInputOverrides(DebugControllerState inputOverrides[8])
 	}
 	controlManager->RefreshHubState();
 }
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void GbDebugger::ProcessInstruction<hooks>(); \
+	template void GbDebugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void GbDebugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
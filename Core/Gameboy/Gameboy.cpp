@@ -154,6 +154,7 @@ void Gameboy::PowerOn(SuperGameboy *sgb)
 
 void Gameboy::Run(uint64_t runUntilClock)
 {
+	_cpu->SetRunLimit(runUntilClock);
 	while(_cpu->GetCycleCount() < runUntilClock) {
 		_cpu->Exec();
 	}
@@ -546,6 +547,7 @@ GameboyModel Gameboy::GetEffectiveModel(GameboyHeader& header)
 void Gameboy::RunFrame()
 {
 	uint32_t frameCount = _ppu->GetFrameCount();
+	_cpu->SetRunLimit(UINT64_MAX);
 	while(frameCount == _ppu->GetFrameCount()) {
 		_cpu->Exec();
 	}
@@ -6,6 +6,7 @@
 #include "Gameboy/GbMemoryManager.h"
 #include "Gameboy/GbControlManager.h"
 #include "Shared/Emulator.h"
+#include "Shared/OpcodeDispatch.h"
 #include "Utilities/Serializer.h"
 
 void GbCpu::Init(Emulator* emu, Gameboy* gameboy, GbMemoryManager* memoryManager)
@@ -106,15 +107,17 @@ void GbCpu::Exec()
 
 	if(_state.HaltCounter) {
 		if(_state.HaltBug) {
+			//ExecOpCode also processes the start of the next cycle
 			ProcessHaltBug();
-		} else {
+			return;
+		}
+
 #ifndef DUMMYCPU
-			_emu->ProcessHaltedCpu<CpuType::Gameboy>();
-			if(_state.HaltCounter > 1) {
-				ProcessCgbSpeedSwitch();
-			}
-#endif
+		_emu->ProcessHaltedCpu<CpuType::Gameboy>();
+		if(_state.HaltCounter > 1) {
+			ProcessCgbSpeedSwitch();
 		}
+#endif
 	} else {
 		if(_state.EiPending) {
 			_state.EiPending = false;
@@ -124,12 +127,42 @@ void GbCpu::Exec()
 #ifndef DUMMYCPU
 		_emu->ProcessInstruction<CpuType::Gameboy>();
 #endif
+		//ExecOpCode also processes the start of the next cycle
 		ExecOpCode(ReadOpCode());
+		return;
 	}
 
 	ProcessNextCycleStart();
 }
 
+void GbCpu::SetRunLimit(uint64_t runUntilClock)
+{
+	_runUntilClock = runUntilClock;
+	_runFrameCount = _ppu->GetFrameCount();
+}
+
+#ifndef DUMMYCPU
+bool GbCpu::ChainNextOpCode(uint8_t& opCode)
+{
+	ProcessNextCycleStart();
+
+	//Return to Exec() for anything it needs to process before the next instruction (IRQs, halt/stop),
+	//and at the end of the frame/run, like the Gameboy::Run/RunFrame loops do
+	if(_state.HaltCounter || _state.Stopped || (_prevIrqVector && _state.IME) || _state.CycleCount >= _runUntilClock || _ppu->GetFrameCount() != _runFrameCount) {
+		return false;
+	}
+
+	if(_state.EiPending) {
+		_state.EiPending = false;
+		_state.IME = true;
+	}
+
+	_emu->ProcessInstruction<CpuType::Gameboy>();
+	opCode = ReadOpCode();
+	return true;
+}
+#endif
+
 void GbCpu::PowerOn()
 {
 	ProcessNextCycleStart();
@@ -186,266 +219,275 @@ void GbCpu::ProcessHaltBug()
 	ExecOpCode(opCode);
 }
 
+#if defined(MESEN_COMPUTED_GOTO) && !defined(DUMMYCPU)
+	//Each handler starts the next instruction itself, until Exec() needs to run again
+	#define OPCODE_CHAIN if(ChainNextOpCode(opCode)) { OPCODE_DISPATCH(opCode); } return
+#else
+	#define OPCODE_CHAIN
+#endif
+
 void GbCpu::ExecOpCode(uint8_t opCode)
 {
-	switch(opCode) {
-		case 0x00: NOP(); break;
-		case 0x01: LD(_regBC, ReadCodeWord()); break;
-		case 0x02: LD_Indirect(_regBC, _state.A); break;
-		case 0x03: INC(_regBC); break;
-		case 0x04: INC(_state.B); break;
-		case 0x05: DEC(_state.B); break;
-		case 0x06: LD(_state.B, ReadCode()); break;
-		case 0x07: RLCA(); break;
-		case 0x08: LD_Indirect16(ReadCodeWord(), _state.SP); break;
-		case 0x09: ADD(_regHL, _regBC); break;
-		case 0x0A: LD(_state.A, Read(_regBC)); break;
-		case 0x0B: DEC(_regBC); break;
-		case 0x0C: INC(_state.C); break;
-		case 0x0D: DEC(_state.C); break;
-		case 0x0E: LD(_state.C, ReadCode()); break;
-		case 0x0F: RRCA(); break;
-		case 0x10: STOP(); break;
-		case 0x11: LD(_regDE, ReadCodeWord()); break;
-		case 0x12: LD_Indirect(_regDE, _state.A); break;
-		case 0x13: INC(_regDE); break;
-		case 0x14: INC(_state.D); break;
-		case 0x15: DEC(_state.D); break;
-		case 0x16: LD(_state.D, ReadCode()); break;
-		case 0x17: RLA(); break;
-		case 0x18: JR(ReadCode()); break;
-		case 0x19: ADD(_regHL, _regDE); break;
-		case 0x1A: LD(_state.A, Read(_regDE)); break;
-		case 0x1B: DEC(_regDE); break;
-		case 0x1C: INC(_state.E); break;
-		case 0x1D: DEC(_state.E); break;
-		case 0x1E: LD(_state.E, ReadCode()); break;
-		case 0x1F: RRA(); break;
-		case 0x20: JR((_state.Flags & GbCpuFlags::Zero) == 0, ReadCode()); break;
-		case 0x21: LD(_regHL, ReadCodeWord()); break;
-		case 0x22: LD_Indirect(_regHL, _state.A); _regHL.Inc(); break;
-		case 0x23: INC(_regHL); break;
-		case 0x24: INC(_state.H); break;
-		case 0x25: DEC(_state.H); break;
-		case 0x26: LD(_state.H, ReadCode()); break;
-		case 0x27: DAA(); break;
-		case 0x28: JR((_state.Flags & GbCpuFlags::Zero) != 0, ReadCode()); break;
-		case 0x29: ADD(_regHL, _regHL); break;
-		case 0x2A: LD(_state.A, Read<GbOamCorruptionType::ReadIncDec>(_regHL)); _regHL.Inc(); break;
-		case 0x2B: DEC(_regHL); break;
-		case 0x2C: INC(_state.L); break;
-		case 0x2D: DEC(_state.L); break;
-		case 0x2E: LD(_state.L, ReadCode()); break;
-		case 0x2F: CPL(); break;
-		case 0x30: JR((_state.Flags & GbCpuFlags::Carry) == 0, ReadCode()); break;
-		case 0x31: LD(_state.SP, ReadCodeWord()); break;
-		case 0x32: LD_Indirect(_regHL, _state.A); _regHL.Dec(); break;
-		case 0x33: INC_SP(); break;
-		case 0x34: INC_Indirect(_regHL); break;
-		case 0x35: DEC_Indirect(_regHL); break;
-		case 0x36: LD_Indirect(_regHL, ReadCode()); break;
-		case 0x37: SCF(); break;
-		case 0x38: JR((_state.Flags & GbCpuFlags::Carry) != 0, ReadCode()); break;
-		case 0x39: ADD(_regHL, _state.SP); break;
-		case 0x3A: LD(_state.A, Read<GbOamCorruptionType::ReadIncDec>(_regHL)); _regHL.Dec(); break;
-		case 0x3B: DEC_SP(); break;
-		case 0x3C: INC(_state.A); break;
-		case 0x3D: DEC(_state.A); break;
-		case 0x3E: LD(_state.A, ReadCode()); break;
-		case 0x3F: CCF(); break;
-		case 0x40: LD(_state.B, _state.B); break;
-		case 0x41: LD(_state.B, _state.C); break;
-		case 0x42: LD(_state.B, _state.D); break;
-		case 0x43: LD(_state.B, _state.E); break;
-		case 0x44: LD(_state.B, _state.H); break;
-		case 0x45: LD(_state.B, _state.L); break;
-		case 0x46: LD(_state.B, Read(_regHL)); break;
-		case 0x47: LD(_state.B, _state.A); break;
-		case 0x48: LD(_state.C, _state.B); break;
-		case 0x49: LD(_state.C, _state.C); break;
-		case 0x4A: LD(_state.C, _state.D); break;
-		case 0x4B: LD(_state.C, _state.E); break;
-		case 0x4C: LD(_state.C, _state.H); break;
-		case 0x4D: LD(_state.C, _state.L); break;
-		case 0x4E: LD(_state.C, Read(_regHL)); break;
-		case 0x4F: LD(_state.C, _state.A); break;
-		case 0x50: LD(_state.D, _state.B); break;
-		case 0x51: LD(_state.D, _state.C); break;
-		case 0x52: LD(_state.D, _state.D); break;
-		case 0x53: LD(_state.D, _state.E); break;
-		case 0x54: LD(_state.D, _state.H); break;
-		case 0x55: LD(_state.D, _state.L); break;
-		case 0x56: LD(_state.D, Read(_regHL)); break;
-		case 0x57: LD(_state.D, _state.A); break;
-		case 0x58: LD(_state.E, _state.B); break;
-		case 0x59: LD(_state.E, _state.C); break;
-		case 0x5A: LD(_state.E, _state.D); break;
-		case 0x5B: LD(_state.E, _state.E); break;
-		case 0x5C: LD(_state.E, _state.H); break;
-		case 0x5D: LD(_state.E, _state.L); break;
-		case 0x5E: LD(_state.E, Read(_regHL)); break;
-		case 0x5F: LD(_state.E, _state.A); break;
-		case 0x60: LD(_state.H, _state.B); break;
-		case 0x61: LD(_state.H, _state.C); break;
-		case 0x62: LD(_state.H, _state.D); break;
-		case 0x63: LD(_state.H, _state.E); break;
-		case 0x64: LD(_state.H, _state.H); break;
-		case 0x65: LD(_state.H, _state.L); break;
-		case 0x66: LD(_state.H, Read(_regHL)); break;
-		case 0x67: LD(_state.H, _state.A); break;
-		case 0x68: LD(_state.L, _state.B); break;
-		case 0x69: LD(_state.L, _state.C); break;
-		case 0x6A: LD(_state.L, _state.D); break;
-		case 0x6B: LD(_state.L, _state.E); break;
-		case 0x6C: LD(_state.L, _state.H); break;
-		case 0x6D: LD(_state.L, _state.L); break;
-		case 0x6E: LD(_state.L, Read(_regHL)); break;
-		case 0x6F: LD(_state.L, _state.A); break;
-		case 0x70: LD_Indirect(_regHL, _state.B); break;
-		case 0x71: LD_Indirect(_regHL, _state.C); break;
-		case 0x72: LD_Indirect(_regHL, _state.D); break;
-		case 0x73: LD_Indirect(_regHL, _state.E); break;
-		case 0x74: LD_Indirect(_regHL, _state.H); break;
-		case 0x75: LD_Indirect(_regHL, _state.L); break;
-		case 0x76: HALT(); break;
-		case 0x77: LD_Indirect(_regHL, _state.A); break;
-		case 0x78: LD(_state.A, _state.B); break;
-		case 0x79: LD(_state.A, _state.C); break;
-		case 0x7A: LD(_state.A, _state.D); break;
-		case 0x7B: LD(_state.A, _state.E); break;
-		case 0x7C: LD(_state.A, _state.H); break;
-		case 0x7D: LD(_state.A, _state.L); break;
-		case 0x7E: LD(_state.A, Read(_regHL)); break;
-		case 0x7F: LD(_state.A, _state.A); break;
-		case 0x80: ADD(_state.B); break;
-		case 0x81: ADD(_state.C); break;
-		case 0x82: ADD(_state.D); break;
-		case 0x83: ADD(_state.E); break;
-		case 0x84: ADD(_state.H); break;
-		case 0x85: ADD(_state.L); break;
-		case 0x86: ADD(Read(_regHL)); break;
-		case 0x87: ADD(_state.A); break;
-		case 0x88: ADC(_state.B); break;
-		case 0x89: ADC(_state.C); break;
-		case 0x8A: ADC(_state.D); break;
-		case 0x8B: ADC(_state.E); break;
-		case 0x8C: ADC(_state.H); break;
-		case 0x8D: ADC(_state.L); break;
-		case 0x8E: ADC(Read(_regHL)); break;
-		case 0x8F: ADC(_state.A); break;
-		case 0x90: SUB(_state.B); break;
-		case 0x91: SUB(_state.C); break;
-		case 0x92: SUB(_state.D); break;
-		case 0x93: SUB(_state.E); break;
-		case 0x94: SUB(_state.H); break;
-		case 0x95: SUB(_state.L); break;
-		case 0x96: SUB(Read(_regHL)); break;
-		case 0x97: SUB(_state.A); break;
-		case 0x98: SBC(_state.B); break;
-		case 0x99: SBC(_state.C); break;
-		case 0x9A: SBC(_state.D); break;
-		case 0x9B: SBC(_state.E); break;
-		case 0x9C: SBC(_state.H); break;
-		case 0x9D: SBC(_state.L); break;
-		case 0x9E: SBC(Read(_regHL)); break;
-		case 0x9F: SBC(_state.A); break;
-		case 0xA0: AND(_state.B); break;
-		case 0xA1: AND(_state.C); break;
-		case 0xA2: AND(_state.D); break;
-		case 0xA3: AND(_state.E); break;
-		case 0xA4: AND(_state.H); break;
-		case 0xA5: AND(_state.L); break;
-		case 0xA6: AND(Read(_regHL)); break;
-		case 0xA7: AND(_state.A); break;
-		case 0xA8: XOR(_state.B); break;
-		case 0xA9: XOR(_state.C); break;
-		case 0xAA: XOR(_state.D); break;
-		case 0xAB: XOR(_state.E); break;
-		case 0xAC: XOR(_state.H); break;
-		case 0xAD: XOR(_state.L); break;
-		case 0xAE: XOR(Read(_regHL)); break;
-		case 0xAF: XOR(_state.A); break;
-		case 0xB0: OR(_state.B); break;
-		case 0xB1: OR(_state.C); break;
-		case 0xB2: OR(_state.D); break;
-		case 0xB3: OR(_state.E); break;
-		case 0xB4: OR(_state.H); break;
-		case 0xB5: OR(_state.L); break;
-		case 0xB6: OR(Read(_regHL)); break;
-		case 0xB7: OR(_state.A); break;
-		case 0xB8: CP(_state.B); break;
-		case 0xB9: CP(_state.C); break;
-		case 0xBA: CP(_state.D); break;
-		case 0xBB: CP(_state.E); break;
-		case 0xBC: CP(_state.H); break;
-		case 0xBD: CP(_state.L); break;
-		case 0xBE: CP(Read(_regHL)); break;
-		case 0xBF: CP(_state.A); break;
-		case 0xC0: RET((_state.Flags & GbCpuFlags::Zero) == 0); break;
-		case 0xC1: POP(_regBC); break;
-		case 0xC2: JP((_state.Flags & GbCpuFlags::Zero) == 0, ReadCodeWord()); break;
-		case 0xC3: JP(ReadCodeWord()); break;
-		case 0xC4: CALL((_state.Flags & GbCpuFlags::Zero) == 0, ReadCodeWord()); break;
-		case 0xC5: PUSH(_regBC); break;
-		case 0xC6: ADD(ReadCode()); break;
-		case 0xC7: RST(0x00); break;
-		case 0xC8: RET((_state.Flags & GbCpuFlags::Zero) != 0); break;
-		case 0xC9: RET(); break;
-		case 0xCA: JP((_state.Flags & GbCpuFlags::Zero) != 0, ReadCodeWord()); break;
-		case 0xCB: PREFIX(); break;
-		case 0xCC: CALL((_state.Flags & GbCpuFlags::Zero) != 0, ReadCodeWord()); break;
-		case 0xCD: CALL(ReadCodeWord()); break;
-		case 0xCE: ADC(ReadCode()); break;
-		case 0xCF: RST(0x08); break;
-		case 0xD0: RET((_state.Flags & GbCpuFlags::Carry) == 0); break;
-		case 0xD1: POP(_regDE); break;
-		case 0xD2: JP((_state.Flags & GbCpuFlags::Carry) == 0, ReadCodeWord()); break;
-		case 0xD3: InvalidOp(); break;
-		case 0xD4: CALL((_state.Flags & GbCpuFlags::Carry) == 0, ReadCodeWord()); break;
-		case 0xD5: PUSH(_regDE); break;
-		case 0xD6: SUB(ReadCode()); break;
-		case 0xD7: RST(0x10); break;
-		case 0xD8: RET((_state.Flags & GbCpuFlags::Carry) != 0); break;
-		case 0xD9: RETI(); break;
-		case 0xDA: JP((_state.Flags & GbCpuFlags::Carry) != 0, ReadCodeWord()); break;
-		case 0xDB: InvalidOp(); break;
-		case 0xDC: CALL((_state.Flags & GbCpuFlags::Carry) != 0, ReadCodeWord()); break;
-		case 0xDD: InvalidOp(); break;
-		case 0xDE: SBC(ReadCode()); break;
-		case 0xDF: RST(0x18); break;
-		case 0xE0: LD_Indirect(0xFF00 | ReadCode(), _state.A); break;
-		case 0xE1: POP(_regHL); break;
-		case 0xE2: LD_Indirect(0xFF00 | _state.C, _state.A); break;
-		case 0xE3: InvalidOp(); break;
-		case 0xE4: InvalidOp(); break;
-		case 0xE5: PUSH(_regHL); break;
-		case 0xE6: AND(ReadCode()); break;
-		case 0xE7: RST(0x20); break;
-		case 0xE8: ADD_SP(ReadCode()); break;
-		case 0xE9: JP_HL(); break;
-		case 0xEA: LD_Indirect(ReadCodeWord(), _state.A); break;
-		case 0xEB: InvalidOp(); break;
-		case 0xEC: InvalidOp(); break;
-		case 0xED: InvalidOp(); break;
-		case 0xEE: XOR(ReadCode()); break;
-		case 0xEF: RST(0x28); break;
-		case 0xF0: LD(_state.A, Read(0xFF00 | ReadCode())); break;
-		case 0xF1: POP_AF(); break;
-		case 0xF2: LD(_state.A, Read(0xFF00 | _state.C)); break;
-		case 0xF3: DI(); break;
-		case 0xF4: InvalidOp(); break;
-		case 0xF5: PUSH(_regAF); break;
-		case 0xF6: OR(ReadCode()); break;
-		case 0xF7: RST(0x30); break;
-		case 0xF8: LD_HL(ReadCode()); break;
-		case 0xF9: LD(_state.SP, _regHL); ExecCpuCycle(); break;
-		case 0xFA: LD(_state.A, Read(ReadCodeWord())); break;
-		case 0xFB: EI(); break;
-		case 0xFC: InvalidOp(); break;
-		case 0xFD: InvalidOp(); break;
-		case 0xFE: CP(ReadCode()); break;
-		case 0xFF: RST(0x38); break;
-	}
+	OPCODE_SWITCH(opCode) {
+		OPCODE_CASE(0x00): NOP(); OPCODE_NEXT;
+		OPCODE_CASE(0x01): LD(_regBC, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0x02): LD_Indirect(_regBC, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x03): INC(_regBC); OPCODE_NEXT;
+		OPCODE_CASE(0x04): INC(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x05): DEC(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x06): LD(_state.B, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x07): RLCA(); OPCODE_NEXT;
+		OPCODE_CASE(0x08): LD_Indirect16(ReadCodeWord(), _state.SP); OPCODE_NEXT;
+		OPCODE_CASE(0x09): ADD(_regHL, _regBC); OPCODE_NEXT;
+		OPCODE_CASE(0x0A): LD(_state.A, Read(_regBC)); OPCODE_NEXT;
+		OPCODE_CASE(0x0B): DEC(_regBC); OPCODE_NEXT;
+		OPCODE_CASE(0x0C): INC(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x0D): DEC(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x0E): LD(_state.C, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x0F): RRCA(); OPCODE_NEXT;
+		OPCODE_CASE(0x10): STOP(); OPCODE_NEXT;
+		OPCODE_CASE(0x11): LD(_regDE, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0x12): LD_Indirect(_regDE, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x13): INC(_regDE); OPCODE_NEXT;
+		OPCODE_CASE(0x14): INC(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x15): DEC(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x16): LD(_state.D, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x17): RLA(); OPCODE_NEXT;
+		OPCODE_CASE(0x18): JR(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x19): ADD(_regHL, _regDE); OPCODE_NEXT;
+		OPCODE_CASE(0x1A): LD(_state.A, Read(_regDE)); OPCODE_NEXT;
+		OPCODE_CASE(0x1B): DEC(_regDE); OPCODE_NEXT;
+		OPCODE_CASE(0x1C): INC(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x1D): DEC(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x1E): LD(_state.E, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x1F): RRA(); OPCODE_NEXT;
+		OPCODE_CASE(0x20): JR((_state.Flags & GbCpuFlags::Zero) == 0, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x21): LD(_regHL, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0x22): LD_Indirect(_regHL, _state.A); _regHL.Inc(); OPCODE_NEXT;
+		OPCODE_CASE(0x23): INC(_regHL); OPCODE_NEXT;
+		OPCODE_CASE(0x24): INC(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x25): DEC(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x26): LD(_state.H, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x27): DAA(); OPCODE_NEXT;
+		OPCODE_CASE(0x28): JR((_state.Flags & GbCpuFlags::Zero) != 0, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x29): ADD(_regHL, _regHL); OPCODE_NEXT;
+		OPCODE_CASE(0x2A): LD(_state.A, Read<GbOamCorruptionType::ReadIncDec>(_regHL)); _regHL.Inc(); OPCODE_NEXT;
+		OPCODE_CASE(0x2B): DEC(_regHL); OPCODE_NEXT;
+		OPCODE_CASE(0x2C): INC(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x2D): DEC(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x2E): LD(_state.L, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x2F): CPL(); OPCODE_NEXT;
+		OPCODE_CASE(0x30): JR((_state.Flags & GbCpuFlags::Carry) == 0, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x31): LD(_state.SP, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0x32): LD_Indirect(_regHL, _state.A); _regHL.Dec(); OPCODE_NEXT;
+		OPCODE_CASE(0x33): INC_SP(); OPCODE_NEXT;
+		OPCODE_CASE(0x34): INC_Indirect(_regHL); OPCODE_NEXT;
+		OPCODE_CASE(0x35): DEC_Indirect(_regHL); OPCODE_NEXT;
+		OPCODE_CASE(0x36): LD_Indirect(_regHL, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x37): SCF(); OPCODE_NEXT;
+		OPCODE_CASE(0x38): JR((_state.Flags & GbCpuFlags::Carry) != 0, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x39): ADD(_regHL, _state.SP); OPCODE_NEXT;
+		OPCODE_CASE(0x3A): LD(_state.A, Read<GbOamCorruptionType::ReadIncDec>(_regHL)); _regHL.Dec(); OPCODE_NEXT;
+		OPCODE_CASE(0x3B): DEC_SP(); OPCODE_NEXT;
+		OPCODE_CASE(0x3C): INC(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x3D): DEC(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x3E): LD(_state.A, ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0x3F): CCF(); OPCODE_NEXT;
+		OPCODE_CASE(0x40): LD(_state.B, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x41): LD(_state.B, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x42): LD(_state.B, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x43): LD(_state.B, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x44): LD(_state.B, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x45): LD(_state.B, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x46): LD(_state.B, Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x47): LD(_state.B, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x48): LD(_state.C, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x49): LD(_state.C, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x4A): LD(_state.C, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x4B): LD(_state.C, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x4C): LD(_state.C, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x4D): LD(_state.C, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x4E): LD(_state.C, Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x4F): LD(_state.C, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x50): LD(_state.D, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x51): LD(_state.D, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x52): LD(_state.D, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x53): LD(_state.D, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x54): LD(_state.D, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x55): LD(_state.D, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x56): LD(_state.D, Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x57): LD(_state.D, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x58): LD(_state.E, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x59): LD(_state.E, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x5A): LD(_state.E, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x5B): LD(_state.E, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x5C): LD(_state.E, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x5D): LD(_state.E, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x5E): LD(_state.E, Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x5F): LD(_state.E, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x60): LD(_state.H, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x61): LD(_state.H, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x62): LD(_state.H, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x63): LD(_state.H, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x64): LD(_state.H, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x65): LD(_state.H, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x66): LD(_state.H, Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x67): LD(_state.H, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x68): LD(_state.L, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x69): LD(_state.L, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x6A): LD(_state.L, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x6B): LD(_state.L, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x6C): LD(_state.L, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x6D): LD(_state.L, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x6E): LD(_state.L, Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x6F): LD(_state.L, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x70): LD_Indirect(_regHL, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x71): LD_Indirect(_regHL, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x72): LD_Indirect(_regHL, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x73): LD_Indirect(_regHL, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x74): LD_Indirect(_regHL, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x75): LD_Indirect(_regHL, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x76): HALT(); OPCODE_NEXT;
+		OPCODE_CASE(0x77): LD_Indirect(_regHL, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x78): LD(_state.A, _state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x79): LD(_state.A, _state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x7A): LD(_state.A, _state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x7B): LD(_state.A, _state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x7C): LD(_state.A, _state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x7D): LD(_state.A, _state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x7E): LD(_state.A, Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x7F): LD(_state.A, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x80): ADD(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x81): ADD(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x82): ADD(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x83): ADD(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x84): ADD(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x85): ADD(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x86): ADD(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x87): ADD(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x88): ADC(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x89): ADC(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x8A): ADC(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x8B): ADC(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x8C): ADC(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x8D): ADC(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x8E): ADC(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x8F): ADC(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x90): SUB(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x91): SUB(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x92): SUB(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x93): SUB(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x94): SUB(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x95): SUB(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x96): SUB(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x97): SUB(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0x98): SBC(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0x99): SBC(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0x9A): SBC(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0x9B): SBC(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0x9C): SBC(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0x9D): SBC(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0x9E): SBC(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0x9F): SBC(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xA0): AND(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0xA1): AND(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0xA2): AND(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0xA3): AND(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0xA4): AND(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0xA5): AND(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0xA6): AND(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0xA7): AND(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xA8): XOR(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0xA9): XOR(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0xAA): XOR(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0xAB): XOR(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0xAC): XOR(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0xAD): XOR(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0xAE): XOR(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0xAF): XOR(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xB0): OR(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0xB1): OR(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0xB2): OR(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0xB3): OR(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0xB4): OR(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0xB5): OR(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0xB6): OR(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0xB7): OR(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xB8): CP(_state.B); OPCODE_NEXT;
+		OPCODE_CASE(0xB9): CP(_state.C); OPCODE_NEXT;
+		OPCODE_CASE(0xBA): CP(_state.D); OPCODE_NEXT;
+		OPCODE_CASE(0xBB): CP(_state.E); OPCODE_NEXT;
+		OPCODE_CASE(0xBC): CP(_state.H); OPCODE_NEXT;
+		OPCODE_CASE(0xBD): CP(_state.L); OPCODE_NEXT;
+		OPCODE_CASE(0xBE): CP(Read(_regHL)); OPCODE_NEXT;
+		OPCODE_CASE(0xBF): CP(_state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xC0): RET((_state.Flags & GbCpuFlags::Zero) == 0); OPCODE_NEXT;
+		OPCODE_CASE(0xC1): POP(_regBC); OPCODE_NEXT;
+		OPCODE_CASE(0xC2): JP((_state.Flags & GbCpuFlags::Zero) == 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xC3): JP(ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xC4): CALL((_state.Flags & GbCpuFlags::Zero) == 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xC5): PUSH(_regBC); OPCODE_NEXT;
+		OPCODE_CASE(0xC6): ADD(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xC7): RST(0x00); OPCODE_NEXT;
+		OPCODE_CASE(0xC8): RET((_state.Flags & GbCpuFlags::Zero) != 0); OPCODE_NEXT;
+		OPCODE_CASE(0xC9): RET(); OPCODE_NEXT;
+		OPCODE_CASE(0xCA): JP((_state.Flags & GbCpuFlags::Zero) != 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xCB): PREFIX(); OPCODE_NEXT;
+		OPCODE_CASE(0xCC): CALL((_state.Flags & GbCpuFlags::Zero) != 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xCD): CALL(ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xCE): ADC(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xCF): RST(0x08); OPCODE_NEXT;
+		OPCODE_CASE(0xD0): RET((_state.Flags & GbCpuFlags::Carry) == 0); OPCODE_NEXT;
+		OPCODE_CASE(0xD1): POP(_regDE); OPCODE_NEXT;
+		OPCODE_CASE(0xD2): JP((_state.Flags & GbCpuFlags::Carry) == 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xD3): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xD4): CALL((_state.Flags & GbCpuFlags::Carry) == 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xD5): PUSH(_regDE); OPCODE_NEXT;
+		OPCODE_CASE(0xD6): SUB(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xD7): RST(0x10); OPCODE_NEXT;
+		OPCODE_CASE(0xD8): RET((_state.Flags & GbCpuFlags::Carry) != 0); OPCODE_NEXT;
+		OPCODE_CASE(0xD9): RETI(); OPCODE_NEXT;
+		OPCODE_CASE(0xDA): JP((_state.Flags & GbCpuFlags::Carry) != 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xDB): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xDC): CALL((_state.Flags & GbCpuFlags::Carry) != 0, ReadCodeWord()); OPCODE_NEXT;
+		OPCODE_CASE(0xDD): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xDE): SBC(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xDF): RST(0x18); OPCODE_NEXT;
+		OPCODE_CASE(0xE0): LD_Indirect(0xFF00 | ReadCode(), _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xE1): POP(_regHL); OPCODE_NEXT;
+		OPCODE_CASE(0xE2): LD_Indirect(0xFF00 | _state.C, _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xE3): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xE4): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xE5): PUSH(_regHL); OPCODE_NEXT;
+		OPCODE_CASE(0xE6): AND(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xE7): RST(0x20); OPCODE_NEXT;
+		OPCODE_CASE(0xE8): ADD_SP(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xE9): JP_HL(); OPCODE_NEXT;
+		OPCODE_CASE(0xEA): LD_Indirect(ReadCodeWord(), _state.A); OPCODE_NEXT;
+		OPCODE_CASE(0xEB): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xEC): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xED): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xEE): XOR(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xEF): RST(0x28); OPCODE_NEXT;
+		OPCODE_CASE(0xF0): LD(_state.A, Read(0xFF00 | ReadCode())); OPCODE_NEXT;
+		OPCODE_CASE(0xF1): POP_AF(); OPCODE_NEXT;
+		OPCODE_CASE(0xF2): LD(_state.A, Read(0xFF00 | _state.C)); OPCODE_NEXT;
+		OPCODE_CASE(0xF3): DI(); OPCODE_NEXT;
+		OPCODE_CASE(0xF4): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xF5): PUSH(_regAF); OPCODE_NEXT;
+		OPCODE_CASE(0xF6): OR(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xF7): RST(0x30); OPCODE_NEXT;
+		OPCODE_CASE(0xF8): LD_HL(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xF9): LD(_state.SP, _regHL); ExecCpuCycle(); OPCODE_NEXT;
+		OPCODE_CASE(0xFA): LD(_state.A, Read(ReadCodeWord())); OPCODE_NEXT;
+		OPCODE_CASE(0xFB): EI(); OPCODE_NEXT;
+		OPCODE_CASE(0xFC): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xFD): InvalidOp(); OPCODE_NEXT;
+		OPCODE_CASE(0xFE): CP(ReadCode()); OPCODE_NEXT;
+		OPCODE_CASE(0xFF): RST(0x38); OPCODE_NEXT;
+	} OPCODE_SWITCH_END;
+
+	ProcessNextCycleStart();
 }
 
 void GbCpu::ProcessCgbSpeedSwitch()
@@ -1278,264 +1320,264 @@ void GbCpu::DI()
 
 void GbCpu::PREFIX()
 {
-	switch(ReadCode()) {
-		case 0x00: RLC(_state.B); break;
-		case 0x01: RLC(_state.C); break;
-		case 0x02: RLC(_state.D); break;
-		case 0x03: RLC(_state.E); break;
-		case 0x04: RLC(_state.H); break;
-		case 0x05: RLC(_state.L); break;
-		case 0x06: RLC_Indirect(_regHL); break;
-		case 0x07: RLC(_state.A); break;
-		case 0x08: RRC(_state.B); break;
-		case 0x09: RRC(_state.C); break;
-		case 0x0A: RRC(_state.D); break;
-		case 0x0B: RRC(_state.E); break;
-		case 0x0C: RRC(_state.H); break;
-		case 0x0D: RRC(_state.L); break;
-		case 0x0E: RRC_Indirect(_regHL); break;
-		case 0x0F: RRC(_state.A); break;
-		case 0x10: RL(_state.B); break;
-		case 0x11: RL(_state.C); break;
-		case 0x12: RL(_state.D); break;
-		case 0x13: RL(_state.E); break;
-		case 0x14: RL(_state.H); break;
-		case 0x15: RL(_state.L); break;
-		case 0x16: RL_Indirect(_regHL); break;
-		case 0x17: RL(_state.A); break;
-		case 0x18: RR(_state.B); break;
-		case 0x19: RR(_state.C); break;
-		case 0x1A: RR(_state.D); break;
-		case 0x1B: RR(_state.E); break;
-		case 0x1C: RR(_state.H); break;
-		case 0x1D: RR(_state.L); break;
-		case 0x1E: RR_Indirect(_regHL); break;
-		case 0x1F: RR(_state.A); break;
-		case 0x20: SLA(_state.B); break;
-		case 0x21: SLA(_state.C); break;
-		case 0x22: SLA(_state.D); break;
-		case 0x23: SLA(_state.E); break;
-		case 0x24: SLA(_state.H); break;
-		case 0x25: SLA(_state.L); break;
-		case 0x26: SLA_Indirect(_regHL); break;
-		case 0x27: SLA(_state.A); break;
-		case 0x28: SRA(_state.B); break;
-		case 0x29: SRA(_state.C); break;
-		case 0x2A: SRA(_state.D); break;
-		case 0x2B: SRA(_state.E); break;
-		case 0x2C: SRA(_state.H); break;
-		case 0x2D: SRA(_state.L); break;
-		case 0x2E: SRA_Indirect(_regHL); break;
-		case 0x2F: SRA(_state.A); break;
-		case 0x30: SWAP(_state.B); break;
-		case 0x31: SWAP(_state.C); break;
-		case 0x32: SWAP(_state.D); break;
-		case 0x33: SWAP(_state.E); break;
-		case 0x34: SWAP(_state.H); break;
-		case 0x35: SWAP(_state.L); break;
-		case 0x36: SWAP_Indirect(_regHL); break;
-		case 0x37: SWAP(_state.A); break;
-		case 0x38: SRL(_state.B); break;
-		case 0x39: SRL(_state.C); break;
-		case 0x3A: SRL(_state.D); break;
-		case 0x3B: SRL(_state.E); break;
-		case 0x3C: SRL(_state.H); break;
-		case 0x3D: SRL(_state.L); break;
-		case 0x3E: SRL_Indirect(_regHL); break;
-		case 0x3F: SRL(_state.A); break;
-		case 0x40: BIT<0>(_state.B); break;
-		case 0x41: BIT<0>(_state.C); break;
-		case 0x42: BIT<0>(_state.D); break;
-		case 0x43: BIT<0>(_state.E); break;
-		case 0x44: BIT<0>(_state.H); break;
-		case 0x45: BIT<0>(_state.L); break;
-		case 0x46: BIT<0>(Read(_regHL)); break;
-		case 0x47: BIT<0>(_state.A); break;
-		case 0x48: BIT<1>(_state.B); break;
-		case 0x49: BIT<1>(_state.C); break;
-		case 0x4A: BIT<1>(_state.D); break;
-		case 0x4B: BIT<1>(_state.E); break;
-		case 0x4C: BIT<1>(_state.H); break;
-		case 0x4D: BIT<1>(_state.L); break;
-		case 0x4E: BIT<1>(Read(_regHL)); break;
-		case 0x4F: BIT<1>(_state.A); break;
-		case 0x50: BIT<2>(_state.B); break;
-		case 0x51: BIT<2>(_state.C); break;
-		case 0x52: BIT<2>(_state.D); break;
-		case 0x53: BIT<2>(_state.E); break;
-		case 0x54: BIT<2>(_state.H); break;
-		case 0x55: BIT<2>(_state.L); break;
-		case 0x56: BIT<2>(Read(_regHL)); break;
-		case 0x57: BIT<2>(_state.A); break;
-		case 0x58: BIT<3>(_state.B); break;
-		case 0x59: BIT<3>(_state.C); break;
-		case 0x5A: BIT<3>(_state.D); break;
-		case 0x5B: BIT<3>(_state.E); break;
-		case 0x5C: BIT<3>(_state.H); break;
-		case 0x5D: BIT<3>(_state.L); break;
-		case 0x5E: BIT<3>(Read(_regHL)); break;
-		case 0x5F: BIT<3>(_state.A); break;
-		case 0x60: BIT<4>(_state.B); break;
-		case 0x61: BIT<4>(_state.C); break;
-		case 0x62: BIT<4>(_state.D); break;
-		case 0x63: BIT<4>(_state.E); break;
-		case 0x64: BIT<4>(_state.H); break;
-		case 0x65: BIT<4>(_state.L); break;
-		case 0x66: BIT<4>(Read(_regHL)); break;
-		case 0x67: BIT<4>(_state.A); break;
-		case 0x68: BIT<5>(_state.B); break;
-		case 0x69: BIT<5>(_state.C); break;
-		case 0x6A: BIT<5>(_state.D); break;
-		case 0x6B: BIT<5>(_state.E); break;
-		case 0x6C: BIT<5>(_state.H); break;
-		case 0x6D: BIT<5>(_state.L); break;
-		case 0x6E: BIT<5>(Read(_regHL)); break;
-		case 0x6F: BIT<5>(_state.A); break;
-		case 0x70: BIT<6>(_state.B); break;
-		case 0x71: BIT<6>(_state.C); break;
-		case 0x72: BIT<6>(_state.D); break;
-		case 0x73: BIT<6>(_state.E); break;
-		case 0x74: BIT<6>(_state.H); break;
-		case 0x75: BIT<6>(_state.L); break;
-		case 0x76: BIT<6>(Read(_regHL)); break;
-		case 0x77: BIT<6>(_state.A); break;
-		case 0x78: BIT<7>(_state.B); break;
-		case 0x79: BIT<7>(_state.C); break;
-		case 0x7A: BIT<7>(_state.D); break;
-		case 0x7B: BIT<7>(_state.E); break;
-		case 0x7C: BIT<7>(_state.H); break;
-		case 0x7D: BIT<7>(_state.L); break;
-		case 0x7E: BIT<7>(Read(_regHL)); break;
-		case 0x7F: BIT<7>(_state.A); break;
-		case 0x80: RES<0>(_state.B); break;
-		case 0x81: RES<0>(_state.C); break;
-		case 0x82: RES<0>(_state.D); break;
-		case 0x83: RES<0>(_state.E); break;
-		case 0x84: RES<0>(_state.H); break;
-		case 0x85: RES<0>(_state.L); break;
-		case 0x86: RES_Indirect<0>(_regHL); break;
-		case 0x87: RES<0>(_state.A); break;
-		case 0x88: RES<1>(_state.B); break;
-		case 0x89: RES<1>(_state.C); break;
-		case 0x8A: RES<1>(_state.D); break;
-		case 0x8B: RES<1>(_state.E); break;
-		case 0x8C: RES<1>(_state.H); break;
-		case 0x8D: RES<1>(_state.L); break;
-		case 0x8E: RES_Indirect<1>(_regHL); break;
-		case 0x8F: RES<1>(_state.A); break;
-		case 0x90: RES<2>(_state.B); break;
-		case 0x91: RES<2>(_state.C); break;
-		case 0x92: RES<2>(_state.D); break;
-		case 0x93: RES<2>(_state.E); break;
-		case 0x94: RES<2>(_state.H); break;
-		case 0x95: RES<2>(_state.L); break;
-		case 0x96: RES_Indirect<2>(_regHL); break;
-		case 0x97: RES<2>(_state.A); break;
-		case 0x98: RES<3>(_state.B); break;
-		case 0x99: RES<3>(_state.C); break;
-		case 0x9A: RES<3>(_state.D); break;
-		case 0x9B: RES<3>(_state.E); break;
-		case 0x9C: RES<3>(_state.H); break;
-		case 0x9D: RES<3>(_state.L); break;
-		case 0x9E: RES_Indirect<3>(_regHL); break;
-		case 0x9F: RES<3>(_state.A); break;
-		case 0xA0: RES<4>(_state.B); break;
-		case 0xA1: RES<4>(_state.C); break;
-		case 0xA2: RES<4>(_state.D); break;
-		case 0xA3: RES<4>(_state.E); break;
-		case 0xA4: RES<4>(_state.H); break;
-		case 0xA5: RES<4>(_state.L); break;
-		case 0xA6: RES_Indirect<4>(_regHL); break;
-		case 0xA7: RES<4>(_state.A); break;
-		case 0xA8: RES<5>(_state.B); break;
-		case 0xA9: RES<5>(_state.C); break;
-		case 0xAA: RES<5>(_state.D); break;
-		case 0xAB: RES<5>(_state.E); break;
-		case 0xAC: RES<5>(_state.H); break;
-		case 0xAD: RES<5>(_state.L); break;
-		case 0xAE: RES_Indirect<5>(_regHL); break;
-		case 0xAF: RES<5>(_state.A); break;
-		case 0xB0: RES<6>(_state.B); break;
-		case 0xB1: RES<6>(_state.C); break;
-		case 0xB2: RES<6>(_state.D); break;
-		case 0xB3: RES<6>(_state.E); break;
-		case 0xB4: RES<6>(_state.H); break;
-		case 0xB5: RES<6>(_state.L); break;
-		case 0xB6: RES_Indirect<6>(_regHL); break;
-		case 0xB7: RES<6>(_state.A); break;
-		case 0xB8: RES<7>(_state.B); break;
-		case 0xB9: RES<7>(_state.C); break;
-		case 0xBA: RES<7>(_state.D); break;
-		case 0xBB: RES<7>(_state.E); break;
-		case 0xBC: RES<7>(_state.H); break;
-		case 0xBD: RES<7>(_state.L); break;
-		case 0xBE: RES_Indirect<7>(_regHL); break;
-		case 0xBF: RES<7>(_state.A); break;
-		case 0xC0: SET<0>(_state.B); break;
-		case 0xC1: SET<0>(_state.C); break;
-		case 0xC2: SET<0>(_state.D); break;
-		case 0xC3: SET<0>(_state.E); break;
-		case 0xC4: SET<0>(_state.H); break;
-		case 0xC5: SET<0>(_state.L); break;
-		case 0xC6: SET_Indirect<0>(_regHL); break;
-		case 0xC7: SET<0>(_state.A); break;
-		case 0xC8: SET<1>(_state.B); break;
-		case 0xC9: SET<1>(_state.C); break;
-		case 0xCA: SET<1>(_state.D); break;
-		case 0xCB: SET<1>(_state.E); break;
-		case 0xCC: SET<1>(_state.H); break;
-		case 0xCD: SET<1>(_state.L); break;
-		case 0xCE: SET_Indirect<1>(_regHL); break;
-		case 0xCF: SET<1>(_state.A); break;
-		case 0xD0: SET<2>(_state.B); break;
-		case 0xD1: SET<2>(_state.C); break;
-		case 0xD2: SET<2>(_state.D); break;
-		case 0xD3: SET<2>(_state.E); break;
-		case 0xD4: SET<2>(_state.H); break;
-		case 0xD5: SET<2>(_state.L); break;
-		case 0xD6: SET_Indirect<2>(_regHL); break;
-		case 0xD7: SET<2>(_state.A); break;
-		case 0xD8: SET<3>(_state.B); break;
-		case 0xD9: SET<3>(_state.C); break;
-		case 0xDA: SET<3>(_state.D); break;
-		case 0xDB: SET<3>(_state.E); break;
-		case 0xDC: SET<3>(_state.H); break;
-		case 0xDD: SET<3>(_state.L); break;
-		case 0xDE: SET_Indirect<3>(_regHL); break;
-		case 0xDF: SET<3>(_state.A); break;
-		case 0xE0: SET<4>(_state.B); break;
-		case 0xE1: SET<4>(_state.C); break;
-		case 0xE2: SET<4>(_state.D); break;
-		case 0xE3: SET<4>(_state.E); break;
-		case 0xE4: SET<4>(_state.H); break;
-		case 0xE5: SET<4>(_state.L); break;
-		case 0xE6: SET_Indirect<4>(_regHL); break;
-		case 0xE7: SET<4>(_state.A); break;
-		case 0xE8: SET<5>(_state.B); break;
-		case 0xE9: SET<5>(_state.C); break;
-		case 0xEA: SET<5>(_state.D); break;
-		case 0xEB: SET<5>(_state.E); break;
-		case 0xEC: SET<5>(_state.H); break;
-		case 0xED: SET<5>(_state.L); break;
-		case 0xEE: SET_Indirect<5>(_regHL); break;
-		case 0xEF: SET<5>(_state.A); break;
-		case 0xF0: SET<6>(_state.B); break;
-		case 0xF1: SET<6>(_state.C); break;
-		case 0xF2: SET<6>(_state.D); break;
-		case 0xF3: SET<6>(_state.E); break;
-		case 0xF4: SET<6>(_state.H); break;
-		case 0xF5: SET<6>(_state.L); break;
-		case 0xF6: SET_Indirect<6>(_regHL); break;
-		case 0xF7: SET<6>(_state.A); break;
-		case 0xF8: SET<7>(_state.B); break;
-		case 0xF9: SET<7>(_state.C); break;
-		case 0xFA: SET<7>(_state.D); break;
-		case 0xFB: SET<7>(_state.E); break;
-		case 0xFC: SET<7>(_state.H); break;
-		case 0xFD: SET<7>(_state.L); break;
-		case 0xFE: SET_Indirect<7>(_regHL); break;
-		case 0xFF: SET<7>(_state.A); break;
-	}
+	OPCODE_SWITCH(ReadCode()) {
+		OPCODE_CASE(0x00): RLC(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x01): RLC(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x02): RLC(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x03): RLC(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x04): RLC(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x05): RLC(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x06): RLC_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x07): RLC(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x08): RRC(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x09): RRC(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x0A): RRC(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x0B): RRC(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x0C): RRC(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x0D): RRC(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x0E): RRC_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x0F): RRC(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x10): RL(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x11): RL(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x12): RL(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x13): RL(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x14): RL(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x15): RL(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x16): RL_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x17): RL(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x18): RR(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x19): RR(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x1A): RR(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x1B): RR(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x1C): RR(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x1D): RR(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x1E): RR_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x1F): RR(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x20): SLA(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x21): SLA(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x22): SLA(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x23): SLA(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x24): SLA(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x25): SLA(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x26): SLA_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x27): SLA(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x28): SRA(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x29): SRA(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x2A): SRA(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x2B): SRA(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x2C): SRA(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x2D): SRA(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x2E): SRA_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x2F): SRA(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x30): SWAP(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x31): SWAP(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x32): SWAP(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x33): SWAP(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x34): SWAP(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x35): SWAP(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x36): SWAP_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x37): SWAP(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x38): SRL(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x39): SRL(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x3A): SRL(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x3B): SRL(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x3C): SRL(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x3D): SRL(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x3E): SRL_Indirect(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x3F): SRL(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x40): BIT<0>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x41): BIT<0>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x42): BIT<0>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x43): BIT<0>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x44): BIT<0>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x45): BIT<0>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x46): BIT<0>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x47): BIT<0>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x48): BIT<1>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x49): BIT<1>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x4A): BIT<1>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x4B): BIT<1>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x4C): BIT<1>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x4D): BIT<1>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x4E): BIT<1>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x4F): BIT<1>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x50): BIT<2>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x51): BIT<2>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x52): BIT<2>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x53): BIT<2>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x54): BIT<2>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x55): BIT<2>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x56): BIT<2>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x57): BIT<2>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x58): BIT<3>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x59): BIT<3>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x5A): BIT<3>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x5B): BIT<3>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x5C): BIT<3>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x5D): BIT<3>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x5E): BIT<3>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x5F): BIT<3>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x60): BIT<4>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x61): BIT<4>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x62): BIT<4>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x63): BIT<4>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x64): BIT<4>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x65): BIT<4>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x66): BIT<4>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x67): BIT<4>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x68): BIT<5>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x69): BIT<5>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x6A): BIT<5>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x6B): BIT<5>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x6C): BIT<5>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x6D): BIT<5>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x6E): BIT<5>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x6F): BIT<5>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x70): BIT<6>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x71): BIT<6>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x72): BIT<6>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x73): BIT<6>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x74): BIT<6>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x75): BIT<6>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x76): BIT<6>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x77): BIT<6>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x78): BIT<7>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x79): BIT<7>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x7A): BIT<7>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x7B): BIT<7>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x7C): BIT<7>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x7D): BIT<7>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x7E): BIT<7>(Read(_regHL)); OPCODE_BREAK;
+		OPCODE_CASE(0x7F): BIT<7>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x80): RES<0>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x81): RES<0>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x82): RES<0>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x83): RES<0>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x84): RES<0>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x85): RES<0>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x86): RES_Indirect<0>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x87): RES<0>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x88): RES<1>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x89): RES<1>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x8A): RES<1>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x8B): RES<1>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x8C): RES<1>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x8D): RES<1>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x8E): RES_Indirect<1>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x8F): RES<1>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x90): RES<2>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x91): RES<2>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x92): RES<2>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x93): RES<2>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x94): RES<2>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x95): RES<2>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x96): RES_Indirect<2>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x97): RES<2>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0x98): RES<3>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0x99): RES<3>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0x9A): RES<3>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0x9B): RES<3>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0x9C): RES<3>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0x9D): RES<3>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0x9E): RES_Indirect<3>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0x9F): RES<3>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xA0): RES<4>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xA1): RES<4>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xA2): RES<4>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xA3): RES<4>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xA4): RES<4>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xA5): RES<4>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xA6): RES_Indirect<4>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xA7): RES<4>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xA8): RES<5>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xA9): RES<5>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xAA): RES<5>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xAB): RES<5>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xAC): RES<5>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xAD): RES<5>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xAE): RES_Indirect<5>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xAF): RES<5>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xB0): RES<6>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xB1): RES<6>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xB2): RES<6>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xB3): RES<6>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xB4): RES<6>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xB5): RES<6>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xB6): RES_Indirect<6>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xB7): RES<6>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xB8): RES<7>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xB9): RES<7>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xBA): RES<7>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xBB): RES<7>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xBC): RES<7>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xBD): RES<7>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xBE): RES_Indirect<7>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xBF): RES<7>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xC0): SET<0>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xC1): SET<0>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xC2): SET<0>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xC3): SET<0>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xC4): SET<0>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xC5): SET<0>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xC6): SET_Indirect<0>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xC7): SET<0>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xC8): SET<1>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xC9): SET<1>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xCA): SET<1>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xCB): SET<1>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xCC): SET<1>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xCD): SET<1>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xCE): SET_Indirect<1>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xCF): SET<1>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xD0): SET<2>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xD1): SET<2>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xD2): SET<2>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xD3): SET<2>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xD4): SET<2>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xD5): SET<2>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xD6): SET_Indirect<2>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xD7): SET<2>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xD8): SET<3>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xD9): SET<3>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xDA): SET<3>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xDB): SET<3>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xDC): SET<3>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xDD): SET<3>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xDE): SET_Indirect<3>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xDF): SET<3>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xE0): SET<4>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xE1): SET<4>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xE2): SET<4>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xE3): SET<4>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xE4): SET<4>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xE5): SET<4>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xE6): SET_Indirect<4>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xE7): SET<4>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xE8): SET<5>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xE9): SET<5>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xEA): SET<5>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xEB): SET<5>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xEC): SET<5>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xED): SET<5>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xEE): SET_Indirect<5>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xEF): SET<5>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xF0): SET<6>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xF1): SET<6>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xF2): SET<6>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xF3): SET<6>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xF4): SET<6>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xF5): SET<6>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xF6): SET_Indirect<6>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xF7): SET<6>(_state.A); OPCODE_BREAK;
+		OPCODE_CASE(0xF8): SET<7>(_state.B); OPCODE_BREAK;
+		OPCODE_CASE(0xF9): SET<7>(_state.C); OPCODE_BREAK;
+		OPCODE_CASE(0xFA): SET<7>(_state.D); OPCODE_BREAK;
+		OPCODE_CASE(0xFB): SET<7>(_state.E); OPCODE_BREAK;
+		OPCODE_CASE(0xFC): SET<7>(_state.H); OPCODE_BREAK;
+		OPCODE_CASE(0xFD): SET<7>(_state.L); OPCODE_BREAK;
+		OPCODE_CASE(0xFE): SET_Indirect<7>(_regHL); OPCODE_BREAK;
+		OPCODE_CASE(0xFF): SET<7>(_state.A); OPCODE_BREAK;
+	} OPCODE_SWITCH_END;
 }
 
 void GbCpu::Serialize(Serializer& s)
@@ -31,7 +31,12 @@ private:
 
 	uint8_t _prevIrqVector = 0;
 
+	//Used by threaded dispatch, which keeps executing instructions until this clock or the end of the frame
+	uint64_t _runUntilClock = 0;
+	uint32_t _runFrameCount = 0;
+
 	void ExecOpCode(uint8_t opCode);
+	__forceinline bool ChainNextOpCode(uint8_t& opCode);
 
 	void ProcessCgbSpeedSwitch();
 	__noinline void ProcessHaltBug();
@@ -172,6 +177,7 @@ public:
 	uint64_t GetCycleCount() { return _state.CycleCount; }
 
 	void Exec();
+	void SetRunLimit(uint64_t runUntilClock);
 	void PowerOn();
 
 	void Serialize(Serializer& s) override;
@@ -1283,6 +1283,11 @@ void BaseMapper::LoadRomPatch(vector<uint8_t>& orgPrgRom, vector<uint8_t>* orgCh
 void BaseMapper::SaveRom(vector<uint8_t>& orgPrgRom, vector<uint8_t>* orgChrRom)
 {
 	if(_console->GetNesConfig().OverwriteOriginalRom) {
+		if(_emu->GetBatteryManager()->IsJournalMode()) {
+			//Don't rewrite the whole rom file on periodic flushes, wait until the next regular save (e.g power off)
+			return;
+		}
+
 		bool needUpdate = memcmp(orgPrgRom.data(), _prgRom, _prgSize) != 0;
 		if(_chrRomSize > 0 && orgChrRom) {
 			needUpdate |= memcmp(orgChrRom->data(), _chrRom, _chrRomSize) != 0;
@@ -107,6 +107,7 @@ void NesDebugger::ResetPrevOpCode()
 	_prevOpCode = 0xFF;
 }
 
+template<uint8_t hooks>
 void NesDebugger::ProcessInstruction()
 {
 	NesCpuState& state = _cpu->GetState();
@@ -119,8 +120,10 @@ void NesDebugger::ProcessInstruction()
 
 	bool needDisassemble = _traceLogger->IsEnabled() || _settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled);
 	if(addressInfo.Address >= 0) {
-		if(addressInfo.Type == MemoryType::NesPrgRom) {
-			_codeDataLogger->SetCode(addressInfo.Address, NesDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::NesPrgRom) {
+				_codeDataLogger->SetCode(addressInfo.Address, NesDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+			}
 		}
 		if(needDisassemble) {
 			_disassembler->BuildCache(addressInfo, 0, CpuType::Nes);
@@ -133,80 +136,103 @@ void NesDebugger::ProcessInstruction()
 	_prevProgramCounter = pc;
 	_prevStackPointer = state.SP;
 
-	_step->ProcessCpuExec();
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
 
-	if(_settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled)) {
-		if(opCode == 0x00 && _settings->GetDebugConfig().NesBreakOnBrk) {
-			_step->Break(BreakSource::BreakOnBrk);
-		} else if(_settings->GetDebugConfig().NesBreakOnUnofficialOpCode && NesDisUtils::IsOpUnofficial(opCode)) {
-			_step->Break(BreakSource::BreakOnUnofficialOpCode);
-		} else if(_settings->GetDebugConfig().NesBreakOnUnstableOpCode && NesDisUtils::IsOpUnstable(opCode)) {
-			_step->Break(BreakSource::BreakOnUnstableOpCode);
+		if(_settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled)) {
+			if(opCode == 0x00 && _settings->GetDebugConfig().NesBreakOnBrk) {
+				_step->Break(BreakSource::BreakOnBrk);
+			} else if(_settings->GetDebugConfig().NesBreakOnUnofficialOpCode && NesDisUtils::IsOpUnofficial(opCode)) {
+				_step->Break(BreakSource::BreakOnUnofficialOpCode);
+			} else if(_settings->GetDebugConfig().NesBreakOnUnstableOpCode && NesDisUtils::IsOpUnstable(opCode)) {
+				_step->Break(BreakSource::BreakOnUnstableOpCode);
+			}
 		}
-	}
 
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(_cpu);
-		_dummyCpu->Exec();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _mapper->GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(CpuType::Nes, _breakpointManager.get(), memOp, absAddr);
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
+			_dummyCpu->SetDummyState(_cpu);
+			_dummyCpu->Exec();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _mapper->GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Nes, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
+template<uint8_t hooks>
 void NesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _mapper->GetAbsoluteAddress(addr);
 	MemoryOperationInfo operation(addr, value, type, MemoryType::NesMemory);
 	InstructionProgress.LastMemOperation = operation;
 
-	if(IsRegister(operation)) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(IsRegister(operation)) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
 	if(type == MemoryOperationType::ExecOpCode) {
-		if(_traceLogger->IsEnabled()) {
-			NesCpuState& state = _cpu->GetState();
-			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, state.PS, CpuType::Nes);
-			_traceLogger->Log(state, disInfo, operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				NesCpuState& state = _cpu->GetState();
+				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, state.PS, CpuType::Nes);
+				_traceLogger->Log(state, disInfo, operation, addressInfo);
+			}
 		}
 
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _cpu->GetCycleCount());
-		if(_step->ProcessCpuCycle()) {
-			_debugger->SleepUntilResume(CpuType::Nes, BreakSource::CpuStep, &operation);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->ProcessCpuCycle()) {
+				_debugger->SleepUntilResume(CpuType::Nes, BreakSource::CpuStep, &operation);
+			}
 		}
 	} else if(type == MemoryOperationType::ExecOperand) {
-		if(addressInfo.Type == MemoryType::NesPrgRom && addressInfo.Address >= 0) {
-			_codeDataLogger->SetCode(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::NesPrgRom && addressInfo.Address >= 0) {
+				_codeDataLogger->SetCode(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _cpu->GetCycleCount());
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	} else {
 		if(operation.Type == MemoryOperationType::DmaRead) {
 			bool isDmcDma = _cpu->IsDmcDma();
-			_eventManager->AddEvent(isDmcDma ? DebugEventType::DmcDmaRead : DebugEventType::DmaRead, operation);
+			if constexpr(hooks & DebugHookFlags::EventManager) {
+				_eventManager->AddEvent(isDmcDma ? DebugEventType::DmcDmaRead : DebugEventType::DmaRead, operation);
+			}
 			if((addr == 0x4016 || addr == 0x4017) && _settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled) && _settings->GetDebugConfig().NesBreakOnDmaInputRead) {
 				_debugger->BreakImmediately(CpuType::Nes, BreakSource::NesDmaInputRead);
 			} else if(isDmcDma && addressInfo.Type == MemoryType::NesPrgRom && addressInfo.Address >= 0) {
-				_codeDataLogger->SetData<NesCdlFlags::PcmData>(addressInfo.Address);
+				if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+					_codeDataLogger->SetData<NesCdlFlags::PcmData>(addressInfo.Address);
+				}
 			}
 		} else if(operation.Type != MemoryOperationType::DummyRead && addressInfo.Type == MemoryType::NesPrgRom && addressInfo.Address >= 0) {
-			_codeDataLogger->SetData(addressInfo.Address);
+			if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+				_codeDataLogger->SetData(addressInfo.Address);
+			}
 		}
 		
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _cpu->GetCycleCount());
@@ -216,15 +242,20 @@ void NesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 				//Only warn the first time
 				_debugger->Log("[CPU] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
 			}
-			if(_settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-				_step->Break(BreakSource::BreakOnUninitMemoryRead);
+			if constexpr(hooks & DebugHookFlags::BreakChecks) {
+				if(_settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				}
 			}
 		}
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	}
 }
 
+template<uint8_t hooks>
 void NesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _mapper->GetAbsoluteAddress(addr);
@@ -235,17 +266,23 @@ void NesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_disassembler->InvalidateCache(addressInfo, CpuType::Nes);
 	}
 
-	if(IsRegister(operation)) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(IsRegister(operation)) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _cpu->GetCycleCount());
-	_step->ProcessCpuCycle();
-	_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuCycle();
+		_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
 void NesDebugger::Run()
@@ -550,3 +587,11 @@ void NesDebugger::ProcessInputOverrides(DebugControllerState inputOverrides[8])
 	}
 	controlManager->RefreshHubState();
 }
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void NesDebugger::ProcessInstruction<hooks>(); \
+	template void NesDebugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void NesDebugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
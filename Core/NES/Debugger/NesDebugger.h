@@ -70,9 +70,9 @@ public:
 	uint64_t GetCpuCycleCount(bool forProfiler = false) override;
 	void ResetPrevOpCode() override;
 
-	void ProcessInstruction();
-	void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
-	void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessInstruction();
+	template<uint8_t hooks> void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
 	void ProcessInterrupt(uint32_t originalPc, uint32_t currentPc, bool forNmi) override;
 	void ProcessPpuRead(uint16_t addr, uint8_t value, MemoryType memoryType, MemoryOperationType opType);
 	void ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memoryType);
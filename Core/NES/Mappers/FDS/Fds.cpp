@@ -87,6 +87,11 @@ void Fds::LoadDiskData(vector<uint8_t> ipsData)
 void Fds::SaveBattery()
 {
 	if(_needSave) {
+		if(_settings->OverwriteOriginalRom && _emu->GetBatteryManager()->IsJournalMode()) {
+			//Don't rewrite the whole rom file on periodic flushes, wait until the next regular save (e.g power off)
+			return;
+		}
+
 		FdsLoader loader(_useQdFormat);
 		bool needHeader = (memcmp(_fdsRawData.data(), "FDS\x1a", 4) == 0);
 		vector<uint8_t> newData = loader.RebuildFdsFile(_fdsDiskSides, needHeader);
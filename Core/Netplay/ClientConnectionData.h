@@ -9,11 +9,12 @@ public:
 	uint16_t Port = 0;
 	string Password;
 	bool Spectator = false;
+	bool UseRollback = false;
 
 	ClientConnectionData() {}
 
-	ClientConnectionData(string host, uint16_t port, string password, bool spectator) :
-		Host(host), Port(port), Password(password), Spectator(spectator)
+	ClientConnectionData(string host, uint16_t port, string password, bool spectator, bool useRollback = false) :
+		Host(host), Port(port), Password(password), Spectator(spectator), UseRollback(useRollback)
 	{
 	}
 
@@ -6,6 +6,7 @@
 #include "Shared/Emulator.h"
 #include "Shared/NotificationManager.h"
 #include "Utilities/Socket.h"
+#include "Utilities/SocketPoller.h"
 
 GameClient::GameClient(Emulator* emu)
 {
@@ -53,14 +54,21 @@ void GameClient::Disconnect()
 void GameClient::Exec()
 {
 	if(_connected) {
+		SocketPoller poller;
 		while(!_stop) {
 			if(!_connection->ConnectionError()) {
+				//Process the host's messages as soon as they are received
+				//(the local player's input is checked at least once per millisecond)
+				poller.Clear();
+				poller.AddSocket(_connection->GetSocket(), _connection->HasPendingData());
+				poller.Wait(1);
+
 				_connection->ProcessMessages();
 				_connection->SendInput();
+				_connection->WriteSocket();
 			} else {
 				break;
 			}
-			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
 		}
 		_connected = false;
 		_connection->Shutdown();
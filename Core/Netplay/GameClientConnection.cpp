@@ -10,14 +10,17 @@
 #include "Netplay/PlayerListMessage.h"
 #include "Netplay/ForceDisconnectMessage.h"
 #include "Netplay/ServerInformationMessage.h"
+#include "Netplay/StateAckMessage.h"
+#include "Netplay/StateHashMessage.h"
 #include "Netplay/GameServer.h"
+#include "Netplay/RollbackManager.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/RomFinder.h"
 
-GameClientConnection::GameClientConnection(Emulator* emu, unique_ptr<Socket> socket, ClientConnectionData &connectionData) : GameConnection(emu, std::move(socket))
+GameClientConnection::GameClientConnection(Emulator* emu, unique_ptr<Socket> socket, ClientConnectionData &connectionData) : GameConnection(emu, std::move(socket)), _stateHasher(emu)
 {
 	_connectionData = connectionData;
 	_shutdown = false;
@@ -80,13 +83,7 @@ void GameClientConnection::ProcessMessage(NetMessage* message)
 
 		case MessageType::SaveState:
 			if(_gameLoaded) {
-				DisableControllers();
-
-				auto lock = _emu->AcquireLock();
-				ClearInputData();
-				((SaveStateMessage*)message)->LoadState(_emu);
-				_enableControllers = true;
-				InitControlDevice();
+				LoadSaveState((SaveStateMessage*)message);
 			}
 			break;
 
@@ -135,6 +132,41 @@ void GameClientConnection::ProcessMessage(NetMessage* message)
 	}
 }
 
+void GameClientConnection::LoadSaveState(SaveStateMessage* message)
+{
+	DisableControllers();
+
+	//Rebuild the state from the delta before pausing the emulation
+	NetplayState state;
+	if(!message->GetState(_baselineState, state)) {
+		if(message->IsDelta()) {
+			//Baseline doesn't match the host's, the host will send the full state (controllers stay disabled until then)
+			MessageManager::Log("[Netplay] Invalid state delta received, requesting full state.");
+			StateAckMessage ack(message->GetStateId(), false);
+			SendNetMessage(ack);
+		} else {
+			MessageManager::Log("[Netplay] Invalid state received.");
+		}
+		return;
+	}
+
+	{
+		auto lock = _emu->AcquireLock();
+		ClearInputData();
+		SaveStateMessage::LoadState(_emu, state);
+		if(_connectionData.UseRollback) {
+			//The host's input is counted from this point on
+			_emu->GetRollbackManager()->Start();
+		}
+		_enableControllers = true;
+		InitControlDevice();
+	}
+
+	_baselineState = std::move(state);
+	StateAckMessage ack(_baselineState.Id, true);
+	SendNetMessage(ack);
+}
+
 bool GameClientConnection::AttemptLoadGame(string filename, uint32_t crc32)
 {
 	if(filename.size() > 0) {
@@ -150,6 +182,11 @@ bool GameClientConnection::AttemptLoadGame(string filename, uint32_t crc32)
 
 void GameClientConnection::PushControllerState(uint8_t port, ControlDeviceState state)
 {
+	if(_connectionData.UseRollback) {
+		_emu->GetRollbackManager()->AddInput(port, state);
+		return;
+	}
+
 	LockHandler lock = _writeLock.AcquireSafe();
 	_inputData[port].push_back(state);
 	_inputSize[port]++;
@@ -163,6 +200,9 @@ void GameClientConnection::DisableControllers()
 {
 	//Used to prevent deadlocks when client is trying to fill its buffer while the host changes the current game/settings/etc. (i.e situations where we need to call Console::Pause())
 	_enableControllers = false;
+	if(_connectionData.UseRollback) {
+		_emu->GetRollbackManager()->Stop();
+	}
 	ClearInputData();
 	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
 		_waitForInput[i].Signal();
@@ -171,7 +211,10 @@ void GameClientConnection::DisableControllers()
 
 bool GameClientConnection::SetInput(BaseControlDevice *device)
 {
-	if(_enableControllers) {
+	if(_enableControllers && _connectionData.UseRollback) {
+		//Input is predicted instead of waiting for the host's input
+		return _emu->GetRollbackManager()->SetInput(device);
+	} else if(_enableControllers) {
 		uint8_t port = device->GetPort();
 		while(_inputSize[port] == 0) {
 			_waitForInput[port].Wait();
@@ -229,6 +272,24 @@ void GameClientConnection::ProcessNotification(ConsoleNotificationType type, voi
 		InitControlDevice();
 	} else if(type == ConsoleNotificationType::GameLoaded) {
 		_emu->RegisterInputProvider(this);
+		_stateHasher.Reset();
+	} else if(type == ConsoleNotificationType::PpuFrameDone) {
+		SendStateHash();
+	}
+}
+
+void GameClientConnection::SendStateHash()
+{
+	//Rollback clients emulate frames with predicted input, their state can't be compared with the host's until the input is confirmed
+	if(!_enableControllers || _connectionData.UseRollback || _emu->IsRunAheadFrame()) {
+		return;
+	}
+
+	uint32_t hash;
+	uint32_t frame = _emu->GetFrameCount();
+	if(_stateHasher.ProcessFrame(frame, hash)) {
+		StateHashMessage message(frame, hash);
+		SendNetMessage(message);
 	}
 }
 
@@ -249,9 +310,16 @@ void GameClientConnection::SendInput()
 			_controlDevice->SetStateFromInput();
 			inputState = _controlDevice->GetRawState();
 		}
-		
+
 		if(_lastInputSent != inputState) {
-			InputDataMessage message(inputState);
+			//Rollback clients use the local player's input on a specific frame, the host applies it on the same frame
+			//Other clients' input is applied by the host as soon as it's received
+			uint32_t frame = 0;
+			if(_connectionData.UseRollback) {
+				frame = _emu->GetRollbackManager()->SetLocalInput(_controllerPort.Port, _controllerType, inputState);
+			}
+
+			InputDataMessage message(inputState, frame);
 			SendNetMessage(message);
 			_lastInputSent = inputState;
 		}
@@ -10,6 +10,8 @@
 #include "Netplay/GameConnection.h"
 #include "Netplay/ClientConnectionData.h"
 #include "Netplay/NetplayTypes.h"
+#include "Netplay/SaveStateMessage.h"
+#include "Netplay/StateHasher.h"
 
 class Emulator;
 
@@ -34,6 +36,12 @@ private:
 	ClientConnectionData _connectionData = {};
 	string _serverSalt;
 
+	//Last state received from the host, the next states are sent as a delta against it
+	NetplayState _baselineState;
+
+	//Hashes the state periodically, the host compares it with its own to detect desyncs
+	StateHasher _stateHasher;
+
 private:
 	void SendHandshake();
 	void SendControllerSelection(NetplayControllerInfo controller);
@@ -41,6 +49,8 @@ private:
 	void PushControllerState(uint8_t port, ControlDeviceState state);
 	void DisableControllers();
 	bool AttemptLoadGame(string filename, uint32_t crc32);
+	void LoadSaveState(SaveStateMessage* message);
+	void SendStateHash();
 
 protected:
 	void ProcessMessage(NetMessage* message) override;
@@ -10,6 +10,8 @@
 #include "Netplay/ClientConnectionData.h"
 #include "Netplay/ForceDisconnectMessage.h"
 #include "Netplay/ServerInformationMessage.h"
+#include "Netplay/StateAckMessage.h"
+#include "Netplay/StateHashMessage.h"
 
 GameConnection::GameConnection(Emulator* emu, unique_ptr<Socket> socket)
 {
@@ -24,7 +26,6 @@ GameConnection::~GameConnection()
 
 void GameConnection::ReadSocket()
 {
-	auto lock = _socketLock.AcquireSafe();
 	int bytesReceived = _socket->Recv((char*)_readBuffer + _readPosition, GameConnection::MaxMsgLength - _readPosition, 0);
 	if(bytesReceived > 0) {
 		_readPosition += bytesReceived;
@@ -69,6 +70,8 @@ NetMessage* GameConnection::ReadMessage()
 				case MessageType::SelectController: return new SelectControllerMessage(_messageBuffer, messageLength);
 				case MessageType::ForceDisconnect: return new ForceDisconnectMessage(_messageBuffer, messageLength);
 				case MessageType::ServerInformation: return new ServerInformationMessage(_messageBuffer, messageLength);
+				case MessageType::StateAck: return new StateAckMessage(_messageBuffer, messageLength);
+				case MessageType::StateHash: return new StateHashMessage(_messageBuffer, messageLength);
 			}
 		}
 	}
@@ -77,16 +80,83 @@ NetMessage* GameConnection::ReadMessage()
 
 void GameConnection::SendNetMessage(NetMessage &message)
 {
+	string data = message.GetPacketData();
 	auto lock = _socketLock.AcquireSafe();
-	message.Send(*_socket.get());
+	_sendQueue += data;
+}
+
+void GameConnection::QueueData(shared_ptr<const string> data)
+{
+	if(!data->empty()) {
+		_writeQueue.push_back(std::move(data));
+	}
+}
+
+void GameConnection::WriteSocket()
+{
+	bool disconnectAfterSend;
+	{
+		auto lock = _socketLock.AcquireSafe();
+		if(!_sendQueue.empty()) {
+			QueueData(std::make_shared<const string>(std::move(_sendQueue)));
+			_sendQueue.clear();
+		}
+		disconnectAfterSend = _disconnectAfterSend;
+	}
+
+	SocketBuffer buffers[32];
+	while(HasPendingData() && !_socket->ConnectionError()) {
+		//Send as many of the queued buffers as possible with a single call
+		int count = 0;
+		int totalSize = 0;
+		for(size_t i = 0; i < _writeQueue.size() && count < 32; i++) {
+			size_t offset = i == 0 ? _writePosition : 0;
+			buffers[count++] = { _writeQueue[i]->data() + offset, (int)(_writeQueue[i]->size() - offset) };
+			totalSize += buffers[count - 1].Length;
+		}
+
+		int bytesSent = _socket->TrySend(buffers, count);
+		if(bytesSent <= 0) {
+			//Socket's buffer is full, the rest will be sent when the socket becomes writable again
+			break;
+		}
+
+		//Release the buffers that were fully sent
+		size_t remaining = (size_t)bytesSent;
+		while(remaining > 0) {
+			size_t length = _writeQueue.front()->size() - _writePosition;
+			if(remaining < length) {
+				_writePosition += remaining;
+				break;
+			}
+			remaining -= length;
+			_writeQueue.pop_front();
+			_writePosition = 0;
+		}
+
+		if(bytesSent < totalSize) {
+			break;
+		}
+	}
+
+	if(!HasPendingData()) {
+		if(disconnectAfterSend && !_socket->ConnectionError()) {
+			_socket->Close();
+		}
+	}
 }
 
 void GameConnection::Disconnect()
 {
-	auto lock = _socketLock.AcquireSafe();
 	_socket->Close();
 }
 
+void GameConnection::DisconnectAfterSend()
+{
+	auto lock = _socketLock.AcquireSafe();
+	_disconnectAfterSend = true;
+}
+
 bool GameConnection::ConnectionError()
 {
 	return _socket->ConnectionError();
@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include <deque>
 #include "Utilities/SimpleLock.h"
 
 class Socket;
@@ -17,7 +18,17 @@ protected:
 	uint8_t _readBuffer[GameConnection::MaxMsgLength] = {};
 	uint8_t _messageBuffer[GameConnection::MaxMsgLength] = {};
 	int _readPosition = 0;
+
+	//Messages sent by any thread, moved to the write buffer by the network thread
+	//_disconnectAfterSend is set under the same lock, so the connection is never closed before the messages queued before it are sent
 	SimpleLock _socketLock;
+	string _sendQueue;
+	bool _disconnectAfterSend = false;
+
+	//Data that hasn't been written to the socket yet (only used by the network thread)
+	//The buffers can be shared with other connections (e.g movie data sent to all clients) and are never copied
+	std::deque<shared_ptr<const string>> _writeQueue;
+	size_t _writePosition = 0;
 
 private:
 	void ReadSocket();
@@ -27,15 +38,24 @@ private:
 
 	virtual void ProcessMessage(NetMessage* message) = 0;
 
-protected:
-	void Disconnect();
-
 public:
 	static constexpr uint8_t SpectatorPort = 0xFF;
 	GameConnection(Emulator* emu, unique_ptr<Socket> socket);
 	virtual ~GameConnection();
 
 	bool ConnectionError();
+	void Disconnect();
+
+	//Closes the connection once all of the data queued so far has been sent
+	void DisconnectAfterSend();
 	void ProcessMessages();
-	void SendNetMessage(NetMessage &message);
-};
\ No newline at end of file
+	virtual void SendNetMessage(NetMessage &message);
+
+	Socket* GetSocket() { return _socket.get(); }
+
+	//Network thread only - adds data to the write queue, and writes as much of it as possible to the socket (batches all pending messages into a single write)
+	void QueueData(shared_ptr<const string> data);
+	void WriteSocket();
+	bool HasPendingData() { return !_writeQueue.empty(); }
+	size_t GetPendingBufferCount() { return _writeQueue.size(); }
+};
@@ -2,6 +2,8 @@
 #include "Netplay/GameServer.h"
 #include "Netplay/GameServerConnection.h"
 #include "Netplay/PlayerListMessage.h"
+#include "Netplay/MovieDataMessage.h"
+#include "Netplay/SaveStateMessage.h"
 #include "Shared/Emulator.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/NotificationManager.h"
@@ -9,7 +11,7 @@
 #include "Utilities/Socket.h"
 #include "Shared/ControllerHub.h"
 
-GameServer::GameServer(Emulator* emu)
+GameServer::GameServer(Emulator* emu) : _stateHasher(emu)
 {
 	_emu = emu;
 	_stop = false;
@@ -32,24 +34,87 @@ void GameServer::AcceptConnections()
 	while(true) {
 		unique_ptr<Socket> socket = _listener->Accept();
 		if(!socket->ConnectionError()) {
-			_openConnections.push_back(unique_ptr<GameServerConnection>(new GameServerConnection(this, _emu, std::move(socket), _password)));
+			_openConnections.push_back(unique_ptr<GameServerConnection>(new GameServerConnection(this, _emu, std::move(socket), _password, _nextConnectionId++)));
 		} else {
 			break;
 		}
 	}
-	_listener->Listen(10);
 }
 
-void GameServer::UpdateConnections()
+void GameServer::UpdateConnections(size_t polledCount)
 {
-	vector<unique_ptr<GameServerConnection>> connectionsToRemove;
+	for(size_t i = 0; i < _openConnections.size(); i++) {
+		//Connections accepted after the poll are always processed (the listener is the poller's first socket)
+		if(i >= polledCount || _poller.IsReadable(i + 1)) {
+			_openConnections[i]->ProcessMessages();
+		}
+	}
+
+	SendQueuedData();
+
+	for(unique_ptr<GameServerConnection>& connection : _openConnections) {
+		if(connection->HasPendingData()) {
+			connection->WriteSocket();
+		}
+	}
+
 	for(int i = (int)_openConnections.size() - 1; i >= 0; i--) {
 		if(_openConnections[i]->ConnectionError()) {
 			//Pause emu thread to ensure nothing else modifies/accesses the _openConnections list while removing dead connections
 			auto lock = _emu->AcquireLock();
 			_openConnections.erase(_openConnections.begin() + i);
-		} else {
-			_openConnections[i]->ProcessMessages();
+		}
+	}
+}
+
+void GameServer::QueueData(uint32_t connectionId, string data, bool disconnectAfterSend)
+{
+	{
+		auto lock = _sendLock.AcquireSafe();
+		_sendQueue.push_back({ connectionId, std::make_shared<const string>(std::move(data)), nullptr, disconnectAfterSend });
+	}
+	_poller.Wake();
+}
+
+void GameServer::QueueSaveState(uint32_t connectionId, shared_ptr<NetplayState> state)
+{
+	{
+		auto lock = _sendLock.AcquireSafe();
+		_sendQueue.push_back({ connectionId, nullptr, state, false });
+	}
+	_poller.Wake();
+}
+
+void GameServer::SendQueuedData()
+{
+	vector<OutgoingData> sendQueue;
+	{
+		auto lock = _sendLock.AcquireSafe();
+		sendQueue.swap(_sendQueue);
+	}
+
+	//Append everything to the connections' write queues, to send all pending messages with a single write per connection
+	for(OutgoingData& data : sendQueue) {
+		for(unique_ptr<GameServerConnection>& connection : _openConnections) {
+			if(data.ConnectionId == GameServer::BroadcastId ? connection->IsHandshakeCompleted() : data.ConnectionId == connection->GetId()) {
+				if(data.State) {
+					connection->QueueData(std::make_shared<const string>(connection->EncodeSaveState(data.State)));
+				} else {
+					connection->QueueData(data.Data);
+				}
+
+				if(data.DisconnectAfterSend) {
+					connection->DisconnectAfterSend();
+				}
+			}
+		}
+	}
+
+	for(unique_ptr<GameServerConnection>& connection : _openConnections) {
+		if(connection->GetPendingBufferCount() > GameServer::MaxPendingBuffers && !connection->ConnectionError()) {
+			//Clients can be slow to receive data without affecting the other clients, but the amount of data buffered for them is limited
+			MessageManager::Log(connection->IsSpectator() ? "[Netplay] Spectator is too far behind the host, disconnecting." : "[Netplay] Player is too far behind the host, disconnecting.");
+			connection->Disconnect();
 		}
 	}
 }
@@ -86,14 +151,17 @@ bool GameServer::SetInput(BaseControlDevice *device)
 
 void GameServer::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
 {
+	if(!_initialized) {
+		return;
+	}
+
+	//Send movie stream - the messages are serialized once and sent to every connection by the server thread
+	string data;
 	for(shared_ptr<BaseControlDevice> &device : devices) {
-		for(unique_ptr<GameServerConnection>& connection : _openConnections) {
-			if(!connection->ConnectionError()) {
-				//Send movie stream
-				connection->SendMovieData(device->GetPort(), device->GetRawState());
-			}
-		}
+		MovieDataMessage message(device->GetRawState(), device->GetPort());
+		data += message.GetPacketData();
 	}
+	QueueData(GameServer::BroadcastId, std::move(data));
 }
 
 void GameServer::ProcessNotification(ConsoleNotificationType type, void * parameter)
@@ -105,9 +173,32 @@ void GameServer::ProcessNotification(ConsoleNotificationType type, void * parame
 	if(type == ConsoleNotificationType::GameLoaded) {
 		//Register the server as an input provider/recorder
 		RegisterServerInput();
+		_stateHasher.Reset();
+	} else if(type == ConsoleNotificationType::PpuFrameDone && _initialized && !_emu->IsRunAheadFrame()) {
+		uint32_t hash;
+		uint32_t frame = _emu->GetFrameCount();
+		if(_stateHasher.ProcessFrame(frame, hash)) {
+			auto lock = _stateHashLock.AcquireSafe();
+			_stateHashes.push_back({ frame, hash });
+			if(_stateHashes.size() > GameServer::MaxStateHashes) {
+				_stateHashes.pop_front();
+			}
+		}
 	}
 }
 
+bool GameServer::GetStateHash(uint32_t frame, uint32_t& hash)
+{
+	auto lock = _stateHashLock.AcquireSafe();
+	for(std::pair<uint32_t, uint32_t>& stateHash : _stateHashes) {
+		if(stateHash.first == frame) {
+			hash = stateHash.second;
+			return true;
+		}
+	}
+	return false;
+}
+
 void GameServer::Exec()
 {
 	_listener.reset(new Socket());
@@ -118,10 +209,19 @@ void GameServer::Exec()
 	MessageManager::DisplayMessage("NetPlay" , "ServerStarted", std::to_string(_port));
 
 	while(!_stop) {
-		AcceptConnections();
-		UpdateConnections();
+		//Wait until a client connects, data is received, a socket with pending data becomes writable, or data is queued by another thread
+		_poller.Clear();
+		_poller.AddSocket(_listener.get(), false);
+		for(unique_ptr<GameServerConnection>& connection : _openConnections) {
+			_poller.AddSocket(connection->GetSocket(), connection->HasPendingData());
+		}
+		size_t polledCount = _openConnections.size();
+		_poller.Wait(100);
 
-		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+		if(_poller.IsReadable(0)) {
+			AcceptConnections();
+		}
+		UpdateConnections(polledCount);
 	}
 }
 
@@ -145,6 +245,7 @@ void GameServer::StopServer()
 	}
 
 	_stop = true;
+	_poller.Wake();
 
 	if(_serverThread) {
 		_serverThread->join();
@@ -153,6 +254,10 @@ void GameServer::StopServer()
 
 	_openConnections.clear();
 	_initialized = false;
+	{
+		auto lock = _sendLock.AcquireSafe();
+		_sendQueue.clear();
+	}
 	_listener.reset();
 	MessageManager::DisplayMessage("NetPlay", "ServerStopped");
 
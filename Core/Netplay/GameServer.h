@@ -3,16 +3,42 @@
 #include <thread>
 #include "Netplay/GameServerConnection.h"
 #include "Netplay/NetplayTypes.h"
+#include "Netplay/StateHasher.h"
 #include "Shared/Interfaces/INotificationListener.h"
 #include "Shared/Interfaces/IInputProvider.h"
 #include "Shared/Interfaces/IInputRecorder.h"
 #include "Shared/IControllerHub.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/SocketPoller.h"
 
 class Emulator;
+struct NetplayState;
 
 class GameServer : public IInputRecorder, public IInputProvider, public INotificationListener, public std::enable_shared_from_this<GameServer>
 {
 private:
+	//Connection ID used to send data to all connections that completed the handshake
+	static constexpr uint32_t BroadcastId = 0;
+
+	//Max number of buffers that can be queued for a client (player or spectator) before it gets disconnected
+	//Each frame's movie data is sent as a single buffer, so this allows a client to fall up to 10 seconds behind a 60 fps game
+	//(less when other messages, e.g save states, are also queued)
+	static constexpr size_t MaxPendingBuffers = 600;
+
+	struct OutgoingData
+	{
+		uint32_t ConnectionId;
+
+		//Broadcast data is shared by all connections (not copied)
+		shared_ptr<const string> Data;
+
+		//Save states are encoded by the server thread (delta against the client's baseline + compression)
+		shared_ptr<NetplayState> State;
+
+		//Closes the connection once this data has been sent
+		bool DisconnectAfterSend;
+	};
+
 	Emulator* _emu;
 	unique_ptr<thread> _serverThread;
 	unique_ptr<Socket> _listener;
@@ -20,14 +46,27 @@ private:
 	uint16_t _port = 0;
 	string _password;
 	vector<unique_ptr<GameServerConnection>> _openConnections;
+	uint32_t _nextConnectionId = 1;
 	bool _initialized = false;
+
+	//Data sent by any thread, written to the sockets by the server thread
+	SocketPoller _poller;
+	SimpleLock _sendLock;
+	vector<OutgoingData> _sendQueue;
+
+	//Hashes of the host's state, compared with the hashes sent by the clients to detect desyncs
+	static constexpr uint32_t MaxStateHashes = 30;
+	StateHasher _stateHasher;
+	SimpleLock _stateHashLock;
+	std::deque<std::pair<uint32_t, uint32_t>> _stateHashes;
 	
 	GameServerConnection* _netPlayDevices[BaseControlDevice::PortCount][IControllerHub::MaxSubPorts] = {};
 
 	NetplayControllerInfo _hostControllerPort = {};
 
 	void AcceptConnections();
-	void UpdateConnections();
+	void UpdateConnections(size_t polledCount);
+	void SendQueuedData();
 
 	void Exec();
 
@@ -37,6 +76,9 @@ public:
 
 	void RegisterServerInput();
 
+	void QueueData(uint32_t connectionId, string data, bool disconnectAfterSend = false);
+	void QueueSaveState(uint32_t connectionId, shared_ptr<NetplayState> state);
+
 	void StartServer(uint16_t port, string password);
 	void StopServer();
 	bool Started();
@@ -55,6 +97,8 @@ public:
 	// Inherited via INotificationListener
 	virtual void ProcessNotification(ConsoleNotificationType type, void * parameter) override;
 
+	bool GetStateHash(uint32_t frame, uint32_t& hash);
+
 	void RegisterNetPlayDevice(GameServerConnection* connection, NetplayControllerInfo controller);
 	void UnregisterNetPlayDevice(GameServerConnection* device);
 	NetplayControllerInfo GetFirstFreeControllerPort();
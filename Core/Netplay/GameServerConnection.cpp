@@ -12,16 +12,20 @@
 #include "Netplay/GameServer.h"
 #include "Netplay/ForceDisconnectMessage.h"
 #include "Netplay/ServerInformationMessage.h"
+#include "Netplay/StateAckMessage.h"
+#include "Netplay/StateHashMessage.h"
 #include "Netplay/NetplayTypes.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/BaseControlDevice.h"
 
-GameServerConnection::GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, string serverPassword) : GameConnection(emu, std::move(socket))
+GameServerConnection::GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, string serverPassword, uint32_t id) : GameConnection(emu, std::move(socket))
 {
 	//Server-side connection
 	_server = gameServer;
+	_id = id;
+	_lastStateFrame = 0;
 	_serverPassword = serverPassword;
 	_controllerPort = NetplayControllerInfo { GameConnection::SpectatorPort, 0 };
 	SendServerInformation();
@@ -56,36 +60,81 @@ void GameServerConnection::SendGameInformation()
 	RomInfo romInfo = _emu->GetRomInfo();
 	GameInformationMessage gameInfo(romInfo.RomFile.GetFileName(), _emu->GetCrc32(), _controllerPort, _emu->IsPaused());
 	SendNetMessage(gameInfo);
-	SaveStateMessage saveState(_emu);
-	SendNetMessage(saveState);
+	SendSaveState();
 }
 
-void GameServerConnection::SendMovieData(uint8_t port, ControlDeviceState state)
+void GameServerConnection::SendSaveState()
 {
-	if(_handshakeCompleted) {
-		MovieDataMessage message(state, port);
-		SendNetMessage(message);
+	//The emulation only needs to be paused while the state is serialized, it's queued to keep it in order with the movie data
+	auto lock = _emu->AcquireLock();
+	_lastStateFrame = _emu->GetFrameCount();
+	_server->QueueSaveState(_id, SaveStateMessage::CaptureState(_emu));
+}
+
+string GameServerConnection::EncodeSaveState(shared_ptr<NetplayState> state)
+{
+	//Called by the server thread - only send the parts of the state that differ from the last state sent to the client
+	state->Id = _nextStateId++;
+	SaveStateMessage message(*state, _baselineState.get());
+
+	if(!_baselineState) {
+		_fullStateId = state->Id;
+	}
+	_baselineState = state;
+	return message.GetPacketData();
+}
+
+void GameServerConnection::ProcessStateHash(uint32_t frame, uint32_t hash)
+{
+	uint32_t hostHash;
+	if(frame > _lastStateFrame && _server->GetStateHash(frame, hostHash) && hostHash != hash) {
+		//Client's state doesn't match the host's, send it the current state (only the parts that differ from its last state are sent)
+		MessageManager::Log("[Netplay] Desync detected at frame " + std::to_string(frame) + ", resynchronizing client.");
+		SendSaveState();
+	}
+}
+
+void GameServerConnection::ProcessStateAck(uint32_t stateId, bool stateLoaded)
+{
+	if(!stateLoaded && stateId > _fullStateId) {
+		//Client couldn't load the delta, send it the full state
+		//The client also rejects the deltas that were sent after the one that failed, their acks are ignored once a full state has been sent
+		_baselineState.reset();
+		SendSaveState();
 	}
 }
 
+void GameServerConnection::SendNetMessage(NetMessage& message)
+{
+	//Messages are written to the socket by the server thread, in the same order as the movie data sent to all clients
+	_server->QueueData(_id, message.GetPacketData());
+}
+
 void GameServerConnection::SendForceDisconnectMessage(string disconnectMessage)
 {
+	//The connection is closed by the server thread, once the message has been moved to the connection's write queue and sent
 	ForceDisconnectMessage message(disconnectMessage);
-	SendNetMessage(message);
-	Disconnect();
+	_server->QueueData(_id, message.GetPacketData(), true);
 }
 
-void GameServerConnection::PushState(ControlDeviceState state)
+void GameServerConnection::PushState(ControlDeviceState state, uint32_t frame)
 {
 	auto lock = _inputLock.AcquireSafe();
-	_inputData = state;
+	_pendingInputs.push_back({ frame, std::move(state) });
 }
 
 ControlDeviceState GameServerConnection::GetState()
 {
+	//Called by the emulation thread when the client's controller is polled
+	uint32_t frame = _emu->GetFrameCount();
+
 	ControlDeviceState stateData;
 	{
 		auto lock = _inputLock.AcquireSafe();
+		while(!_pendingInputs.empty() && (_pendingInputs.front().Frame <= frame || _pendingInputs.front().Frame > frame + GameServerConnection::MaxInputLead)) {
+			_inputData = std::move(_pendingInputs.front().State);
+			_pendingInputs.pop_front();
+		}
 		stateData = _inputData;
 	}
 	return stateData;
@@ -130,7 +179,23 @@ void GameServerConnection::ProcessMessage(NetMessage* message)
 				SendForceDisconnectMessage("Handshake has not been completed - invalid packet");
 				return;
 			}
-			PushState(((InputDataMessage*)message)->GetInputState());
+			PushState(((InputDataMessage*)message)->GetInputState(), ((InputDataMessage*)message)->GetFrame());
+			break;
+
+		case MessageType::StateAck:
+			if(!_handshakeCompleted) {
+				SendForceDisconnectMessage("Handshake has not been completed - invalid packet");
+				return;
+			}
+			ProcessStateAck(((StateAckMessage*)message)->GetStateId(), ((StateAckMessage*)message)->IsStateLoaded());
+			break;
+
+		case MessageType::StateHash:
+			if(!_handshakeCompleted) {
+				SendForceDisconnectMessage("Handshake has not been completed - invalid packet");
+				return;
+			}
+			ProcessStateHash(((StateHashMessage*)message)->GetFrame(), ((StateHashMessage*)message)->GetHash());
 			break;
 
 		case MessageType::SelectController:
@@ -10,14 +10,39 @@
 
 class HandShakeMessage;
 class GameServer;
+struct NetplayState;
 
 class GameServerConnection final : public GameConnection, public INotificationListener
 {
 private:
 	GameServer* _server = nullptr;
+	uint32_t _id = 0;
+
+	//Inputs sent by rollback clients are stamped with the frame they were used on by the client, and are only applied on that frame
+	//(or as soon as possible when they're received too late), so the movie data sent back to the client matches its own input
+	struct PendingInput
+	{
+		uint32_t Frame;
+		ControlDeviceState State;
+	};
+
+	//Inputs stamped with frames further ahead than this are applied right away (e.g the frame counter was reset by the host)
+	static constexpr uint32_t MaxInputLead = 60;
 
 	SimpleLock _inputLock;
 	ControlDeviceState _inputData = {};
+	std::deque<PendingInput> _pendingInputs;
+
+	//Last state sent to the client, the next state is sent as a delta against it (only used by the server thread)
+	//The client loads the states in the order they were sent, so this matches the client's baseline without waiting for its ack
+	shared_ptr<NetplayState> _baselineState;
+	uint32_t _nextStateId = 1;
+
+	//ID of the last state sent in full (without a baseline)
+	uint32_t _fullStateId = 0;
+
+	//Frame at which the last state was sent, the client's state hashes for previous frames are ignored
+	atomic<uint32_t> _lastStateFrame;
 
 	string _previousConfig = "";
 
@@ -26,9 +51,12 @@ private:
 	string _serverPassword;
 	bool _handshakeCompleted = false;
 
-	void PushState(ControlDeviceState state);
+	void PushState(ControlDeviceState state, uint32_t frame);
 	void SendServerInformation();
 	void SendGameInformation();
+	void SendSaveState();
+	void ProcessStateAck(uint32_t stateId, bool stateLoaded);
+	void ProcessStateHash(uint32_t frame, uint32_t hash);
 	void SelectControllerPort(NetplayControllerInfo port);
 
 	void SendForceDisconnectMessage(string disconnectMessage);
@@ -39,11 +67,17 @@ protected:
 	void ProcessMessage(NetMessage* message) override;
 	
 public:
-	GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, string serverPassword);
+	GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, string serverPassword, uint32_t id);
 	virtual ~GameServerConnection();
 
+	uint32_t GetId() { return _id; }
+	bool IsHandshakeCompleted() { return _handshakeCompleted; }
+	bool IsSpectator() { return _controllerPort.Port == GameConnection::SpectatorPort; }
+
+	void SendNetMessage(NetMessage& message) override;
+	string EncodeSaveState(shared_ptr<NetplayState> state);
+
 	ControlDeviceState GetState();
-	void SendMovieData(uint8_t port, ControlDeviceState state);
 
 	NetplayControllerInfo GetControllerPort();
 
@@ -7,23 +7,32 @@ class InputDataMessage : public NetMessage
 {
 private:
 	ControlDeviceState _inputState;
+	uint32_t _frame = 0;
 
 protected:	
 	void Serialize(Serializer &s) override
 	{
 		SVVector(_inputState.State);
+		SV(_frame);
 	}
 
 public:
 	InputDataMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) { }
 
-	InputDataMessage(ControlDeviceState inputState) : NetMessage(MessageType::InputData)
+	InputDataMessage(ControlDeviceState inputState, uint32_t frame) : NetMessage(MessageType::InputData)
 	{
 		_inputState = inputState;
+		_frame = frame;
 	}
 
 	ControlDeviceState GetInputState()
 	{
 		return _inputState;
 	}
+
+	//Frame (emulator frame count) at which the host should start using this input, 0 to use it as soon as it's received
+	uint32_t GetFrame()
+	{
+		return _frame;
+	}
 };
\ No newline at end of file
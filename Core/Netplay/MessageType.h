@@ -11,5 +11,7 @@ enum class MessageType : uint8_t
 	PlayerList = 5,
 	SelectController = 6,
 	ForceDisconnect = 7,
-	ServerInformation = 8
+	ServerInformation = 8,
+	StateAck = 9,
+	StateHash = 10
 };
\ No newline at end of file
@@ -40,7 +40,8 @@ public:
 		return _type;
 	}
 
-	void Send(Socket &socket)
+	//Returns the message's data, as it is sent over the network (length + type + data)
+	string GetPacketData()
 	{
 		Serializer s(SaveStateManager::FileFormatVersion, true);
 		Serialize(s);
@@ -50,8 +51,7 @@ public:
 
 		string data = out.str();
 		uint32_t messageLength = (uint32_t)data.size() + 1;
-		data = string((char*)&messageLength, 4) + (char)_type + data;
-		socket.Send((char*)data.c_str(), (int)data.size(), 0);
+		return string((char*)&messageLength, 4) + (char)_type + data;
 	}
 
 protected:
@@ -0,0 +1,419 @@
+#include "pch.h"
+#include <iomanip>
+#include "Netplay/RollbackManager.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/SaveStateManager.h"
+#include "Shared/MessageManager.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "Utilities/Timer.h"
+
+RollbackManager::RollbackManager(Emulator* emu)
+{
+	_emu = emu;
+	_enabled = false;
+}
+
+void RollbackManager::Start()
+{
+	//Called after the host's state is loaded, while the emulation thread is paused
+	std::lock_guard<std::mutex> lock(_inputLock);
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		_inputs[i].clear();
+		_inputStart[i] = 0;
+		_confirmedCount[i] = 0;
+		_lastConfirmedState[i] = {};
+		_pollCount[i] = 0;
+		_mispredictedPoll[i] = -1;
+	}
+
+	for(Snapshot& snapshot : _snapshots) {
+		snapshot.Valid = false;
+	}
+
+	//The local player's current input stays in use (the frame counts of the pending inputs are no longer valid)
+	while(_localInputs.size() > 1) {
+		_localInputs.pop_front();
+	}
+	if(!_localInputs.empty()) {
+		_localInputs.front().FrameCount = 0;
+	}
+	_frameCount = _emu->GetFrameCount();
+	_lastDelayChange = 0;
+	_lastLateInput = 0;
+
+	_frame = 0;
+	_stats = {};
+	_totalRollbackDepth = 0;
+	_totalRollbackTime = 0;
+	_totalSnapshotTime = 0;
+	_enabled = true;
+}
+
+void RollbackManager::Stop()
+{
+	_enabled = false;
+	_inputReceived.Signal();
+
+	if(_catchingUp) {
+		_catchingUp = false;
+		_emu->GetSettings()->SetMaxSpeedOverride(MaxSpeedOverride::NetplayCatchUp, false);
+	}
+}
+
+RollbackManager::InputEntry& RollbackManager::GetInputEntry(uint8_t port, uint32_t pollIndex)
+{
+	std::deque<InputEntry>& inputs = _inputs[port];
+	while(_inputStart[port] + inputs.size() <= pollIndex) {
+		inputs.emplace_back();
+	}
+	return inputs[pollIndex - _inputStart[port]];
+}
+
+void RollbackManager::AddInput(uint8_t port, ControlDeviceState state)
+{
+	if(port >= BaseControlDevice::PortCount) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_inputLock);
+		uint32_t pollIndex = _confirmedCount[port]++;
+		if(pollIndex < _inputStart[port]) {
+			//Entry was already discarded (can't happen unless the prediction window was exceeded)
+			return;
+		}
+
+		InputEntry& entry = GetInputEntry(port, pollIndex);
+		if(entry.Used && pollIndex < _pollCount[port] && entry.State != state) {
+			//The frame that polled this input used a different (predicted) value, it needs to be emulated again
+			if(_mispredictedPoll[port] < 0 || pollIndex < _mispredictedPoll[port]) {
+				_mispredictedPoll[port] = pollIndex;
+			}
+
+			if(port == _localPort) {
+				//The host applied the local player's input on a later frame than the client (it was received too late)
+				UpdateInputDelay(true);
+			}
+		}
+
+		entry.State = state;
+		entry.Confirmed = true;
+		_lastConfirmedState[port] = state;
+	}
+
+	_inputReceived.Signal();
+}
+
+uint32_t RollbackManager::SetLocalInput(uint8_t port, ControllerType type, ControlDeviceState state)
+{
+	std::lock_guard<std::mutex> lock(_inputLock);
+	_localPort = port;
+	_localType = type;
+
+	uint32_t frameCount = _frameCount + 1 + _inputDelay;
+	if(!_localInputs.empty() && _localInputs.back().FrameCount >= frameCount) {
+		//Input changed again before the previous one was used (or the delay was reduced), replace it
+		frameCount = _localInputs.back().FrameCount;
+		_localInputs.back().State = std::move(state);
+	} else {
+		_localInputs.push_back({ frameCount, std::move(state) });
+	}
+	return frameCount;
+}
+
+RollbackManager::LocalInput* RollbackManager::GetLocalInput(uint32_t frameCount)
+{
+	for(auto itr = _localInputs.rbegin(); itr != _localInputs.rend(); itr++) {
+		if(itr->FrameCount <= frameCount) {
+			return &*itr;
+		}
+	}
+	return nullptr;
+}
+
+void RollbackManager::UpdateInputDelay(bool lateInput)
+{
+	//Called with the input lock held
+	uint32_t frame = _stats.FrameCount;
+	if(lateInput) {
+		_stats.LateInputCount++;
+		_lastLateInput = frame;
+		if(_inputDelay < RollbackManager::MaxInputDelay && frame - _lastDelayChange >= RollbackManager::DelayIncreaseInterval) {
+			_inputDelay++;
+			_lastDelayChange = frame;
+		}
+	} else if(_inputDelay > 0 && frame - _lastLateInput >= RollbackManager::DelayDecreaseInterval && frame - _lastDelayChange >= RollbackManager::DelayDecreaseInterval) {
+		_inputDelay--;
+		_lastDelayChange = frame;
+	}
+}
+
+bool RollbackManager::SetInput(BaseControlDevice* device)
+{
+	if(!_enabled) {
+		return false;
+	}
+
+	uint8_t port = device->GetPort();
+	if(port >= BaseControlDevice::PortCount) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_inputLock);
+	InputEntry& entry = GetInputEntry(port, _pollCount[port]++);
+	if(!entry.Confirmed) {
+		LocalInput* localInput = port == _localPort && device->GetControllerType() == _localType ? GetLocalInput(_emu->GetFrameCount()) : nullptr;
+		if(localInput && !localInput->State.State.empty()) {
+			//Local player's input is used on the frame it was stamped with (the host applies it on the same frame)
+			//Keep the input that was used the first time when the frame is emulated again
+			if(!entry.Used) {
+				entry.State = localInput->State;
+			}
+		} else {
+			//Predict that the host's input is unchanged since the last input received
+			if(_lastConfirmedState[port].State.empty()) {
+				device->ClearState();
+				entry.State = device->GetRawState();
+			} else {
+				entry.State = _lastConfirmedState[port];
+			}
+		}
+	}
+
+	entry.Used = true;
+	entry.Frame = _frame;
+	device->SetRawState(entry.State);
+	return true;
+}
+
+bool RollbackManager::CanRunFrame()
+{
+	//Ensure the oldest frame that used predicted input is still recent enough to be rolled back to
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		if(_confirmedCount[i] >= _inputStart[i] && _confirmedCount[i] < _pollCount[i]) {
+			InputEntry& entry = GetInputEntry(i, _confirmedCount[i]);
+			if(entry.Used && _frame - entry.Frame >= RollbackManager::MaxPredictionFrames) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool RollbackManager::WaitForInput(int timeout)
+{
+	{
+		std::lock_guard<std::mutex> lock(_inputLock);
+		if(CanRunFrame()) {
+			return true;
+		}
+	}
+
+	_stats.StallCount++;
+
+	Timer timer;
+	while(_enabled && timer.GetElapsedMS() < timeout) {
+		_inputReceived.Wait(timeout);
+
+		std::lock_guard<std::mutex> lock(_inputLock);
+		if(CanRunFrame()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int64_t RollbackManager::GetRollbackFrame()
+{
+	std::lock_guard<std::mutex> lock(_inputLock);
+
+	bool mispredicted = false;
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		mispredicted |= _mispredictedPoll[i] >= 0;
+	}
+
+	if(!mispredicted) {
+		return -1;
+	}
+
+	//Find the most recent snapshot taken before all of the mispredicted inputs were polled
+	int64_t rollbackFrame = -1;
+	for(uint32_t i = 1; i <= RollbackManager::SnapshotCount && i <= _frame; i++) {
+		Snapshot& snapshot = _snapshots[(_frame - i) % RollbackManager::SnapshotCount];
+		if(!snapshot.Valid || snapshot.Frame != _frame - i) {
+			break;
+		}
+
+		bool isBeforeMisprediction = true;
+		for(int j = 0; j < BaseControlDevice::PortCount; j++) {
+			if(_mispredictedPoll[j] >= 0 && snapshot.PollCount[j] > _mispredictedPoll[j]) {
+				isBeforeMisprediction = false;
+				break;
+			}
+		}
+
+		if(isBeforeMisprediction) {
+			rollbackFrame = snapshot.Frame;
+			break;
+		}
+	}
+
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		_mispredictedPoll[i] = -1;
+	}
+
+	if(rollbackFrame < 0) {
+		MessageManager::Log("[Netplay] Could not roll back to a mispredicted frame (no snapshot available)");
+	}
+	return rollbackFrame;
+}
+
+void RollbackManager::LoadSnapshot(Snapshot& snapshot)
+{
+	snapshot.State.clear();
+	snapshot.State.seekg(0, ios::beg);
+	_emu->Deserialize(snapshot.State, SaveStateManager::FileFormatVersion, false, std::nullopt, false);
+
+	std::lock_guard<std::mutex> lock(_inputLock);
+	_frame = snapshot.Frame;
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		_pollCount[i] = snapshot.PollCount[i];
+	}
+}
+
+void RollbackManager::ProcessRollback()
+{
+	int64_t rollbackFrame = GetRollbackFrame();
+	if(rollbackFrame < 0) {
+		return;
+	}
+
+	Timer timer;
+	uint32_t currentFrame = _frame;
+	LoadSnapshot(_snapshots[rollbackFrame % RollbackManager::SnapshotCount]);
+
+	shared_ptr<IConsole> console = _emu->GetConsole();
+	while(_frame < currentFrame && console) {
+		BeginFrame();
+		console->RunFrame();
+		EndFrame();
+	}
+
+	double elapsed = timer.GetElapsedMS();
+	uint32_t depth = currentFrame - (uint32_t)rollbackFrame;
+	_stats.RollbackCount++;
+	_stats.MaxRollbackDepth = std::max(_stats.MaxRollbackDepth, depth);
+	_stats.MaxRollbackTime = std::max(_stats.MaxRollbackTime, elapsed);
+	_totalRollbackDepth += depth;
+	_totalRollbackTime += elapsed;
+}
+
+void RollbackManager::BeginFrame()
+{
+	Timer timer;
+
+	Snapshot& snapshot = _snapshots[_frame % RollbackManager::SnapshotCount];
+	snapshot.State.str("");
+	snapshot.State.clear();
+	_emu->Serialize(snapshot.State, false, 0);
+	snapshot.Frame = _frame;
+	snapshot.Valid = true;
+
+	{
+		std::lock_guard<std::mutex> lock(_inputLock);
+		for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+			snapshot.PollCount[i] = _pollCount[i];
+		}
+		snapshot.FrameCount = _emu->GetFrameCount();
+		if(!_emu->IsRunAheadFrame()) {
+			_frameCount = snapshot.FrameCount;
+		}
+	}
+
+	_totalSnapshotTime += timer.GetElapsedMS();
+}
+
+void RollbackManager::EndFrame()
+{
+	std::lock_guard<std::mutex> lock(_inputLock);
+
+	bool predicted = false;
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		predicted |= _confirmedCount[i] < _pollCount[i];
+	}
+
+	if(!_emu->IsRunAheadFrame()) {
+		_stats.FrameCount++;
+		if(predicted) {
+			_stats.PredictedFrameCount++;
+		}
+		UpdateSpeed();
+		UpdateInputDelay(false);
+	}
+
+	_frame++;
+	TrimInputs();
+}
+
+void RollbackManager::TrimInputs()
+{
+	//Inputs polled before the oldest snapshot can't be needed anymore, once they have been confirmed
+	uint32_t oldestFrame = _frame >= RollbackManager::SnapshotCount ? _frame - RollbackManager::SnapshotCount + 1 : 0;
+	Snapshot& oldest = _snapshots[oldestFrame % RollbackManager::SnapshotCount];
+	if(!oldest.Valid || oldest.Frame != oldestFrame) {
+		return;
+	}
+
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		std::deque<InputEntry>& inputs = _inputs[i];
+		while(!inputs.empty() && _inputStart[i] < oldest.PollCount[i] && inputs.front().Confirmed) {
+			inputs.pop_front();
+			_inputStart[i]++;
+		}
+	}
+
+	//Local inputs are kept until the frames that used them can no longer be emulated again
+	while(_localInputs.size() > 1 && _localInputs[1].FrameCount <= oldest.FrameCount) {
+		_localInputs.pop_front();
+	}
+}
+
+void RollbackManager::UpdateSpeed()
+{
+	//Run at maximum speed when the client is behind the host, until it catches up
+	uint32_t bufferedInputs = 0;
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		if(_confirmedCount[i] > _pollCount[i]) {
+			bufferedInputs = std::max(bufferedInputs, _confirmedCount[i] - _pollCount[i]);
+		}
+	}
+
+	if(bufferedInputs > RollbackManager::MaxBufferedInputs) {
+		if(!_catchingUp) {
+			_catchingUp = true;
+			_emu->GetSettings()->SetMaxSpeedOverride(MaxSpeedOverride::NetplayCatchUp, true);
+		}
+	} else if(_catchingUp) {
+		_catchingUp = false;
+		_emu->GetSettings()->SetMaxSpeedOverride(MaxSpeedOverride::NetplayCatchUp, false);
+	}
+}
+
+RollbackStats RollbackManager::GetStats()
+{
+	RollbackStats stats = _stats;
+	stats.InputDelay = _inputDelay;
+	stats.AvgRollbackDepth = stats.RollbackCount ? _totalRollbackDepth / stats.RollbackCount : 0;
+	stats.AvgRollbackTime = stats.RollbackCount ? _totalRollbackTime / stats.RollbackCount : 0;
+	stats.AvgSnapshotTime = stats.FrameCount ? _totalSnapshotTime / stats.FrameCount : 0;
+	return stats;
+}
+
+string RollbackManager::GetStatsText()
+{
+	RollbackStats stats = GetStats();
+	std::stringstream ss;
+	ss << "Rollback: " << stats.RollbackCount << " (avg " << std::fixed << std::setprecision(1) << stats.AvgRollbackDepth << ", max " << stats.MaxRollbackDepth << " frames), input delay: " << stats.InputDelay;
+	return ss.str();
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include "pch.h"
+#include <deque>
+#include <mutex>
+#include "Shared/BaseControlDevice.h"
+#include "Shared/ControlDeviceState.h"
+#include "Shared/Interfaces/IInputProvider.h"
+#include "Utilities/AutoResetEvent.h"
+
+class Emulator;
+
+struct RollbackStats
+{
+	uint32_t FrameCount;
+	uint32_t PredictedFrameCount;
+	uint32_t RollbackCount;
+	uint32_t MaxRollbackDepth;
+	double AvgRollbackDepth;
+	uint32_t StallCount;
+	uint32_t LateInputCount;
+	uint32_t InputDelay;
+
+	double AvgSnapshotTime;
+	double AvgRollbackTime;
+	double MaxRollbackTime;
+};
+
+//Rollback mode for netplay clients
+//Instead of waiting for the host's input before running each frame, the client uses the local player's input right away,
+//predicts the other players' input (by repeating the last input received for each controller) and keeps running.
+//The console's state is saved at the start of every frame, and when the host's input doesn't match the prediction,
+//the console is rolled back to the frame where the misprediction occurred and the following frames are emulated again
+//with the correct input (without audio/video output, like run-ahead frames).
+//The host's input stream has no frame numbers: the Nth input received for a port is the input for the Nth time that port
+//is polled, counting from the last state sync (Start). The host also echoes the local player's input.
+//The local player's input is stamped with the frame it will be used on (a few frames after the current frame) and sent to
+//the host, which applies it on that same frame, so the host's echo matches the input the client used. When the input
+//reaches the host too late, the host applies it on its current frame and the client rolls back when it receives the echo.
+//The delay adapts to the connection: it's increased when inputs reach the host too late, and slowly reduced otherwise.
+class RollbackManager : public IInputProvider
+{
+private:
+	//The client stops and waits for the host if it gets more than this many frames ahead of the host's input
+	static constexpr uint32_t MaxPredictionFrames = 8;
+	static constexpr uint32_t SnapshotCount = MaxPredictionFrames + 2;
+
+	//Runs at maximum speed when this many inputs are already available ahead of the current frame (catch up to the host)
+	static constexpr uint32_t MaxBufferedInputs = 3;
+
+	//Number of frames between the frame at which the local player's input is sampled and the frame it's used on
+	static constexpr uint32_t InitialInputDelay = 2;
+	static constexpr uint32_t MaxInputDelay = MaxPredictionFrames;
+
+	//The delay is increased at most once every 10 frames (inputs sent before the increase can also be late),
+	//and decreased after 10 seconds without late inputs
+	static constexpr uint32_t DelayIncreaseInterval = 10;
+	static constexpr uint32_t DelayDecreaseInterval = 600;
+
+	struct InputEntry
+	{
+		ControlDeviceState State;
+		uint32_t Frame = 0;
+		bool Confirmed = false;
+		bool Used = false;
+	};
+
+	struct LocalInput
+	{
+		uint32_t FrameCount = 0;
+		ControlDeviceState State;
+	};
+
+	struct Snapshot
+	{
+		bool Valid = false;
+		uint32_t Frame = 0;
+		uint32_t FrameCount = 0;
+		uint32_t PollCount[BaseControlDevice::PortCount] = {};
+		stringstream State;
+	};
+
+	Emulator* _emu = nullptr;
+	atomic<bool> _enabled;
+
+	//Shared with the thread that receives the host's input
+	std::mutex _inputLock;
+	AutoResetEvent _inputReceived;
+	std::deque<InputEntry> _inputs[BaseControlDevice::PortCount];
+	uint32_t _inputStart[BaseControlDevice::PortCount] = {};
+	uint32_t _confirmedCount[BaseControlDevice::PortCount] = {};
+	ControlDeviceState _lastConfirmedState[BaseControlDevice::PortCount] = {};
+	uint32_t _pollCount[BaseControlDevice::PortCount] = {};
+	int64_t _mispredictedPoll[BaseControlDevice::PortCount] = {};
+	uint8_t _localPort = BaseControlDevice::PortCount;
+	ControllerType _localType = ControllerType::None;
+
+	//Local player's inputs, stamped with the emulator frame count at which they start being used
+	std::deque<LocalInput> _localInputs;
+	uint32_t _inputDelay = InitialInputDelay;
+	uint32_t _lastDelayChange = 0;
+	uint32_t _lastLateInput = 0;
+
+	//Emulator frame count at the start of the last frame that was emulated (excluding frames emulated again after a rollback)
+	uint32_t _frameCount = 0;
+
+	uint32_t _frame = 0;
+	Snapshot _snapshots[SnapshotCount];
+	bool _catchingUp = false;
+
+	RollbackStats _stats = {};
+	double _totalRollbackDepth = 0;
+	double _totalRollbackTime = 0;
+	double _totalSnapshotTime = 0;
+
+	InputEntry& GetInputEntry(uint8_t port, uint32_t pollIndex);
+	LocalInput* GetLocalInput(uint32_t frameCount);
+	void UpdateInputDelay(bool lateInput);
+	int64_t GetRollbackFrame();
+	bool CanRunFrame();
+	void LoadSnapshot(Snapshot& snapshot);
+	void TrimInputs();
+	void UpdateSpeed();
+
+public:
+	RollbackManager(Emulator* emu);
+
+	void Start();
+	void Stop();
+	bool IsEnabled() { return _enabled; }
+
+	//Called when the host's input for the next poll of the port is received
+	void AddInput(uint8_t port, ControlDeviceState state);
+
+	//Called when the local player's input changes, used as is for the local player's port (instead of being predicted)
+	//when the port's device is the local player's controller (i.e not a multitap, etc.)
+	//Returns the frame (emulator frame count) the input will be used on, the host must apply it on the same frame
+	uint32_t SetLocalInput(uint8_t port, ControllerType type, ControlDeviceState state);
+
+	bool SetInput(BaseControlDevice* device) override;
+
+	//Waits (up to the timeout) until the client is allowed to run another frame without exceeding the prediction window
+	bool WaitForInput(int timeout);
+
+	//Rolls back and re-emulates the frames that used mispredicted input, must be called before BeginFrame
+	void ProcessRollback();
+
+	void BeginFrame();
+	void EndFrame();
+
+	RollbackStats GetStats();
+	string GetStatsText();
+};
@@ -1,48 +1,149 @@
 #pragma once
 #include "pch.h"
+#include <cstring>
 #include "Netplay/NetMessage.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/CheatManager.h"
 #include "Shared/SaveStateManager.h"
+#include "Utilities/CRC32.h"
+
+//Uncompressed save state (and cheats) sent by the host
+//The last state received by a client is used as the baseline for the next one: only the chunks that changed are sent
+struct NetplayState
+{
+	uint32_t Id = 0;
+	vector<uint8_t> Data;
+	vector<CheatCode> Cheats;
+};
 
 class SaveStateMessage : public NetMessage
 {
 private:
+	static constexpr uint32_t ChunkSize = 0x1000;
+
 	vector<CheatCode> _activeCheats;
-	vector<uint8_t> _stateData;
+	uint32_t _stateId = 0;
+	uint32_t _baselineId = 0;
+	uint32_t _stateSize = 0;
+	vector<uint32_t> _chunkHashes;
+	vector<uint32_t> _chunkIndexes;
+	vector<uint8_t> _chunkData;
 
 protected:
 	void Serialize(Serializer &s) override
 	{
-		SVVector(_stateData);
+		SV(_stateId);
+		SV(_baselineId);
+		SV(_stateSize);
+		SVVector(_chunkHashes);
+		SVVector(_chunkIndexes);
+		SVVector(_chunkData);
 		SVVector(_activeCheats);
 	}
 
+	static uint32_t GetChunkLength(uint32_t stateSize, uint32_t index)
+	{
+		return std::min(ChunkSize, stateSize - index * ChunkSize);
+	}
+
 public:
 	SaveStateMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) { }
-	
-	SaveStateMessage(Emulator* emu) : NetMessage(MessageType::SaveState)
+
+	SaveStateMessage(NetplayState& state, NetplayState* baseline) : NetMessage(MessageType::SaveState)
+	{
+		//Used when sending state to clients - chunks that are identical in the client's baseline state are not sent
+		//(the whole message is compressed when it's sent)
+		_stateId = state.Id;
+		_baselineId = baseline ? baseline->Id : 0;
+		_stateSize = (uint32_t)state.Data.size();
+		_activeCheats = state.Cheats;
+
+		uint32_t chunkCount = (_stateSize + ChunkSize - 1) / ChunkSize;
+		for(uint32_t i = 0; i < chunkCount; i++) {
+			uint8_t* chunk = state.Data.data() + i * ChunkSize;
+			uint32_t length = GetChunkLength(_stateSize, i);
+			_chunkHashes.push_back(CRC32::GetCRC(chunk, length));
+
+			bool inBaseline = baseline && baseline->Data.size() >= (size_t)i * ChunkSize + length && memcmp(baseline->Data.data() + i * ChunkSize, chunk, length) == 0;
+			if(!inBaseline) {
+				_chunkIndexes.push_back(i);
+				_chunkData.insert(_chunkData.end(), chunk, chunk + length);
+			}
+		}
+	}
+
+	static shared_ptr<NetplayState> CaptureState(Emulator* emu)
 	{
-		//Used when sending state to clients
-		stringstream state;
+		//Only the serialization is done while the emulation is paused, the state is compressed later by the server thread
+		shared_ptr<NetplayState> state(new NetplayState());
+		stringstream out;
 		{
 			auto lock = emu->AcquireLock();
-			_activeCheats = emu->GetCheatManager()->GetCheats();
-			emu->Serialize(state, true);
+			state->Cheats = emu->GetCheatManager()->GetCheats();
+			emu->Serialize(out, true, 0);
 		}
 
-		uint32_t dataSize = (uint32_t)state.tellp();
-		_stateData.resize(dataSize);
-		state.read((char*)_stateData.data(), dataSize);
+		string data = out.str();
+		state->Data = vector<uint8_t>(data.begin(), data.end());
+		return state;
+	}
+
+	uint32_t GetStateId()
+	{
+		return _stateId;
 	}
-	
-	void LoadState(Emulator* emu)
+
+	bool IsDelta()
+	{
+		return _baselineId != 0;
+	}
+
+	//Rebuilds the state from the chunks received and the client's baseline, and validates each chunk's hash
+	bool GetState(NetplayState& baseline, NetplayState& state)
+	{
+		if(IsDelta() && baseline.Id != _baselineId) {
+			return false;
+		}
+
+		uint32_t chunkCount = (_stateSize + ChunkSize - 1) / ChunkSize;
+		if(_chunkHashes.size() != chunkCount) {
+			return false;
+		}
+
+		state.Id = _stateId;
+		state.Cheats = _activeCheats;
+		state.Data = IsDelta() ? baseline.Data : vector<uint8_t>();
+		state.Data.resize(_stateSize);
+
+		size_t dataPos = 0;
+		for(uint32_t index : _chunkIndexes) {
+			if(index >= chunkCount) {
+				return false;
+			}
+			uint32_t length = GetChunkLength(_stateSize, index);
+			if(dataPos + length > _chunkData.size()) {
+				return false;
+			}
+			memcpy(state.Data.data() + index * ChunkSize, _chunkData.data() + dataPos, length);
+			dataPos += length;
+		}
+
+		for(uint32_t i = 0; i < chunkCount; i++) {
+			if(CRC32::GetCRC(state.Data.data() + i * ChunkSize, GetChunkLength(_stateSize, i)) != _chunkHashes[i]) {
+				//The client's baseline doesn't match the host's
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void LoadState(Emulator* emu, NetplayState& state)
 	{
 		std::stringstream ss;
-		ss.write((char*)_stateData.data(), _stateData.size());
+		ss.write((char*)state.Data.data(), state.Data.size());
 		emu->Deserialize(ss, SaveStateManager::FileFormatVersion, true);
 
-		emu->GetCheatManager()->SetCheats(_activeCheats);
+		emu->GetCheatManager()->SetCheats(state.Cheats);
 	}
 };
\ No newline at end of file
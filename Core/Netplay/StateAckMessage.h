@@ -0,0 +1,37 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/NetMessage.h"
+
+class StateAckMessage : public NetMessage
+{
+private:
+	uint32_t _stateId = 0;
+	bool _stateLoaded = false;
+
+protected:
+	void Serialize(Serializer &s) override
+	{
+		SV(_stateId);
+		SV(_stateLoaded);
+	}
+
+public:
+	StateAckMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) { }
+
+	StateAckMessage(uint32_t stateId, bool stateLoaded) : NetMessage(MessageType::StateAck)
+	{
+		_stateId = stateId;
+		_stateLoaded = stateLoaded;
+	}
+
+	uint32_t GetStateId()
+	{
+		return _stateId;
+	}
+
+	//False when the state couldn't be rebuilt from the client's baseline (the host needs to send the full state)
+	bool IsStateLoaded()
+	{
+		return _stateLoaded;
+	}
+};
\ No newline at end of file
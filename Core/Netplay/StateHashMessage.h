@@ -0,0 +1,36 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/NetMessage.h"
+
+class StateHashMessage : public NetMessage
+{
+private:
+	uint32_t _frame = 0;
+	uint32_t _hash = 0;
+
+protected:
+	void Serialize(Serializer &s) override
+	{
+		SV(_frame);
+		SV(_hash);
+	}
+
+public:
+	StateHashMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) { }
+
+	StateHashMessage(uint32_t frame, uint32_t hash) : NetMessage(MessageType::StateHash)
+	{
+		_frame = frame;
+		_hash = hash;
+	}
+
+	uint32_t GetFrame()
+	{
+		return _frame;
+	}
+
+	uint32_t GetHash()
+	{
+		return _hash;
+	}
+};
\ No newline at end of file
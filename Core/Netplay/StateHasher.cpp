@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "Netplay/StateHasher.h"
+#include "Shared/Emulator.h"
+#include "Debugger/DebugUtilities.h"
+#include "Utilities/CRC32.h"
+
+StateHasher::StateHasher(Emulator* emu)
+{
+	_emu = emu;
+}
+
+void StateHasher::Reset()
+{
+	_regions.clear();
+	_totalSize = 0;
+	_initialized = false;
+	_periodValid = false;
+}
+
+void StateHasher::InitRegions()
+{
+	//Hash all of the console's memory, except roms and the cpu address spaces (which are mapped onto the other memory types)
+	for(int i = (int)DebugUtilities::GetLastCpuMemoryType() + 1; i < (int)MemoryType::None; i++) {
+		MemoryType memType = (MemoryType)i;
+		if(DebugUtilities::IsRom(memType)) {
+			continue;
+		}
+
+		ConsoleMemoryInfo memInfo = _emu->GetMemory(memType);
+		if(memInfo.Memory && memInfo.Size > 0) {
+			_regions.push_back({ (uint8_t*)memInfo.Memory, memInfo.Size });
+			_totalSize += memInfo.Size;
+		}
+	}
+	_initialized = true;
+}
+
+void StateHasher::HashRange(uint64_t start, uint64_t end)
+{
+	uint64_t regionStart = 0;
+	for(MemoryRegion& region : _regions) {
+		uint64_t regionEnd = regionStart + region.Size;
+		if(regionEnd > start && regionStart < end) {
+			uint64_t from = std::max(start, regionStart) - regionStart;
+			uint64_t to = std::min(end, regionEnd) - regionStart;
+			uint32_t crc = CRC32::GetCRC(region.Memory + from, (std::streamoff)(to - from));
+			_hash = (_hash ^ crc) * 0x01000193;
+		}
+		regionStart = regionEnd;
+	}
+}
+
+bool StateHasher::ProcessFrame(uint32_t frameCount, uint32_t& hash)
+{
+	if(!_initialized) {
+		InitRegions();
+	}
+
+	uint32_t slice = frameCount % StateHasher::HashInterval;
+	if(slice == 0) {
+		_hash = 0x811C9DC5;
+		_periodValid = true;
+	} else if(frameCount != _lastFrame + 1) {
+		//Frames were skipped (or emulated again), wait until the next period starts
+		_periodValid = false;
+	}
+	_lastFrame = frameCount;
+
+	if(!_periodValid || _totalSize == 0) {
+		return false;
+	}
+
+	HashRange(_totalSize * slice / StateHasher::HashInterval, _totalSize * (slice + 1) / StateHasher::HashInterval);
+
+	if(slice == StateHasher::HashInterval - 1) {
+		hash = _hash;
+		_periodValid = false;
+		return true;
+	}
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+#include "pch.h"
+
+class Emulator;
+
+//Computes a hash of the console's memory (work ram, video ram, audio ram, save ram, etc.) over a period of frames, used to detect
+//desyncs between the netplay host and its clients. A slice of the memory is hashed at the end of each frame, to spread the cost
+//evenly over the period (no serialization is needed). The hash only covers the frames emulated consecutively since the period
+//started - periods interrupted by a state load, etc. produce no hash.
+class StateHasher
+{
+public:
+	static constexpr uint32_t HashInterval = 60;
+
+private:
+	struct MemoryRegion
+	{
+		uint8_t* Memory;
+		uint32_t Size;
+	};
+
+	Emulator* _emu = nullptr;
+	vector<MemoryRegion> _regions;
+	uint64_t _totalSize = 0;
+	bool _initialized = false;
+
+	uint32_t _hash = 0;
+	bool _periodValid = false;
+	uint32_t _lastFrame = 0;
+
+	void InitRegions();
+	void HashRange(uint64_t start, uint64_t end);
+
+public:
+	StateHasher(Emulator* emu);
+
+	//Must be called when a game is loaded
+	void Reset();
+
+	//Called at the end of each frame, returns true (and the hash) on the last frame of a period
+	bool ProcessFrame(uint32_t frameCount, uint32_t& hash);
+
+	uint64_t GetHashedSize() { return _totalSize; }
+};
\ No newline at end of file
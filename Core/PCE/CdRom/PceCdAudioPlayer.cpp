@@ -50,8 +50,13 @@ void PceCdAudioPlayer::SetEndPosition(uint32_t endSector, CdPlayEndBehavior endB
 void PceCdAudioPlayer::PlaySample()
 {
 	if(_state.Status == CdAudioStatus::Playing) {
-		_state.LeftSample = _disc->ReadLeftSample(_state.CurrentSector, _state.CurrentSample);
-		_state.RightSample = _disc->ReadRightSample(_state.CurrentSector, _state.CurrentSample);
+		if(_bufferedSector != _state.CurrentSector) {
+			_disc->ReadAudioSector(_state.CurrentSector, _sectorSamples);
+			_bufferedSector = _state.CurrentSector;
+		}
+
+		_state.LeftSample = _sectorSamples[_state.CurrentSample * 2];
+		_state.RightSample = _sectorSamples[_state.CurrentSample * 2 + 1];
 		_samplesToPlay.push_back(_state.LeftSample);
 		_samplesToPlay.push_back(_state.RightSample);
 		_state.CurrentSample++;
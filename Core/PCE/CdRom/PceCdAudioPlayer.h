@@ -24,6 +24,10 @@ class PceCdAudioPlayer final : public IAudioProvider, public ISerializable
 	uint32_t _subcodeSector = 0;
 	uint32_t _nextSubcodeSector = 0;
 	uint32_t _seekDelay = 0;
+
+	//Decoded samples for the sector that's currently playing (not saved in save states, reloaded from the disc as needed)
+	int16_t _sectorSamples[588 * 2] = {};
+	int64_t _bufferedSector = -1;
 	
 	HermiteResampler _resampler;
 	
@@ -94,6 +94,7 @@ void PceDebugger::ResetPrevOpCode()
 	_prevOpCode = 0x01;
 }
 
+template<uint8_t hooks>
 void PceDebugger::ProcessInstruction()
 {
 	PceCpuState& state = _cpu->GetState();
@@ -106,8 +107,10 @@ void PceDebugger::ProcessInstruction()
 
 	bool needDisassemble = _traceLogger->IsEnabled() || _settings->CheckDebuggerFlag(DebuggerFlags::PceDebuggerEnabled);
 	if(addressInfo.Address >= 0) {
-		if(addressInfo.Type == MemoryType::PcePrgRom) {
-			_codeDataLogger->SetCode(addressInfo.Address, PceDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::PcePrgRom) {
+				_codeDataLogger->SetCode(addressInfo.Address, PceDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+			}
 		}
 		if(needDisassemble) {
 			_disassembler->BuildCache(addressInfo, 0, CpuType::Pce);
@@ -120,71 +123,90 @@ void PceDebugger::ProcessInstruction()
 	_prevProgramCounter = pc;
 	_prevStackPointer = state.SP;
 
-	_step->ProcessCpuExec();
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
 
-	if(_settings->CheckDebuggerFlag(DebuggerFlags::PceDebuggerEnabled)) {
-		if(opCode == 0x00 && _settings->GetDebugConfig().PceBreakOnBrk) {
-			_step->Break(BreakSource::BreakOnBrk);
-		} else if(_settings->GetDebugConfig().PceBreakOnUnofficialOpCode && PceDisUtils::IsOpUnofficial(opCode)) {
-			_step->Break(BreakSource::BreakOnUnofficialOpCode);
+		if(_settings->CheckDebuggerFlag(DebuggerFlags::PceDebuggerEnabled)) {
+			if(opCode == 0x00 && _settings->GetDebugConfig().PceBreakOnBrk) {
+				_step->Break(BreakSource::BreakOnBrk);
+			} else if(_settings->GetDebugConfig().PceBreakOnUnofficialOpCode && PceDisUtils::IsOpUnofficial(opCode)) {
+				_step->Break(BreakSource::BreakOnUnofficialOpCode);
+			}
 		}
-	}
 	
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(_cpu->GetState());
-		_dummyCpu->Exec();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _memoryManager->GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(CpuType::Pce, _breakpointManager.get(), memOp, absAddr);
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
+			_dummyCpu->SetDummyState(_cpu->GetState());
+			_dummyCpu->Exec();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _memoryManager->GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Pce, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
+template<uint8_t hooks>
 void PceDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _memoryManager->GetAbsoluteAddress(addr);
 	MemoryOperationInfo operation(addr, value, type, MemoryType::PceMemory);
 	InstructionProgress.LastMemOperation = operation;
 
-	if(IsRegister(operation)) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(IsRegister(operation)) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
 	if(type == MemoryOperationType::ExecOpCode) {
-		if(_traceLogger->IsEnabled()) {
-			PceCpuState& state = _cpu->GetState();
-			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, state.PS, CpuType::Pce);
-			_traceLogger->Log(state, disInfo, operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				PceCpuState& state = _cpu->GetState();
+				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, state.PS, CpuType::Pce);
+				_traceLogger->Log(state, disInfo, operation, addressInfo);
+			}
 		}
 
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetState().CycleCount);
-		if(_step->ProcessCpuCycle()) {
-			_debugger->SleepUntilResume(CpuType::Pce, BreakSource::CpuStep, &operation);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->ProcessCpuCycle()) {
+				_debugger->SleepUntilResume(CpuType::Pce, BreakSource::CpuStep, &operation);
+			}
 		}
 	} else if(type == MemoryOperationType::ExecOperand) {
-		if(addressInfo.Type == MemoryType::PcePrgRom && addressInfo.Address >= 0) {
-			_codeDataLogger->SetCode(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::PcePrgRom && addressInfo.Address >= 0) {
+				_codeDataLogger->SetCode(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetState().CycleCount);
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	} else {
-		if(addressInfo.Type == MemoryType::PcePrgRom && addressInfo.Address >= 0 && operation.Type != MemoryOperationType::DummyRead) {
-			_codeDataLogger->SetData(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::PcePrgRom && addressInfo.Address >= 0 && operation.Type != MemoryOperationType::DummyRead) {
+				_codeDataLogger->SetData(addressInfo.Address);
+			}
 		}
 		
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetState().CycleCount);
@@ -194,15 +216,20 @@ void PceDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 				//Only warn the first time
 				_debugger->Log("[CPU] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
 			}
-			if(_settings->CheckDebuggerFlag(DebuggerFlags::PceDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-				_step->Break(BreakSource::BreakOnUninitMemoryRead);
+			if constexpr(hooks & DebugHookFlags::BreakChecks) {
+				if(_settings->CheckDebuggerFlag(DebuggerFlags::PceDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				}
 			}
 		}
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	}
 }
 
+template<uint8_t hooks>
 void PceDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _memoryManager->GetAbsoluteAddress(addr);
@@ -213,17 +240,23 @@ void PceDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_disassembler->InvalidateCache(addressInfo, CpuType::Pce);
 	}
 
-	if(IsRegister(operation)) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(IsRegister(operation)) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetState().CycleCount);
-	_step->ProcessCpuCycle();
-	_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuCycle();
+		_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
 void PceDebugger::ProcessIdleCycle()
@@ -493,3 +526,11 @@ void PceDebugger::ProcessInputOverrides(DebugControllerState inputOverrides[8])
 	}
 	controlManager->RefreshHubState();
 }
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void PceDebugger::ProcessInstruction<hooks>(); \
+	template void PceDebugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void PceDebugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
@@ -21,6 +21,7 @@
 #include "Utilities/CRC32.h"
 #include "Shared/MemoryType.h"
 #include "Shared/FirmwareHelper.h"
+#include "Shared/CompressedDiscImage.h"
 
 PceConsole::PceConsole(Emulator* emu)
 {
@@ -52,9 +53,10 @@ LoadRomResult PceConsole::LoadRom(VirtualFile& romFile)
 			return LoadRomResult::Failure;
 		}
 		romData = _hesData->RomData;
-	} else if(romFile.GetFileExtension() == ".cue") {
+	} else if(romFile.GetFileExtension() == ".cue" || romFile.GetFileExtension() == CompressedDiscImage::Extension) {
 		DiscInfo disc = {};
-		if(!CdReader::LoadCue(romFile, disc)) {
+		bool loaded = romFile.GetFileExtension() == ".cue" ? CdReader::LoadCue(romFile, disc) : CdReader::LoadCompressedImage(romFile, disc);
+		if(!loaded) {
 			return LoadRomResult::Failure;
 		}
 
@@ -47,7 +47,7 @@ public:
 	PceConsole(Emulator* emu);
 	virtual ~PceConsole();
 	
-	static vector<string> GetSupportedExtensions() { return { ".pce", ".cue", ".sgx", ".hes" }; }
+	static vector<string> GetSupportedExtensions() { return { ".pce", ".cue", ".cdz", ".sgx", ".hes" }; }
 	static vector<string> GetSupportedSignatures() { return { "HESM" }; }
 
 	void Serialize(Serializer& s) override;
@@ -80,6 +80,7 @@ void SmsDebugger::Reset()
 	ResetPrevOpCode();
 }
 
+template<uint8_t hooks>
 void SmsDebugger::ProcessInstruction()
 {
 	SmsCpuState& state = _cpu->GetState();
@@ -91,18 +92,22 @@ void SmsDebugger::ProcessInstruction()
 	InstructionProgress.StartCycle = state.CycleCount;
 
 	if(addressInfo.Address >= 0) {
-		if(addressInfo.Type == MemoryType::SmsPrgRom) {
-			_codeDataLogger->SetCode(addressInfo.Address, SmsDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::SmsPrgRom) {
+				_codeDataLogger->SetCode(addressInfo.Address, SmsDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter));
+			}
 		}
 		_disassembler->BuildCache(addressInfo, 0, CpuType::Sms);
 	}
 
 	ProcessCallStackUpdates(addressInfo, pc, state.SP);
 
-	if(_settings->CheckDebuggerFlag(DebuggerFlags::SmsDebuggerEnabled)) {
-		if(value == 0x40 && _settings->GetDebugConfig().SmsBreakOnNopLoad) {
-			//Break on ld b, b
-			_step->Break(BreakSource::SmsNopLoad);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		if(_settings->CheckDebuggerFlag(DebuggerFlags::SmsDebuggerEnabled)) {
+			if(value == 0x40 && _settings->GetDebugConfig().SmsBreakOnNopLoad) {
+				//Break on ld b, b
+				_step->Break(BreakSource::SmsNopLoad);
+			}
 		}
 	}
 
@@ -114,23 +119,26 @@ void SmsDebugger::ProcessInstruction()
 	_prevProgramCounter = pc;
 	_prevStackPointer = state.SP;
 
-	_step->ProcessCpuExec();
-
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _console->GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(CpuType::Sms, _breakpointManager.get(), memOp, absAddr);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
+
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
+			_dummyCpu->SetDummyState(state);
+			_dummyCpu->Exec();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _console->GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Sms, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
+template<uint8_t hooks>
 void SmsDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _console->GetAbsoluteAddress(addr);
@@ -138,33 +146,47 @@ void SmsDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 	InstructionProgress.LastMemOperation = operation;
 
 	if(type == MemoryOperationType::ExecOpCode) {
-		if(_traceLogger->IsEnabled()) {
-			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Sms);
-			_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Sms);
+				_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
+			}
 		}
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _console->GetMasterClock());
-		if(_step->ProcessCpuCycle()) {
-			_debugger->SleepUntilResume(CpuType::Sms, BreakSource::CpuStep, &operation);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->ProcessCpuCycle()) {
+				_debugger->SleepUntilResume(CpuType::Sms, BreakSource::CpuStep, &operation);
+			}
 		}
 	} else if(type == MemoryOperationType::ExecOperand) {
-		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::SmsPrgRom) {
-			_codeDataLogger->SetCode(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::SmsPrgRom) {
+				_codeDataLogger->SetCode(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _console->GetMasterClock());
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	} else {
-		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::SmsPrgRom) {
-			_codeDataLogger->SetData(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::SmsPrgRom) {
+				_codeDataLogger->SetData(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		if(addr < 0xFE00 || addr >= 0xFF80) {
@@ -175,17 +197,22 @@ void SmsDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 					//Only warn the first time
 					_debugger->Log("[SMS] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
 				}
-				if(_settings->CheckDebuggerFlag(DebuggerFlags::SmsDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				if constexpr(hooks & DebugHookFlags::BreakChecks) {
+					if(_settings->CheckDebuggerFlag(DebuggerFlags::SmsDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+						_step->Break(BreakSource::BreakOnUninitMemoryRead);
+					}
 				}
 			}
 		}
 
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	}
 }
 
+template<uint8_t hooks>
 void SmsDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _console->GetAbsoluteAddress(addr);
@@ -196,13 +223,17 @@ void SmsDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_disassembler->InvalidateCache(addressInfo, CpuType::Sms);
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
-	_step->ProcessCpuCycle();
-	_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuCycle();
+		_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
 template<MemoryOperationType opType>
@@ -487,3 +518,11 @@ void SmsDebugger::ProcessInputOverrides(DebugControllerState inputOverrides[8])
 
 template void SmsDebugger::ProcessMemoryAccess<MemoryOperationType::Read>(uint32_t addr, uint8_t value, MemoryType memType);
 template void SmsDebugger::ProcessMemoryAccess<MemoryOperationType::Write>(uint32_t addr, uint8_t value, MemoryType memType);
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void SmsDebugger::ProcessInstruction<hooks>(); \
+	template void SmsDebugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void SmsDebugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
@@ -60,9 +60,9 @@ public:
 	void OnBeforeBreak(CpuType cpuType) override;
 	void Reset() override;
 
-	void ProcessInstruction();
-	void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
-	void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessInstruction();
+	template<uint8_t hooks> void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
 
 	template<MemoryOperationType opType>
 	void ProcessMemoryAccess(uint32_t addr, uint8_t value, MemoryType memType);
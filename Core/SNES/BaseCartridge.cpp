@@ -33,6 +33,7 @@
 #include "Utilities/Serializer.h"
 #include "Utilities/sha1.h"
 #include "Utilities/CRC32.h"
+#include "Utilities/Timer.h"
 #include "Shared/FirmwareHelper.h"
 
 BaseCartridge::~BaseCartridge()
@@ -785,6 +786,31 @@ ConsoleRegion BaseCartridge::GetRegion()
 	return ConsoleRegion::Ntsc;
 }
 
+string BaseCartridge::GetCoprocessorName()
+{
+	switch(_coprocessorType) {
+		case CoprocessorType::None: return "<none>";
+		case CoprocessorType::CX4: return "CX4";
+		case CoprocessorType::SDD1: return "S-DD1";
+		case CoprocessorType::DSP1: return "DSP1";
+		case CoprocessorType::DSP1B: return "DSP1B";
+		case CoprocessorType::DSP2: return "DSP2";
+		case CoprocessorType::DSP3: return "DSP3";
+		case CoprocessorType::DSP4: return "DSP4";
+		case CoprocessorType::GSU: return "Super FX (GSU1/2)";
+		case CoprocessorType::OBC1: return "OBC1";
+		case CoprocessorType::RTC: return "RTC";
+		case CoprocessorType::SA1: return "SA1";
+		case CoprocessorType::Satellaview: return "Satellaview";
+		case CoprocessorType::SPC7110: return "SPC7110";
+		case CoprocessorType::ST010: return "ST010";
+		case CoprocessorType::ST011: return "ST011";
+		case CoprocessorType::ST018: return "ST018";
+		case CoprocessorType::SGB: return "Super Game Boy";
+	}
+	return "";
+}
+
 void BaseCartridge::DisplayCartInfo(bool showCorruptedHeaderWarning)
 {
 	MessageManager::Log("-----------------------------");
@@ -811,28 +837,7 @@ void BaseCartridge::DisplayCartInfo(bool showCorruptedHeaderWarning)
 	}
 
 	if(_coprocessorType != CoprocessorType::None) {
-		string coProcMessage = "Coprocessor: ";
-		switch(_coprocessorType) {
-			case CoprocessorType::None: coProcMessage += "<none>"; break;
-			case CoprocessorType::CX4: coProcMessage += "CX4"; break;
-			case CoprocessorType::SDD1: coProcMessage += "S-DD1"; break;
-			case CoprocessorType::DSP1: coProcMessage += "DSP1"; break;
-			case CoprocessorType::DSP1B: coProcMessage += "DSP1B"; break;
-			case CoprocessorType::DSP2: coProcMessage += "DSP2"; break;
-			case CoprocessorType::DSP3: coProcMessage += "DSP3"; break;
-			case CoprocessorType::DSP4: coProcMessage += "DSP4"; break;
-			case CoprocessorType::GSU: coProcMessage += "Super FX (GSU1/2)"; break;
-			case CoprocessorType::OBC1: coProcMessage += "OBC1"; break;
-			case CoprocessorType::RTC: coProcMessage += "RTC"; break;
-			case CoprocessorType::SA1: coProcMessage += "SA1"; break;
-			case CoprocessorType::Satellaview: coProcMessage += "Satellaview"; break;
-			case CoprocessorType::SPC7110: coProcMessage += "SPC7110"; break;
-			case CoprocessorType::ST010: coProcMessage += "ST010"; break;
-			case CoprocessorType::ST011: coProcMessage += "ST011"; break;
-			case CoprocessorType::ST018: coProcMessage += "ST018"; break;
-			case CoprocessorType::SGB: coProcMessage += "Super Game Boy"; break;
-		}
-		MessageManager::Log(coProcMessage);
+		MessageManager::Log("Coprocessor: " + GetCoprocessorName());
 	}
 
 	if(_flags & CartFlags::FastRom) {
@@ -931,10 +936,66 @@ Gameboy* BaseCartridge::GetGameboy()
 
 void BaseCartridge::RunCoprocessors()
 {
+	if(_needCoprocSync && _coprocessor->IsIdle()) {
+		//Idle coprocessors aren't synced after every cycle, catch up to the current cycle
+		_coprocessor->Run();
+	}
+
 	//These coprocessors are run at the end of the frame, or as needed
 	if(_necDsp) {
-		_necDsp->Run();
+		if(_profileCoprocessors) {
+			Timer timer;
+			_necDsp->Run();
+			_coprocTimings.EndOfFrameTime += timer.GetElapsedMS();
+		} else {
+			_necDsp->Run();
+		}
+	}
+}
+
+void BaseCartridge::ProfileCoprocessorSync()
+{
+	if(_coprocessor->IsIdle()) {
+		_coprocTimings.IdleSyncCount++;
+		return;
+	}
+
+	_coprocTimings.SyncCount++;
+	if((_coprocTimings.SyncCount & (CoprocSampleRate - 1)) == 0) {
+		Timer timer;
+		_coprocessor->Run();
+		_coprocTimings.SampledSyncTime += timer.GetElapsedMS();
+	} else {
+		_coprocessor->Run();
+	}
+}
+
+void BaseCartridge::UpdateCoprocessorStats(bool enabled)
+{
+	_lastFrameCoprocTimings = _coprocTimings;
+	_coprocTimings = {};
+	_profileCoprocessors = enabled && (_needCoprocSync || _necDsp);
+}
+
+vector<string> BaseCartridge::GetCoprocessorStats()
+{
+	vector<string> stats;
+	if(!_profileCoprocessors) {
+		return stats;
+	}
+
+	CoprocessorTimings& timings = _lastFrameCoprocTimings;
+	std::stringstream ss;
+	ss << GetCoprocessorName() << ": " << std::fixed << std::setprecision(2);
+	if(_needCoprocSync) {
+		uint32_t totalSyncs = timings.SyncCount + timings.IdleSyncCount;
+		ss << (timings.SampledSyncTime * CoprocSampleRate) << " ms";
+		ss << " (active: " << (totalSyncs ? (timings.SyncCount * 100 / totalSyncs) : 0) << "%)";
+	} else {
+		ss << timings.EndOfFrameTime << " ms";
 	}
+	stats.push_back(ss.str());
+	return stats;
 }
 
 BaseCoprocessor* BaseCartridge::GetCoprocessor()
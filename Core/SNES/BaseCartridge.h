@@ -38,6 +38,20 @@ private:
 
 	bool _needCoprocSync = false;
 	unique_ptr<BaseCoprocessor> _coprocessor;
+
+	//Only 1 out of every CoprocSampleRate syncs is timed, to keep the timer's overhead low
+	static constexpr uint32_t CoprocSampleRate = 64;
+	struct CoprocessorTimings
+	{
+		uint32_t SyncCount;
+		uint32_t IdleSyncCount;
+		double SampledSyncTime;
+		double EndOfFrameTime;
+	};
+
+	bool _profileCoprocessors = false;
+	CoprocessorTimings _coprocTimings = {};
+	CoprocessorTimings _lastFrameCoprocTimings = {};
 	
 	NecDsp *_necDsp = nullptr;
 	Sa1 *_sa1 = nullptr;
@@ -98,6 +112,9 @@ private:
 
 	string GetCartName();
 	string GetGameCode();
+	string GetCoprocessorName();
+
+	void ProfileCoprocessorSync();
 
 public:
 	virtual ~BaseCartridge();
@@ -144,10 +161,17 @@ public:
 	__forceinline void SyncCoprocessors()
 	{
 		if(_needCoprocSync) {
-			_coprocessor->Run();
+			if(_profileCoprocessors) {
+				ProfileCoprocessorSync();
+			} else if(!_coprocessor->IsIdle()) {
+				_coprocessor->Run();
+			}
 		}
 	}
 
+	void UpdateCoprocessorStats(bool enabled);
+	vector<string> GetCoprocessorStats();
+
 	BaseCoprocessor* GetCoprocessor();
 
 	vector<unique_ptr<IMemoryHandler>>& GetPrgRomHandlers();
@@ -117,6 +117,10 @@ BsxMemoryPack::BsxMemoryPackHandler::BsxMemoryPackHandler(BsxMemoryPack* memPack
 {
 	_memPack = memPack;
 	_page = offset / 0x10000;
+
+	//Reads/writes are processed by the memory pack's command state machine
+	_directReadPtr = nullptr;
+	_directWritePtr = nullptr;
 }
 
 uint8_t BsxMemoryPack::BsxMemoryPackHandler::Read(uint32_t addr)
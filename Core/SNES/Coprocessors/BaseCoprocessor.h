@@ -6,9 +6,16 @@
 
 class BaseCoprocessor : public ISerializable, public IMemoryHandler
 {
+protected:
+	//Set when the coprocessor's state can't change until the CPU writes to it (e.g stopped/halted)
+	//Idle coprocessors aren't synced after every CPU cycle, they must call Run() to catch up before the CPU modifies their state
+	bool _idle = false;
+
 public:
 	BaseCoprocessor() : IMemoryHandler(MemoryType::SnesRegister) {}
 
+	__forceinline bool IsIdle() { return _idle; }
+
 	virtual void Reset() = 0;
 
 	virtual void Run() { }	
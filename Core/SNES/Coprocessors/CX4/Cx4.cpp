@@ -59,6 +59,7 @@ void Cx4::Reset()
 	_state.SingleRom = true;
 	_state.RomAccessDelay = 3;
 	_state.RamAccessDelay = 3;
+	_idle = false;
 }
 
 void Cx4::Run()
@@ -104,6 +105,8 @@ void Cx4::Run()
 			Exec(opCode);
 		}
 	}
+
+	_idle = _state.Stopped && !_state.Locked && !_state.Suspend.Enabled && !_state.Cache.Enabled && !_state.Dma.Enabled && !_state.Bus.Enabled;
 }
 
 void Cx4::Step(uint64_t cycles)
@@ -325,6 +328,12 @@ uint8_t Cx4::Read(uint32_t addr)
 
 void Cx4::Write(uint32_t addr, uint8_t value)
 {
+	if(_idle) {
+		//Catch up before the CPU modifies the CX4's state (Run will flag it as idle again if needed)
+		Run();
+		_idle = false;
+	}
+
 	addr = 0x7000 | (addr & 0xFFF);
 
 	if(addr <= 0x7BFF) {
@@ -431,6 +440,10 @@ bool Cx4::IsBusy()
 
 void Cx4::Serialize(Serializer &s)
 {
+	if(s.IsSaving() && _idle) {
+		Run();
+	}
+
 	SV(_state.CycleCount); SV(_state.PB); SV(_state.PC); SV(_state.A); SV(_state.P); SV(_state.SP); SV(_state.Mult); SV(_state.RomBuffer);
 	SV(_state.RamBuffer[0]); SV(_state.RamBuffer[1]); SV(_state.RamBuffer[2]); SV(_state.MemoryDataReg); SV(_state.MemoryAddressReg);
 	SV(_state.DataPointerReg); SV(_state.Negative); SV(_state.Zero); SV(_state.Carry); SV(_state.Overflow); SV(_state.IrqFlag); SV(_state.Stopped);
@@ -446,6 +459,10 @@ void Cx4::Serialize(Serializer &s)
 	SVArray(_prgRam[0], 256);
 	SVArray(_prgRam[1], 256);
 	SVArray(_dataRam, Cx4::DataRamSize);
+
+	if(!s.IsSaving()) {
+		_idle = false;
+	}
 }
 
 uint8_t Cx4::Peek(uint32_t addr)
@@ -97,6 +97,8 @@ void Gsu::Run()
 	if(targetCycle > _state.CycleCount) {
 		Step(targetCycle - _state.CycleCount);
 	}
+
+	_idle = _stopped && !_state.RomDelay && !_state.RamDelay;
 }
 
 void Gsu::Exec()
@@ -457,6 +459,7 @@ void Gsu::Reset()
 	_waitForRomAccess = false;
 	_waitForRamAccess = false;
 	_stopped = true;
+	_idle = false;
 	_lastOpAddr = 0;
 }
 
@@ -505,6 +508,12 @@ uint8_t Gsu::Read(uint32_t addr)
 
 void Gsu::Write(uint32_t addr, uint8_t value)
 {
+	if(_idle) {
+		//Catch up before the CPU modifies the GSU's state (Run will flag it as idle again if needed)
+		Run();
+		_idle = false;
+	}
+
 	addr &= 0x33FF;
 	if(_state.SFR.Running && addr != 0x3030 && addr != 0x303A) {
 		//"During GSU operation, only SFR, SCMR, and VCR may be accessed."
@@ -607,6 +616,10 @@ AddressInfo Gsu::GetAbsoluteAddress(uint32_t address)
 
 void Gsu::Serialize(Serializer &s)
 {
+	if(s.IsSaving() && _idle) {
+		Run();
+	}
+
 	SV(_state.CycleCount); SV(_state.RegisterLatch); SV(_state.ProgramBank); SV(_state.RomBank); SV(_state.RamBank); SV(_state.IrqDisabled);
 	SV(_state.HighSpeedMode); SV(_state.ClockSelect); SV(_state.BackupRamEnabled); SV(_state.ScreenBase); SV(_state.ColorGradient); SV(_state.PlotBpp);
 	SV(_state.ScreenHeight); SV(_state.GsuRamAccess); SV(_state.GsuRomAccess); SV(_state.CacheBase); SV(_state.PlotTransparent); SV(_state.PlotDither);
@@ -625,6 +638,10 @@ void Gsu::Serialize(Serializer &s)
 	SVArray(_cacheValid, 32);
 	SVArray(_cache, 512);
 	SVArray(_gsuRam, _gsuRamSize);
+
+	if(!s.IsSaving()) {
+		_idle = false;
+	}
 }
 
 void Gsu::LoadBattery()
@@ -113,6 +113,13 @@ void Msu1::MixAudio(int16_t* buffer, uint32_t sampleCount, uint32_t sampleRate)
 	}
 }
 
+string Msu1::GetDebugStats()
+{
+	std::stringstream ss;
+	ss << "MSU-1: " << _pcmReader.GetBufferedDuration() << " ms buffered, " << _pcmReader.GetUnderrunCount() << " underruns";
+	return ss.str();
+}
+
 void Msu1::LoadTrack(uint32_t startOffset)
 {
 	_trackMissing = !_pcmReader.Init(_trackPath + "-" + std::to_string(_trackSelect) + ".pcm", _repeat, startOffset);
@@ -43,6 +43,8 @@ public:
 	uint8_t Read(uint16_t addr);
 	
 	void MixAudio(int16_t* buffer, uint32_t sampleCount, uint32_t sampleRate) override;
+
+	string GetDebugStats();
 	
 	void Serialize(Serializer &s) override;
 };
\ No newline at end of file
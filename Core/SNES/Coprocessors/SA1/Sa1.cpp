@@ -239,6 +239,12 @@ void Sa1::Sa1RegisterWrite(uint16_t addr, uint8_t value)
 
 void Sa1::CpuRegisterWrite(uint16_t addr, uint8_t value)
 {
+	if(_idle) {
+		//Catch up before the CPU modifies the SA-1's state (Run will flag it as idle again if needed)
+		Run();
+		_idle = false;
+	}
+
 	switch(addr) {
 		case 0x2200: 
 			//CCNT (SA-1 CPU Control)
@@ -453,7 +459,7 @@ void Sa1::WriteSa1(uint32_t addr, uint8_t value, MemoryOperationType type)
 		if(handler) {
 			_lastAccessMemType = handler->GetMemoryType();
 			_openBus = value;
-			handler->Write(addr, value);
+			_mappings.Write(handler, addr, value);
 		} else {
 			LogDebug("[Debug] Write SA1 - missing handler: $" + HexUtilities::ToHex(addr));
 		}
@@ -465,7 +471,7 @@ uint8_t Sa1::ReadSa1(uint32_t addr, MemoryOperationType type)
 	IMemoryHandler *handler = _mappings.GetHandler(addr);
 	uint8_t value;
 	if(handler) {
-		value = handler->Read(addr);
+		value = _mappings.Read(handler, addr);
 		_lastAccessMemType = handler->GetMemoryType();
 		_openBus = value;
 	} else {
@@ -508,13 +514,16 @@ void Sa1::Run()
 
 	while(_cpu->GetCycleCount() < targetCycle) {
 		if(_state.Sa1Wait || _state.Sa1Reset) {
-			_cpu->IncreaseCycleCount<1>();
+			_cpu->IncreaseCycleCount(targetCycle - _cpu->GetCycleCount());
 		} else if(_state.DmaRunning) {
 			RunDma();
 		} else {
 			_cpu->Exec();
 		}
 	}
+
+	//Only the CPU can take the SA-1 out of wait/reset (by writing to CCNT)
+	_idle = _state.Sa1Wait || _state.Sa1Reset;
 }
 
 void Sa1::WriteInternalRam(uint32_t addr, uint8_t value)
@@ -768,6 +777,8 @@ void Sa1::RunCharConvertType2()
 
 void Sa1::Reset()
 {
+	//The SA-1's cycle counter is reset below, no need to catch up
+	_idle = false;
 	_state = {};
 	CpuRegisterWrite(0x2200, 0x20);
 	CpuRegisterWrite(0x2228, 0xFF);
@@ -857,6 +868,10 @@ void Sa1::SaveBattery()
 
 void Sa1::Serialize(Serializer &s)
 {
+	if(s.IsSaving() && _idle) {
+		Run();
+	}
+
 	SV(_cpu);
 
 	SV(_state.Sa1ResetVector); SV(_state.Sa1IrqVector); SV(_state.Sa1NmiVector); SV(_state.Sa1IrqRequested); SV(_state.Sa1IrqEnabled); SV(_state.Sa1NmiRequested); SV(_state.Sa1NmiEnabled);
@@ -883,5 +898,6 @@ void Sa1::Serialize(Serializer &s)
 		UpdatePrgRomMappings();
 		UpdateSaveRamMappings();
 		ProcessInterrupts();
+		_idle = false;
 	}
 }
\ No newline at end of file
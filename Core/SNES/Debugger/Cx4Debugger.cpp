@@ -45,6 +45,7 @@ void Cx4Debugger::Reset()
 	_prevOpCode = 0;
 }
 
+template<uint8_t hooks>
 void Cx4Debugger::ProcessInstruction()
 {
 	Cx4State& state = _cx4->GetState();
@@ -56,9 +57,11 @@ void Cx4Debugger::ProcessInstruction()
 	InstructionProgress.LastMemOperation = operation;
 	InstructionProgress.StartCycle = state.CycleCount;
 
-	if(addressInfo.Type == MemoryType::SnesPrgRom) {
-		_codeDataLogger->SetCode<SnesCdlFlags::Cx4>(addressInfo.Address);
-		_codeDataLogger->SetCode<SnesCdlFlags::Cx4>(addressInfo.Address + 1);
+	if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+		if(addressInfo.Type == MemoryType::SnesPrgRom) {
+			_codeDataLogger->SetCode<SnesCdlFlags::Cx4>(addressInfo.Address);
+			_codeDataLogger->SetCode<SnesCdlFlags::Cx4>(addressInfo.Address + 1);
+		}
 	}
 
 	if(Cx4DisUtils::IsJumpToSub(_prevOpCode) && pc != _prevProgramCounter + Cx4DisUtils::GetOpSize()) {
@@ -68,9 +71,11 @@ void Cx4Debugger::ProcessInstruction()
 		_callstackManager->Push(srcAddress, _prevProgramCounter, addressInfo, pc, retAddress, returnPc, _prevStackPointer, StackFrameFlags::None);
 	} else if(Cx4DisUtils::IsReturnInstruction(_prevOpCode)) {
 		_callstackManager->Pop(addressInfo, pc, state.SP);
-		if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP) {
-			//RTS - if we're on the expected return address, break immediately (for step over/step out)
-			_step->Break(BreakSource::CpuStep);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP) {
+				//RTS - if we're on the expected return address, break immediately (for step over/step out)
+				_step->Break(BreakSource::CpuStep);
+			}
 		}
 	}
 
@@ -87,12 +92,16 @@ void Cx4Debugger::ProcessInstruction()
 		_callstackManager->Clear();
 	}
 
-	_step->ProcessCpuExec();
-	_debugger->ProcessBreakConditions(CpuType::Cx4, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
+		_debugger->ProcessBreakConditions(CpuType::Cx4, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 
-	if(_traceLogger->IsEnabled()) {
-		DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, pc, 0, CpuType::Cx4);
-		_traceLogger->Log(state, disInfo, operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, pc, 0, CpuType::Cx4);
+			_traceLogger->Log(state, disInfo, operation, addressInfo);
+		}
 	}
 
 	AddressInfo opCodeHighAddr = _cx4->GetMemoryMappings()->GetAbsoluteAddress(pc + 1);
@@ -100,6 +109,7 @@ void Cx4Debugger::ProcessInstruction()
 	_memoryAccessCounter->ProcessMemoryExec(opCodeHighAddr, _memoryManager->GetMasterClock());
 }
 
+template<uint8_t hooks>
 void Cx4Debugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	Cx4State& state = _cx4->GetState();
@@ -109,26 +119,37 @@ void Cx4Debugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 	MemoryOperationInfo operation(addr, value, type, MemoryType::Cx4Memory);
 	InstructionProgress.LastMemOperation = operation;
 
-	if(addressInfo.Type == MemoryType::SnesPrgRom) {
-		_codeDataLogger->SetData<SnesCdlFlags::Cx4>(addressInfo.Address);
+	if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+		if(addressInfo.Type == MemoryType::SnesPrgRom) {
+			_codeDataLogger->SetData<SnesCdlFlags::Cx4>(addressInfo.Address);
+		}
 	}
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 	_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
 
-	_debugger->ProcessBreakConditions(CpuType::Cx4, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_debugger->ProcessBreakConditions(CpuType::Cx4, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
+template<uint8_t hooks>
 void Cx4Debugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _cx4->GetMemoryMappings()->GetAbsoluteAddress(addr);
 	MemoryOperationInfo operation(addr, value, type, MemoryType::Cx4Memory);
 	InstructionProgress.LastMemOperation = operation;
-	_debugger->ProcessBreakConditions(CpuType::Cx4, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_debugger->ProcessBreakConditions(CpuType::Cx4, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 }
 
@@ -235,3 +256,11 @@ ITraceLogger* Cx4Debugger::GetTraceLogger()
 {
 	return _traceLogger.get();
 }
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void Cx4Debugger::ProcessInstruction<hooks>(); \
+	template void Cx4Debugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void Cx4Debugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
@@ -39,9 +39,9 @@ public:
 
 	void Reset() override;
 
-	void ProcessInstruction();
-	void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
-	void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessInstruction();
+	template<uint8_t hooks> void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
 
 	void Run() override;
 	void Step(int32_t stepCount, StepType type) override;
@@ -42,6 +42,7 @@ void GsuDebugger::Reset()
 	_prevOpCode = 0xFF;
 }
 
+template<uint8_t hooks>
 void GsuDebugger::ProcessInstruction()
 {
 	GsuState& state = _gsu->GetState();
@@ -51,8 +52,10 @@ void GsuDebugger::ProcessInstruction()
 	InstructionProgress.LastMemOperation = operation;
 	InstructionProgress.StartCycle = state.CycleCount;
 
-	if(addressInfo.Type == MemoryType::SnesPrgRom) {
-		_codeDataLogger->SetCode<SnesCdlFlags::Gsu>(addressInfo.Address);
+	if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+		if(addressInfo.Type == MemoryType::SnesPrgRom) {
+			_codeDataLogger->SetCode<SnesCdlFlags::Gsu>(addressInfo.Address);
+		}
 	}
 
 	if(_settings->CheckDebuggerFlag(DebuggerFlags::GsuDebuggerEnabled)) {
@@ -62,17 +65,22 @@ void GsuDebugger::ProcessInstruction()
 	_prevOpCode = state.ProgramReadBuffer;
 	_prevProgramCounter = addr;
 
-	_step->ProcessCpuExec();
-
 	_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
-	_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 
-	if(_traceLogger->IsEnabled()) {
-		DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Gsu);
-		_traceLogger->Log(_gsu->GetState(), disInfo, operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
+		_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
+
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Gsu);
+			_traceLogger->Log(_gsu->GetState(), disInfo, operation, addressInfo);
+		}
 	}
 }
 
+template<uint8_t hooks>
 void GsuDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _gsu->GetMemoryMappings()->GetAbsoluteAddress(addr);
@@ -82,32 +90,45 @@ void GsuDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 	if(type == MemoryOperationType::ExecOpCode) {
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
 	} else if(type == MemoryOperationType::ExecOperand) {
-		if(addressInfo.Type == MemoryType::SnesPrgRom) {
-			_codeDataLogger->SetData<SnesCdlFlags::Gsu>(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::SnesPrgRom) {
+				_codeDataLogger->SetData<SnesCdlFlags::Gsu>(addressInfo.Address);
+			}
 		}
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
 	} else {
-		if(addressInfo.Type == MemoryType::SnesPrgRom) {
-			_codeDataLogger->SetData<SnesCdlFlags::Gsu>(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::SnesPrgRom) {
+				_codeDataLogger->SetData<SnesCdlFlags::Gsu>(addressInfo.Address);
+			}
 		}
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
-		_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	}
 }
 
+template<uint8_t hooks>
 void GsuDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _gsu->GetMemoryMappings()->GetAbsoluteAddress(addr);
 	MemoryOperationInfo operation(addr, value, type, MemoryType::GsuMemory);
 	InstructionProgress.LastMemOperation = operation;
 
-	_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
 	_disassembler->InvalidateCache(addressInfo, CpuType::Gsu);
@@ -194,3 +215,11 @@ ITraceLogger* GsuDebugger::GetTraceLogger()
 {
 	return _traceLogger.get();
 }
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void GsuDebugger::ProcessInstruction<hooks>(); \
+	template void GsuDebugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void GsuDebugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
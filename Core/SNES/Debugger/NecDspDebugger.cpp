@@ -41,6 +41,7 @@ void NecDspDebugger::Reset()
 	_prevOpCode = 0;
 }
 
+template<uint8_t hooks>
 void NecDspDebugger::ProcessInstruction()
 {
 	NecDspState& state = _dsp->GetState();
@@ -62,9 +63,11 @@ void NecDspDebugger::ProcessInstruction()
 	} else if(NecDspDisUtils::IsReturnInstruction(_prevOpCode)) {
 		_callstackManager->Pop(addressInfo, pc, state.SP);
 
-		if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP) {
-			//If we're on the expected return address, break immediately (for step over/step out)
-			_step->Break(BreakSource::CpuStep);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP) {
+				//If we're on the expected return address, break immediately (for step over/step out)
+				_step->Break(BreakSource::CpuStep);
+			}
 		}
 	}
 
@@ -72,10 +75,13 @@ void NecDspDebugger::ProcessInstruction()
 	_prevOpCode = opCode;
 	_prevStackPointer = state.SP;
 
-	_step->ProcessCpuExec();
-	_debugger->ProcessBreakConditions(CpuType::NecDsp, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
+		_debugger->ProcessBreakConditions(CpuType::NecDsp, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
+template<uint8_t hooks>
 void NecDspDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	if(type == MemoryOperationType::ExecOpCode) {
@@ -83,9 +89,11 @@ void NecDspDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationTy
 		MemoryOperationInfo operation(addr, value, MemoryOperationType::ExecOpCode, MemoryType::NecDspMemory);
 		InstructionProgress.LastMemOperation = operation;
 
-		if(_traceLogger->IsEnabled()) {
-			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::NecDsp);
-			_traceLogger->Log(_dsp->GetState(), disInfo, operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::NecDsp);
+				_traceLogger->Log(_dsp->GetState(), disInfo, operation, addressInfo);
+			}
 		}
 	} else {
 		MemoryType memType = (addr & NecDsp::DataRomReadFlag) ? MemoryType::DspDataRom : MemoryType::DspDataRam;
@@ -95,23 +103,32 @@ void NecDspDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationTy
 		MemoryOperationInfo operation(addr, value, type, memType);
 		InstructionProgress.LastMemOperation = operation;
 
-		_debugger->ProcessBreakConditions(CpuType::NecDsp, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_debugger->ProcessBreakConditions(CpuType::NecDsp, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 	}
 }
 
+template<uint8_t hooks>
 void NecDspDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = { (int32_t)addr, MemoryType::DspDataRam };
 	MemoryOperationInfo operation(addr, value, type, MemoryType::DspDataRam);
 	InstructionProgress.LastMemOperation = operation;
-	_debugger->ProcessBreakConditions(CpuType::NecDsp, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_debugger->ProcessBreakConditions(CpuType::NecDsp, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 }
 
@@ -207,3 +224,11 @@ ITraceLogger* NecDspDebugger::GetTraceLogger()
 {
 	return _traceLogger.get();
 }
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void NecDspDebugger::ProcessInstruction<hooks>(); \
+	template void NecDspDebugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void NecDspDebugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
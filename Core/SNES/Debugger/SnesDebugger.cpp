@@ -142,6 +142,7 @@ void SnesDebugger::ResetPrevOpCode()
 	_prevOpCode = 0xFF;
 }
 
+template<uint8_t hooks>
 void SnesDebugger::ProcessInstruction()
 {
 	SnesCpuState& state = GetCpuState();
@@ -154,8 +155,10 @@ void SnesDebugger::ProcessInstruction()
 
 	if(addressInfo.Address >= 0) {
 		uint8_t cpuFlags = state.PS & (ProcFlags::IndexMode8 | ProcFlags::MemoryMode8);
-		if(addressInfo.Type == MemoryType::SnesPrgRom) {
-			_cdl->SetCode(addressInfo.Address, SnesDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter) | cpuFlags);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::SnesPrgRom) {
+				_cdl->SetCode(addressInfo.Address, SnesDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter) | cpuFlags);
+			}
 		}
 		if(_traceLogger->IsEnabled() || _debuggerEnabled) {
 			_disassembler->BuildCache(addressInfo, cpuFlags, _cpuType);
@@ -164,43 +167,48 @@ void SnesDebugger::ProcessInstruction()
 
 	ProcessCallStackUpdates(addressInfo, pc, state.PS, state.SP);
 
-	if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP && (SnesDisUtils::IsReturnInstruction(_prevOpCode) || _prevOpCode == 0x44 || _prevOpCode == 0x54)) {
-		//RTS/RTL/RTI found, if we're on the expected return address, break immediately (for step over/step out)
-		//Also used for MVN/MVP
-		_step->Break(BreakSource::CpuStep);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP && (SnesDisUtils::IsReturnInstruction(_prevOpCode) || _prevOpCode == 0x44 || _prevOpCode == 0x54)) {
+			//RTS/RTL/RTI found, if we're on the expected return address, break immediately (for step over/step out)
+			//Also used for MVN/MVP
+			_step->Break(BreakSource::CpuStep);
+		}
 	}
 
 	_prevOpCode = opCode;
 	_prevProgramCounter = pc;
 	_prevStackPointer = state.SP;
 
-	_step->ProcessCpuExec();
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
 
-	if(_debuggerEnabled) {
-		//Break on BRK/STP/WDM/COP
-		switch(opCode) {
-			case 0x00: if(_settings->GetDebugConfig().SnesBreakOnBrk) { _step->Break(BreakSource::BreakOnBrk); } break;
-			case 0x02: if(_settings->GetDebugConfig().SnesBreakOnCop) { _step->Break(BreakSource::BreakOnCop); } break;
-			case 0x42: if(_settings->GetDebugConfig().SnesBreakOnWdm) { _step->Break(BreakSource::BreakOnWdm); } break;
-			case 0xDB: if(_settings->GetDebugConfig().SnesBreakOnStp) { _step->Break(BreakSource::BreakOnStp); } break;
+		if(_debuggerEnabled) {
+			//Break on BRK/STP/WDM/COP
+			switch(opCode) {
+				case 0x00: if(_settings->GetDebugConfig().SnesBreakOnBrk) { _step->Break(BreakSource::BreakOnBrk); } break;
+				case 0x02: if(_settings->GetDebugConfig().SnesBreakOnCop) { _step->Break(BreakSource::BreakOnCop); } break;
+				case 0x42: if(_settings->GetDebugConfig().SnesBreakOnWdm) { _step->Break(BreakSource::BreakOnWdm); } break;
+				case 0xDB: if(_settings->GetDebugConfig().SnesBreakOnStp) { _step->Break(BreakSource::BreakOnStp); } break;
+			}
 		}
-	}
-	
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _predictiveBreakpoints) {
-		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(_cpuType, _breakpointManager.get(), memOp, absAddr);
+		
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _predictiveBreakpoints) {
+			_dummyCpu->SetDummyState(state);
+			_dummyCpu->Exec();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(_cpuType, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
+template<uint8_t hooks>
 void SnesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = GetAbsoluteAddress(addr);
@@ -208,37 +216,53 @@ void SnesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 	InstructionProgress.LastMemOperation = operation;
 	SnesCpuState& state = GetCpuState();
 
-	if(IsRegister(addr)) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(IsRegister(addr)) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
 	if(type == MemoryOperationType::ExecOpCode) {
-		if(_traceLogger->IsEnabled()) {
-			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, state.PS, _cpuType);
-			_traceLogger->Log(state, disInfo, operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, state.PS, _cpuType);
+				_traceLogger->Log(state, disInfo, operation, addressInfo);
+			}
 		}
 		
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
-		if(_step->ProcessCpuCycle()) {
-			_debugger->SleepUntilResume(_cpuType, BreakSource::CpuStep, &operation);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->ProcessCpuCycle()) {
+				_debugger->SleepUntilResume(_cpuType, BreakSource::CpuStep, &operation);
+			}
 		}
 	} else if(type == MemoryOperationType::ExecOperand) {
-		if(addressInfo.Type == MemoryType::SnesPrgRom && addressInfo.Address >= 0) {
-			_cdl->SetCode(addressInfo.Address, (state.PS & (SnesCdlFlags::IndexMode8 | SnesCdlFlags::MemoryMode8)));
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::SnesPrgRom && addressInfo.Address >= 0) {
+				_cdl->SetCode(addressInfo.Address, (state.PS & (SnesCdlFlags::IndexMode8 | SnesCdlFlags::MemoryMode8)));
+			}
 		}
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	} else {
-		if(addressInfo.Type == MemoryType::SnesPrgRom && addressInfo.Address >= 0) {
-			_cdl->SetData(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::SnesPrgRom && addressInfo.Address >= 0) {
+				_cdl->SetData(addressInfo.Address);
+			}
 		}
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
@@ -248,18 +272,23 @@ void SnesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 				//Only warn the first time
 				_debugger->Log(string(_cpuType == CpuType::Sa1 ? "[SA1]" : "[CPU]") + " Uninitialized memory read: $" + HexUtilities::ToHex24(addr));
 			}
-			if(_debuggerEnabled && _settings->GetDebugConfig().BreakOnUninitRead) {
-				_step->Break(BreakSource::BreakOnUninitMemoryRead);
+			if constexpr(hooks & DebugHookFlags::BreakChecks) {
+				if(_debuggerEnabled && _settings->GetDebugConfig().BreakOnUninitRead) {
+					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				}
 			}
 		}
 		
-		if(type != MemoryOperationType::DmaRead) {
-			_step->ProcessCpuCycle();
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(type != MemoryOperationType::DmaRead) {
+				_step->ProcessCpuCycle();
+			}
+			_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 		}
-		_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	}
 }
 
+template<uint8_t hooks>
 void SnesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = GetAbsoluteAddress(addr);
@@ -269,20 +298,26 @@ void SnesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationTyp
 		_disassembler->InvalidateCache(addressInfo, _cpuType);
 	}
 
-	if(IsRegister(addr)) {
-		_eventManager->AddEvent(DebugEventType::Register, operation);
+	if constexpr(hooks & DebugHookFlags::EventManager) {
+		if(IsRegister(addr)) {
+			_eventManager->AddEvent(DebugEventType::Register, operation);
+		}
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
 
-	if(type != MemoryOperationType::DmaWrite) {
-		_step->ProcessCpuCycle();
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		if(type != MemoryOperationType::DmaWrite) {
+			_step->ProcessCpuCycle();
+		}
+		_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	}
-	_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 }
 
 void SnesDebugger::ProcessIdleCycle()
@@ -600,3 +635,11 @@ void SnesDebugger::ProcessInputOverrides(DebugControllerState inputOverrides[8])
 	}
 	controlManager->RefreshHubState();
 }
+
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void SnesDebugger::ProcessInstruction<hooks>(); \
+	template void SnesDebugger::ProcessRead<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type); \
+	template void SnesDebugger::ProcessWrite<hooks>(uint32_t addr, uint8_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
@@ -50,6 +50,7 @@ void SpcDebugger::ProcessConfigChange()
 	_ignoreDspReadWrites = _settings->GetDebugConfig().SnesIgnoreDspReadWrites;
 }
 
+template<uint8_t hooks>
 void SpcDebugger::ProcessInstruction()
 {
 	SpcState& state = _spc->GetState();
@@ -73,9 +74,11 @@ void SpcDebugger::ProcessInstruction()
 		//RTS, RTI
 		_callstackManager->Pop(addressInfo, addr, state.SP);
 
-		if(_step->BreakAddress == (int32_t)addr && _step->BreakStackPointer == state.SP) {
-			//RTS/RTI - if we're on the expected return address, break immediately (for step over/step out)
-			_step->Break(BreakSource::CpuStep);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->BreakAddress == (int32_t)addr && _step->BreakStackPointer == state.SP) {
+				//RTS/RTI - if we're on the expected return address, break immediately (for step over/step out)
+				_step->Break(BreakSource::CpuStep);
+			}
 		}
 	}
 
@@ -83,33 +86,35 @@ void SpcDebugger::ProcessInstruction()
 	_prevProgramCounter = addr;
 	_prevStackPointer = state.SP;
 
-	_step->ProcessCpuExec();
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
 
-	if(_debuggerEnabled) {
-		//Break on BRK/STP
-		if(value == 0x0F && _settings->GetDebugConfig().SpcBreakOnBrk) {
-			_step->Break(BreakSource::BreakOnBrk);
-		} else if((value == 0xFF || value == 0xEF) && _settings->GetDebugConfig().SpcBreakOnStpSleep) {
-			_step->Break(BreakSource::BreakOnStp);
+		if(_debuggerEnabled) {
+			//Break on BRK/STP
+			if(value == 0x0F && _settings->GetDebugConfig().SpcBreakOnBrk) {
+				_step->Break(BreakSource::BreakOnBrk);
+			} else if((value == 0xFF || value == 0xEF) && _settings->GetDebugConfig().SpcBreakOnStpSleep) {
+				_step->Break(BreakSource::BreakOnStp);
+			}
 		}
-	}
 
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _predictiveBreakpoints) {
-		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Step();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _spc->GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(CpuType::Spc, _breakpointManager.get(), memOp, absAddr);
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _predictiveBreakpoints) {
+			_dummyCpu->SetDummyState(state);
+			_dummyCpu->Step();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _spc->GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Spc, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
-template<MemoryAccessFlags flags>
+template<MemoryAccessFlags flags, uint8_t hooks>
 void SpcDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	MemoryOperationInfo operation(addr, value, type, MemoryType::SpcMemory);
@@ -120,24 +125,34 @@ void SpcDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 		AddressInfo addressInfo = _spc->GetAbsoluteAddress(addr);
 
 		if(type == MemoryOperationType::ExecOpCode) {
-			if(_traceLogger->IsEnabled()) {
-				SpcState& state = _spc->GetState();
-				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Spc);
-				_traceLogger->Log(state, disInfo, operation, addressInfo);
+			if constexpr(hooks & DebugHookFlags::TraceLogger) {
+				if(_traceLogger->IsEnabled()) {
+					SpcState& state = _spc->GetState();
+					DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Spc);
+					_traceLogger->Log(state, disInfo, operation, addressInfo);
+				}
 			}
 			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
 		} else if(type == MemoryOperationType::ExecOperand) {
 			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
-			if(_traceLogger->IsEnabled()) {
-				_traceLogger->LogNonExec(operation, addressInfo);
+			if constexpr(hooks & DebugHookFlags::TraceLogger) {
+				if(_traceLogger->IsEnabled()) {
+					_traceLogger->LogNonExec(operation, addressInfo);
+				}
+			}
+			if constexpr(hooks & DebugHookFlags::BreakChecks) {
+				_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 			}
-			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 		} else {
 			_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
-			if(_traceLogger->IsEnabled()) {
-				_traceLogger->LogNonExec(operation, addressInfo);
+			if constexpr(hooks & DebugHookFlags::TraceLogger) {
+				if(_traceLogger->IsEnabled()) {
+					_traceLogger->LogNonExec(operation, addressInfo);
+				}
+			}
+			if constexpr(hooks & DebugHookFlags::BreakChecks) {
+				_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 			}
-			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 		}
 	} else {
 		//DSP read
@@ -145,12 +160,14 @@ void SpcDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			AddressInfo addressInfo { (int32_t)addr, MemoryType::SpcRam }; //DSP reads never read from the IPL ROM
 
 			_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
-			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+			if constexpr(hooks & DebugHookFlags::BreakChecks) {
+				_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+			}
 		}
 	}
 }
 
-template<MemoryAccessFlags flags>
+template<MemoryAccessFlags flags, uint8_t hooks>
 void SpcDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo { (int32_t)addr, MemoryType::SpcRam }; //Writes never affect the IPL ROM
@@ -162,16 +179,22 @@ void SpcDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 	
 	if constexpr(flags == MemoryAccessFlags::None) {
 		//SPC write
-		_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 	} else {
 		//DSP write
 		if(!_ignoreDspReadWrites) {
-			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+			if constexpr(hooks & DebugHookFlags::BreakChecks) {
+				_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+			}
 			_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
 		}
 	}
@@ -274,8 +297,12 @@ ITraceLogger* SpcDebugger::GetTraceLogger()
 	return _traceLogger.get();
 }
 
-template void SpcDebugger::ProcessRead<MemoryAccessFlags::None>(uint32_t addr, uint8_t value, MemoryOperationType opType);
-template void SpcDebugger::ProcessRead<MemoryAccessFlags::DspAccess>(uint32_t addr, uint8_t value, MemoryOperationType opType);
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void SpcDebugger::ProcessInstruction<hooks>(); \
+	template void SpcDebugger::ProcessRead<MemoryAccessFlags::None, hooks>(uint32_t addr, uint8_t value, MemoryOperationType opType); \
+	template void SpcDebugger::ProcessRead<MemoryAccessFlags::DspAccess, hooks>(uint32_t addr, uint8_t value, MemoryOperationType opType); \
+	template void SpcDebugger::ProcessWrite<MemoryAccessFlags::None, hooks>(uint32_t addr, uint8_t value, MemoryOperationType opType); \
+	template void SpcDebugger::ProcessWrite<MemoryAccessFlags::DspAccess, hooks>(uint32_t addr, uint8_t value, MemoryOperationType opType);
 
-template void SpcDebugger::ProcessWrite<MemoryAccessFlags::None>(uint32_t addr, uint8_t value, MemoryOperationType opType);
-template void SpcDebugger::ProcessWrite<MemoryAccessFlags::DspAccess>(uint32_t addr, uint8_t value, MemoryOperationType opType);
\ No newline at end of file
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
\ No newline at end of file
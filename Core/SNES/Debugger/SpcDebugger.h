@@ -45,12 +45,13 @@ public:
 
 	void ProcessConfigChange() override;
 
+	template<uint8_t hooks>
 	void ProcessInstruction();
 
-	template<MemoryAccessFlags flags>
+	template<MemoryAccessFlags flags, uint8_t hooks>
 	void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
 	
-	template<MemoryAccessFlags flags>
+	template<MemoryAccessFlags flags, uint8_t hooks>
 	void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
 	
 	void Run() override;
@@ -61,6 +61,7 @@ void St018Debugger::Reset()
 	ResetPrevOpCode();
 }
 
+template<uint8_t hooks>
 void St018Debugger::ProcessInstruction()
 {
 	ArmV3CpuState& state = _cpu->GetState();
@@ -84,32 +85,36 @@ void St018Debugger::ProcessInstruction()
 	_prevOpCode = opCode;
 	_prevProgramCounter = pc;
 
-	_step->ProcessCpuExec();
-
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _st018->GetArmAbsoluteAddress(memOp.Address);
-				switch(_dummyCpu->GetOperationMode(i) & (ArmV3AccessMode::Byte | ArmV3AccessMode::Word)) {
-					case ArmV3AccessMode::Byte: _debugger->ProcessPredictiveBreakpoint<1>(CpuType::St018, _breakpointManager.get(), memOp, absAddr); break;
-					case ArmV3AccessMode::Word: _debugger->ProcessPredictiveBreakpoint<4>(CpuType::St018, _breakpointManager.get(), memOp, absAddr); break;
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuExec();
+
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
+			_dummyCpu->SetDummyState(state);
+			_dummyCpu->Exec();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _st018->GetArmAbsoluteAddress(memOp.Address);
+					switch(_dummyCpu->GetOperationMode(i) & (ArmV3AccessMode::Byte | ArmV3AccessMode::Word)) {
+						case ArmV3AccessMode::Byte: _debugger->ProcessPredictiveBreakpoint<1>(CpuType::St018, _breakpointManager.get(), memOp, absAddr); break;
+						case ArmV3AccessMode::Word: _debugger->ProcessPredictiveBreakpoint<4>(CpuType::St018, _breakpointManager.get(), memOp, absAddr); break;
+					}
 				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions<4>(CpuType::St018, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions<4>(CpuType::St018, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 
-	if(_traceLogger->IsEnabled()) {
-		DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, pc, _prevFlags, CpuType::St018);
-		_traceLogger->Log(state, disInfo, operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, pc, _prevFlags, CpuType::St018);
+			_traceLogger->Log(state, disInfo, operation, addressInfo);
+		}
 	}
 }
 
-template<uint8_t accessWidth>
+template<uint8_t accessWidth, uint8_t hooks>
 void St018Debugger::ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _st018->GetArmAbsoluteAddress(addr);
@@ -127,34 +132,44 @@ void St018Debugger::ProcessRead(uint32_t addr, uint32_t value, MemoryOperationTy
 					//Only warn the first time
 					_debugger->Log("[ST018] Uninitialized memory read: $" + HexUtilities::ToHex(addr));
 				}
-				if(_settings->CheckDebuggerFlag(DebuggerFlags::St018DebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				if constexpr(hooks & DebugHookFlags::BreakChecks) {
+					if(_settings->CheckDebuggerFlag(DebuggerFlags::St018DebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+						_step->Break(BreakSource::BreakOnUninitMemoryRead);
+					}
 				}
 			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
-		_debugger->ProcessBreakConditions<accessWidth>(CpuType::St018, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_debugger->ProcessBreakConditions<accessWidth>(CpuType::St018, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	}
 }
 
-template<uint8_t accessWidth>
+template<uint8_t accessWidth, uint8_t hooks>
 void St018Debugger::ProcessWrite(uint32_t addr, uint32_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _st018->GetArmAbsoluteAddress(addr);
 	MemoryOperationInfo operation(addr, value, type, MemoryType::St018Memory);
 	InstructionProgress.LastMemOperation = operation;
-	_debugger->ProcessBreakConditions<accessWidth>(CpuType::St018, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_debugger->ProcessBreakConditions<accessWidth>(CpuType::St018, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 
 	if(addressInfo.Type == MemoryType::St018WorkRam) {
 		_disassembler->InvalidateCache(addressInfo, CpuType::St018);
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite<accessWidth>(addressInfo, _console->GetMasterClock());
@@ -294,10 +309,14 @@ BaseEventManager* St018Debugger::GetEventManager()
 	return nullptr;
 }
 
-template void St018Debugger::ProcessRead<1>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void St018Debugger::ProcessRead<2>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void St018Debugger::ProcessRead<4>(uint32_t addr, uint32_t value, MemoryOperationType type);
-
-template void St018Debugger::ProcessWrite<1>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void St018Debugger::ProcessWrite<2>(uint32_t addr, uint32_t value, MemoryOperationType type);
-template void St018Debugger::ProcessWrite<4>(uint32_t addr, uint32_t value, MemoryOperationType type);
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void St018Debugger::ProcessInstruction<hooks>(); \
+	template void St018Debugger::ProcessRead<1, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void St018Debugger::ProcessRead<2, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void St018Debugger::ProcessRead<4, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void St018Debugger::ProcessWrite<1, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void St018Debugger::ProcessWrite<2, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type); \
+	template void St018Debugger::ProcessWrite<4, hooks>(uint32_t addr, uint32_t value, MemoryOperationType type);
+
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
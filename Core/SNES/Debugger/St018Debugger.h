@@ -39,7 +39,6 @@ class St018Debugger final : public IDebugger
 	uint8_t _prevFlags = 0;
 
 	__forceinline void ProcessCallStackUpdates(AddressInfo& destAddr, uint32_t destPc);
-	template<uint8_t accessWidth> void ProcessInstruction();
 
 public:
 	St018Debugger(Debugger* debugger);
@@ -47,9 +46,9 @@ public:
 
 	void Reset() override;
 
-	void ProcessInstruction();
-	template<uint8_t accessWidth> void ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType type);
-	template<uint8_t accessWidth> void ProcessWrite(uint32_t addr, uint32_t value, MemoryOperationType type);
+	template<uint8_t hooks> void ProcessInstruction();
+	template<uint8_t accessWidth, uint8_t hooks> void ProcessRead(uint32_t addr, uint32_t value, MemoryOperationType type);
+	template<uint8_t accessWidth, uint8_t hooks> void ProcessWrite(uint32_t addr, uint32_t value, MemoryOperationType type);
 
 	void ProcessInterrupt(uint32_t originalPc, uint32_t currentPc, bool forNmi) override;
 
@@ -7,6 +7,10 @@ class IMemoryHandler
 protected:
 	MemoryType _memoryType;
 
+	//Set by handlers that map a full 4KB page of plain memory, allows MemoryMappings to bypass the virtual Read/Write calls
+	uint8_t* _directReadPtr = nullptr;
+	uint8_t* _directWritePtr = nullptr;
+
 public:
 	IMemoryHandler(MemoryType memType)
 	{
@@ -25,5 +29,8 @@ public:
 		return _memoryType;
 	}
 
+	uint8_t* GetDirectReadPointer() { return _directReadPtr; }
+	uint8_t* GetDirectWritePointer() { return _directWritePtr; }
+
 	virtual AddressInfo GetAbsoluteAddress(uint32_t address) = 0;
 };
\ No newline at end of file
@@ -1,19 +1,41 @@
 #pragma once
 #include "pch.h"
 #include "Debugger/DebugTypes.h"
-
-class IMemoryHandler;
+#include "SNES/IMemoryHandler.h"
 
 class MemoryMappings
 {
 private:
 	IMemoryHandler* _handlers[0x100 * 0x10] = {};
 
+	//Host pointers for pages backed by plain ram/rom, nullptr for all other pages
+	uint8_t* _readPointers[0x100 * 0x10] = {};
+	uint8_t* _writePointers[0x100 * 0x10] = {};
+
+	void SetHandler(uint32_t page, IMemoryHandler* handler);
+
 public:
 	void RegisterHandler(uint8_t startBank, uint8_t endBank, uint16_t startPage, uint16_t endPage, vector<unique_ptr<IMemoryHandler>>& handlers, uint16_t pageIncrement = 0, uint16_t startPageNumber = 0);
 	void RegisterHandler(uint8_t startBank, uint8_t endBank, uint16_t startAddr, uint16_t endAddr, IMemoryHandler* handler);
 
 	IMemoryHandler* GetHandler(uint32_t addr);
+
+	__forceinline uint8_t Read(IMemoryHandler* handler, uint32_t addr)
+	{
+		uint8_t* ptr = _readPointers[addr >> 12];
+		return ptr ? ptr[addr & 0xFFF] : handler->Read(addr);
+	}
+
+	__forceinline void Write(IMemoryHandler* handler, uint32_t addr, uint8_t value)
+	{
+		uint8_t* ptr = _writePointers[addr >> 12];
+		if(ptr) {
+			ptr[addr & 0xFFF] = value;
+		} else {
+			handler->Write(addr, value);
+		}
+	}
+
 	AddressInfo GetAbsoluteAddress(uint32_t addr);
 	int GetRelativeAddress(AddressInfo& absAddress, uint8_t startBank = 0);
 
@@ -22,6 +22,8 @@ public:
 			_mask = size - offset - 1;
 		} else {
 			_mask = 0xFFF;
+			_directReadPtr = _ram;
+			_directWritePtr = _ram;
 		}
 		_memoryType = memoryType;
 	}
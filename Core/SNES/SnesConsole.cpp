@@ -3,6 +3,7 @@
 #include "SNES/SnesCpu.h"
 #include "SNES/SnesPpu.h"
 #include "SNES/Spc.h"
+#include "SNES/SpcThread.h"
 #include "SNES/InternalRegisters.h"
 #include "SNES/SnesControlManager.h"
 #include "SNES/SnesMemoryManager.h"
@@ -60,8 +61,22 @@ void SnesConsole::RunFrame()
 {
 	UpdateRegion();
 
+	//The debugger expects all cpus to run on the emulation thread, so the SPC thread is only used when the debugger is off
+	//(and only on multi-core hosts, otherwise the 2 threads would constantly be waiting for each other)
+	static bool isMultiCore = std::thread::hardware_concurrency() > 1;
+	_spc->SetThreadEnabled(isMultiCore && _settings->GetSnesConfig().RunSpcOnSeparateThread && !_emu->IsDebugging());
+
 	_frameRunning = true;
 
+	while(_frameRunning && _spc->GetThread()) {
+		_cpu->Exec();
+
+		//The thread is stopped (in the middle of the frame) when the debugger is started, the rest of the frame runs in lockstep
+		if(SpcThread* spcThread = _spc->GetThread()) {
+			spcThread->SetTargetClock(_memoryManager->GetMasterClock());
+		}
+	}
+
 	while(_frameRunning) {
 		_cpu->Exec();
 	}
@@ -69,12 +84,20 @@ void SnesConsole::RunFrame()
 	_spc->ProcessEndFrame();
 }
 
+void SnesConsole::OnBeforeDebuggerStart()
+{
+	if(_spc) {
+		_spc->SetThreadEnabled(false);
+	}
+}
+
 void SnesConsole::ProcessEndOfFrame()
 {
 	_cart->RunCoprocessors();
 	if(_cart->GetCoprocessor()) {
 		_cart->GetCoprocessor()->ProcessEndOfFrame();
 	}
+	_cart->UpdateCoprocessorStats(_settings->GetPreferences().ShowDebugInfo);
 	
 	//Run the SPC at least once per frame to prevent issues (buffer overflow)
 	//when a very long DMA transfer is running across multiple frames.
@@ -83,6 +106,11 @@ void SnesConsole::ProcessEndOfFrame()
 
 	_emu->ProcessEndOfFrame();
 
+	if(SpcThread* spcThread = _spc->GetThread()) {
+		//The SPC thread may have gone to sleep while the frame limiter was waiting
+		spcThread->Wake();
+	}
+
 	_controlManager->UpdateControlDevices();
 	_controlManager->UpdateInputState();
 	_internalRegisters->SetAutoJoypadReadClock();
@@ -294,6 +322,15 @@ RomFormat SnesConsole::GetRomFormat()
 	return RomFormat::Sfc;
 }
 
+vector<string> SnesConsole::GetDebugStats()
+{
+	vector<string> stats = _cart->GetCoprocessorStats();
+	if(_msu1) {
+		stats.push_back(_msu1->GetDebugStats());
+	}
+	return stats;
+}
+
 AudioTrackInfo SnesConsole::GetAudioTrackInfo()
 {
 	AudioTrackInfo track = {};
@@ -81,6 +81,7 @@ public:
 	void Reset() override;
 
 	void RunFrame() override;
+	void OnBeforeDebuggerStart() override;
 
 	void ProcessEndOfFrame();
 
@@ -129,4 +130,6 @@ public:
 	RomFormat GetRomFormat() override;
 	AudioTrackInfo GetAudioTrackInfo() override;
 	void ProcessAudioPlayerAction(AudioPlayerActionParams p) override;
+
+	vector<string> GetDebugStats() override;
 };
@@ -271,7 +271,7 @@ uint8_t SnesMemoryManager::Read(uint32_t addr, MemoryOperationType type)
 	uint8_t value;
 	IMemoryHandler *handler = _mappings.GetHandler(addr);
 	if(handler) {
-		value = handler->Read(addr);
+		value = _mappings.Read(handler, addr);
 		_memTypeBusA = handler->GetMemoryType();
 		if(handler != _registerHandlerA.get()) {
 			//Reading from the internal CPU bus does not update the external bus
@@ -309,7 +309,7 @@ uint8_t SnesMemoryManager::ReadDma(uint32_t addr, bool forBusA)
 				value = handler->Read(addr);
 			}
 		} else {
-			value = handler->Read(addr);
+			value = _mappings.Read(handler, addr);
 			if(handler != _registerHandlerB.get()) {
 				_memTypeBusA = handler->GetMemoryType();
 			}
@@ -349,7 +349,7 @@ void SnesMemoryManager::Write(uint32_t addr, uint8_t value, MemoryOperationType
 	if(_emu->ProcessMemoryWrite<CpuType::Snes>(addr, value, type)) {
 		IMemoryHandler* handler = _mappings.GetHandler(addr);
 		if(handler) {
-			handler->Write(addr, value);
+			_mappings.Write(handler, addr, value);
 			_memTypeBusA = handler->GetMemoryType();
 		} else {
 			LogDebug("[Debug] Write - missing handler: $" + HexUtilities::ToHex(addr) + " = " + HexUtilities::ToHex(value));
@@ -373,7 +373,7 @@ void SnesMemoryManager::WriteDma(uint32_t addr, uint8_t value, bool forBusA)
 					handler->Write(addr, value);
 				}
 			} else {
-				handler->Write(addr, value);
+				_mappings.Write(handler, addr, value);
 				if(handler != _registerHandlerB.get()) {
 					_memTypeBusA = handler->GetMemoryType();
 				}
@@ -1,10 +1,24 @@
 #include "pch.h"
 #include "SNES/Spc.h"
+#include "SNES/SpcThread.h"
 #include "SNES/SnesMemoryManager.h"
 #include "Shared/Emulator.h"
+#include "Shared/OpcodeDispatch.h"
 #include "Utilities/HexUtilities.h"
 
 void Spc::Run()
+{
+#ifndef DUMMYSPC
+	if(_thread) {
+		//Wait for the SPC thread to catch up to the main CPU
+		_thread->WaitForClock(_memoryManager->GetMasterClock());
+		return;
+	}
+#endif
+	RunUntil(_memoryManager->GetMasterClock());
+}
+
+void Spc::RunUntil(uint64_t masterClock)
 {
 	if(!_enabled) {
 		//Used to temporarily disable the SPC when overclocking is enabled
@@ -16,8 +30,8 @@ void Spc::Run()
 	}
 
 	//Minus 1 because each call to ProcessCycle increments _state.Cycle by 2
-	int64_t targetCycle = (int64_t)(_memoryManager->GetMasterClock() * _clockRatio) - 1;
-	while((int64_t)_state.Cycle < targetCycle) {
+	_targetCycle = (int64_t)(masterClock * _clockRatio) - 1;
+	while((int64_t)_state.Cycle < _targetCycle) {
 		ProcessCycle();
 	}
 }
@@ -25,15 +39,29 @@ void Spc::Run()
 void Spc::ProcessCycle()
 {
 	if(_opStep == SpcOpStep::ReadOpCode) {
-#ifndef DUMMYSPC
-		_emu->ProcessInstruction<CpuType::Spc>();
-#endif 
-		_opCode = GetOpCode();
-		_opStep = SpcOpStep::Addressing;
-		_opSubStep = 0;
+		StartOp();
+		EndCycle();
 	} else {
+		//Exec also ends the cycle
 		Exec();
 	}
+}
+
+void Spc::StartOp()
+{
+#ifndef DUMMYSPC
+	_emu->ProcessInstruction<CpuType::Spc>();
+#endif 
+	_opCode = GetOpCode();
+	_opStep = SpcOpStep::Addressing;
+	_opSubStep = 0;
+}
+
+void Spc::EndCycle()
+{
+	if(_opStep == SpcOpStep::AfterAddressing) {
+		_opStep = SpcOpStep::Operation;
+	}
 
 	if(_pendingCpuRegUpdate) {
 		//There appears to be a delay between the moment the CPU writes
@@ -58,270 +86,292 @@ void Spc::EndAddr()
 	_opSubStep = 0;
 }
 
-void Spc::Exec()
+#ifndef DUMMYSPC
+bool Spc::ChainNextCycle()
 {
-	switch(_opCode) {
-		case 0x00: NOP(); break;
-		case 0x01: TCALL<0>(); break;
-		case 0x02: Addr_Dir(); SET1<0>(); break;
-		case 0x03: Addr_Dir(); BBS<0>(); break;
-		case 0x04: Addr_Dir(); OR_Acc(); break;
-		case 0x05: Addr_Abs(); OR_Acc(); break;
-		case 0x06: Addr_IndX(); OR_Acc(); break;
-		case 0x07: Addr_DirIdxXInd(); OR_Acc(); break;
-		case 0x08: Addr_Imm(); OR_Imm(); break;
-		case 0x09: Addr_DirToDir(); OR(); break;
-		case 0x0A: Addr_AbsBit(); OR1(); break;
-		case 0x0B: Addr_Dir(); ASL(); break;
-		case 0x0C: Addr_Abs(); ASL(); break;
-		case 0x0D: PHP(); break;
-		case 0x0E: Addr_Abs(); TSET1(); break;
-		case 0x0F: BRK(); break;
-		case 0x10: Addr_Rel(); BPL(); break;
-		case 0x11: TCALL<1>(); break;
-		case 0x12: Addr_Dir(); CLR1<0>(); break;
-		case 0x13: Addr_Dir(); BBC<0>(); break;
-		case 0x14: Addr_DirIdxX(); OR_Acc(); break;
-		case 0x15: Addr_AbsIdxX(); OR_Acc(); break;
-		case 0x16: Addr_AbsIdxY(); OR_Acc(); break;
-		case 0x17: Addr_DirIndIdxY(); OR_Acc(); break;
-		case 0x18: Addr_DirImm(); OR(); break;
-		case 0x19: Addr_IndXToIndY(); OR(); break;
-		case 0x1A: Addr_Dir(); DECW(); break;
-		case 0x1B: Addr_DirIdxX(); ASL(); break;
-		case 0x1C: ASL_Acc(); break;
-		case 0x1D: DEX(); break;
-		case 0x1E: Addr_Abs(); CPX(); break;
-		case 0x1F: Addr_AbsIdxXInd(); JMP(); break;
-		case 0x20: CLRP(); break;
-		case 0x21: TCALL<2>(); break;
-		case 0x22: Addr_Dir(); SET1<1>(); break;
-		case 0x23: Addr_Dir(); BBS<1>(); break;
-		case 0x24: Addr_Dir(); AND_Acc(); break;
-		case 0x25: Addr_Abs(); AND_Acc(); break;
-		case 0x26: Addr_IndX(); AND_Acc(); break;
-		case 0x27: Addr_DirIdxXInd(); AND_Acc(); break;
-		case 0x28: Addr_Imm(); AND_Imm(); break;
-		case 0x29: Addr_DirToDir(); AND(); break;
-		case 0x2A: Addr_AbsBit(); NOR1(); break;
-		case 0x2B: Addr_Dir(); ROL(); break;
-		case 0x2C: Addr_Abs(); ROL(); break;
-		case 0x2D: PHA(); break;
-		case 0x2E: Addr_Dir(); CBNE(); break;
-		case 0x2F: Addr_Rel(); BRA(); break;
-		case 0x30: Addr_Rel(); BMI(); break;
-		case 0x31: TCALL<3>(); break;
-		case 0x32: Addr_Dir(); CLR1<1>(); break;
-		case 0x33: Addr_Dir(); BBC<1>(); break;
-		case 0x34: Addr_DirIdxX(); AND_Acc(); break;
-		case 0x35: Addr_AbsIdxX(); AND_Acc(); break;
-		case 0x36: Addr_AbsIdxY(); AND_Acc(); break;
-		case 0x37: Addr_DirIndIdxY(); AND_Acc(); break;
-		case 0x38: Addr_DirImm(); AND(); break;
-		case 0x39: Addr_IndXToIndY(); AND(); break;
-		case 0x3A: Addr_Dir(); INCW(); break;
-		case 0x3B: Addr_DirIdxX(); ROL(); break;
-		case 0x3C: ROL_Acc(); break;
-		case 0x3D: INX(); break;
-		case 0x3E: Addr_Dir(); CPX(); break;
-		case 0x3F: Addr_Abs(); JSR(); break;
-		case 0x40: SETP(); break;
-		case 0x41: TCALL<4>(); break;
-		case 0x42: Addr_Dir(); SET1<2>(); break;
-		case 0x43: Addr_Dir(); BBS<2>(); break;
-		case 0x44: Addr_Dir(); EOR_Acc(); break;
-		case 0x45: Addr_Abs(); EOR_Acc(); break;
-		case 0x46: Addr_IndX(); EOR_Acc(); break;
-		case 0x47: Addr_DirIdxXInd(); EOR_Acc(); break;
-		case 0x48: Addr_Imm(); EOR_Imm(); break;
-		case 0x49: Addr_DirToDir(); EOR(); break;
-		case 0x4A: Addr_AbsBit(); AND1(); break;
-		case 0x4B: Addr_Dir(); LSR(); break;
-		case 0x4C: Addr_Abs(); LSR(); break;
-		case 0x4D: PHX(); break;
-		case 0x4E: Addr_Abs(); TCLR1(); break;
-		case 0x4F: PCALL(); break;
-		case 0x50: Addr_Rel(); BVC(); break;
-		case 0x51: TCALL<5>(); break;
-		case 0x52: Addr_Dir(); CLR1<2>(); break;
-		case 0x53: Addr_Dir(); BBC<2>(); break;
-		case 0x54: Addr_DirIdxX(); EOR_Acc(); break;
-		case 0x55: Addr_AbsIdxX(); EOR_Acc(); break;
-		case 0x56: Addr_AbsIdxY(); EOR_Acc(); break;
-		case 0x57: Addr_DirIndIdxY(); EOR_Acc(); break;
-		case 0x58: Addr_DirImm(); EOR(); break;
-		case 0x59: Addr_IndXToIndY(); EOR(); break;
-		case 0x5A: Addr_Dir(); CMPW(); break;
-		case 0x5B: Addr_DirIdxX(); LSR(); break;
-		case 0x5C: LSR_Acc(); break;
-		case 0x5D: TAX(); break;
-		case 0x5E: Addr_Abs(); CPY(); break;
-		case 0x5F: Addr_Abs(); JMP(); break;
-		case 0x60: CLRC(); break;
-		case 0x61: TCALL<6>(); break;
-		case 0x62: Addr_Dir(); SET1<3>(); break;
-		case 0x63: Addr_Dir(); BBS<3>(); break;
-		case 0x64: Addr_Dir(); CMP_Acc(); break;
-		case 0x65: Addr_Abs(); CMP_Acc(); break;
-		case 0x66: Addr_IndX(); CMP_Acc(); break;
-		case 0x67: Addr_DirIdxXInd(); CMP_Acc(); break;
-		case 0x68: Addr_Imm(); CMP_Imm(); break;
-		case 0x69: Addr_DirToDir(); CMP(); break;
-		case 0x6A: Addr_AbsBit(); NAND1(); break;
-		case 0x6B: Addr_Dir(); ROR(); break;
-		case 0x6C: Addr_Abs(); ROR(); break;
-		case 0x6D: PHY(); break;
-		case 0x6E: Addr_Dir(); DBNZ(); break;
-		case 0x6F: RTS(); break;
-		case 0x70: Addr_Rel(); BVS(); break;
-		case 0x71: TCALL<7>(); break;
-		case 0x72: Addr_Dir(); CLR1<3>(); break;
-		case 0x73: Addr_Dir(); BBC<3>(); break;
-		case 0x74: Addr_DirIdxX(); CMP_Acc(); break;
-		case 0x75: Addr_AbsIdxX(); CMP_Acc(); break;
-		case 0x76: Addr_AbsIdxY(); CMP_Acc(); break;
-		case 0x77: Addr_DirIndIdxY(); CMP_Acc(); break;
-		case 0x78: Addr_DirImm(); CMP(); break;
-		case 0x79: Addr_IndXToIndY(); CMP(); break;
-		case 0x7A: Addr_Dir(); ADDW(); break;
-		case 0x7B: Addr_DirIdxX(); ROR(); break;
-		case 0x7C: ROR_Acc(); break;
-		case 0x7D: TXA(); break;
-		case 0x7E: Addr_Dir(); CPY(); break;
-		case 0x7F: RTI(); break;
-		case 0x80: SETC(); break;
-		case 0x81: TCALL<8>(); break;
-		case 0x82: Addr_Dir(); SET1<4>(); break;
-		case 0x83: Addr_Dir(); BBS<4>(); break;
-		case 0x84: Addr_Dir(); ADC_Acc(); break;
-		case 0x85: Addr_Abs(); ADC_Acc(); break;
-		case 0x86: Addr_IndX(); ADC_Acc(); break;
-		case 0x87: Addr_DirIdxXInd(); ADC_Acc(); break;
-		case 0x88: Addr_Imm(); ADC_Imm(); break;
-		case 0x89: Addr_DirToDir(); ADC(); break;
-		case 0x8A: Addr_AbsBit(); EOR1(); break;
-		case 0x8B: Addr_Dir(); DEC(); break;
-		case 0x8C: Addr_Abs(); DEC(); break;
-		case 0x8D: Addr_Imm(); LDY_Imm(); break;
-		case 0x8E: PLP(); break;
-		case 0x8F: Addr_DirImm(); MOV_Imm(); break;
-		case 0x90: Addr_Rel(); BCC(); break;
-		case 0x91: TCALL<9>(); break;
-		case 0x92: Addr_Dir(); CLR1<4>(); break;
-		case 0x93: Addr_Dir(); BBC<4>(); break;
-		case 0x94: Addr_DirIdxX(); ADC_Acc(); break;
-		case 0x95: Addr_AbsIdxX(); ADC_Acc(); break;
-		case 0x96: Addr_AbsIdxY(); ADC_Acc(); break;
-		case 0x97: Addr_DirIndIdxY(); ADC_Acc(); break;
-		case 0x98: Addr_DirImm(); ADC(); break;
-		case 0x99: Addr_IndXToIndY(); ADC(); break;
-		case 0x9A: Addr_Dir(); SUBW(); break;
-		case 0x9B: Addr_DirIdxX(); DEC(); break;
-		case 0x9C: DEC_Acc(); break;
-		case 0x9D: TSX(); break;
-		case 0x9E: DIV(); break;
-		case 0x9F: XCN(); break;
-		case 0xA0: EI(); break;
-		case 0xA1: TCALL<10>(); break;
-		case 0xA2: Addr_Dir(); SET1<5>(); break;
-		case 0xA3: Addr_Dir(); BBS<5>(); break;
-		case 0xA4: Addr_Dir(); SBC_Acc(); break;
-		case 0xA5: Addr_Abs(); SBC_Acc(); break;
-		case 0xA6: Addr_IndX(); SBC_Acc(); break;
-		case 0xA7: Addr_DirIdxXInd(); SBC_Acc(); break;
-		case 0xA8: Addr_Imm(); SBC_Imm(); break;
-		case 0xA9: Addr_DirToDir(); SBC(); break;
-		case 0xAA: Addr_AbsBit(); LDC(); break;
-		case 0xAB: Addr_Dir(); INC(); break;
-		case 0xAC: Addr_Abs(); INC(); break;
-		case 0xAD: Addr_Imm(); CPY_Imm(); break;
-		case 0xAE: PLA(); break;
-		case 0xAF: Addr_IndX(); STA_AutoIncX(); break;
-		case 0xB0: Addr_Rel(); BCS(); break;
-		case 0xB1: TCALL<11>(); break;
-		case 0xB2: Addr_Dir(); CLR1<5>(); break;
-		case 0xB3: Addr_Dir(); BBC<5>(); break;
-		case 0xB4: Addr_DirIdxX(); SBC_Acc(); break;
-		case 0xB5: Addr_AbsIdxX(); SBC_Acc(); break;
-		case 0xB6: Addr_AbsIdxY(); SBC_Acc(); break;
-		case 0xB7: Addr_DirIndIdxY(); SBC_Acc(); break;
-		case 0xB8: Addr_DirImm(); SBC(); break;
-		case 0xB9: Addr_IndXToIndY(); SBC(); break;
-		case 0xBA: Addr_Dir(); LDW(); break;
-		case 0xBB: Addr_DirIdxX(); INC(); break;
-		case 0xBC: INC_Acc(); break;
-		case 0xBD: TXS(); break;
-		case 0xBE: DAS(); break;
-		case 0xBF: Addr_IndX(); LDA_AutoIncX(); break;
-		case 0xC0: DI(); break;
-		case 0xC1: TCALL<12>(); break;
-		case 0xC2: Addr_Dir(); SET1<6>(); break;
-		case 0xC3: Addr_Dir(); BBS<6>(); break;
-		case 0xC4: Addr_Dir(); STA(); break;
-		case 0xC5: Addr_Abs(); STA(); break;
-		case 0xC6: Addr_IndX(); STA(); break;
-		case 0xC7: Addr_DirIdxXInd(); STA(); break;
-		case 0xC8: Addr_Imm(); CPX_Imm(); break;
-		case 0xC9: Addr_Abs(); STX(); break;
-		case 0xCA: Addr_AbsBit(); STC(); break;
-		case 0xCB: Addr_Dir(); STY(); break;
-		case 0xCC: Addr_Abs(); STY(); break;
-		case 0xCD: Addr_Imm(); LDX_Imm(); break;
-		case 0xCE: PLX(); break;
-		case 0xCF: MUL(); break;
-		case 0xD0: Addr_Rel(); BNE(); break;
-		case 0xD1: TCALL<13>(); break;
-		case 0xD2: Addr_Dir(); CLR1<6>(); break;
-		case 0xD3: Addr_Dir(); BBC<6>(); break;
-		case 0xD4: Addr_DirIdxX(); STA(); break;
-		case 0xD5: Addr_AbsIdxX(); STA(); break;
-		case 0xD6: Addr_AbsIdxY(); STA(); break;
-		case 0xD7: Addr_DirIndIdxY(); STA(); break;
-		case 0xD8: Addr_Dir(); STX(); break;
-		case 0xD9: Addr_DirIdxY(); STX(); break;
-		case 0xDA: Addr_Dir(); STW(); break;
-		case 0xDB: Addr_DirIdxX(); STY(); break;
-		case 0xDC: DEY(); break;
-		case 0xDD: TYA(); break;
-		case 0xDE: Addr_DirIdxX(); CBNE(); break;
-		case 0xDF: DAA(); break;
-		case 0xE0: CLRV(); break;
-		case 0xE1: TCALL<14>(); break;
-		case 0xE2: Addr_Dir(); SET1<7>(); break;
-		case 0xE3: Addr_Dir(); BBS<7>(); break;
-		case 0xE4: Addr_Dir(); LDA(); break;
-		case 0xE5: Addr_Abs(); LDA(); break;
-		case 0xE6: Addr_IndX(); LDA(); break;
-		case 0xE7: Addr_DirIdxXInd(); LDA(); break;
-		case 0xE8: Addr_Imm(); LDA_Imm(); break;
-		case 0xE9: Addr_Abs(); LDX(); break;
-		case 0xEA: Addr_AbsBit(); NOT1(); break;
-		case 0xEB: Addr_Dir(); LDY(); break;
-		case 0xEC: Addr_Abs(); LDY(); break;
-		case 0xED: NOTC(); break;
-		case 0xEE: PLY(); break;
-		case 0xEF: SLEEP(); break;
-		case 0xF0: Addr_Rel(); BEQ(); break;
-		case 0xF1: TCALL<15>(); break;
-		case 0xF2: Addr_Dir(); CLR1<7>(); break;
-		case 0xF3: Addr_Dir(); BBC<7>(); break;
-		case 0xF4: Addr_DirIdxX(); LDA(); break;
-		case 0xF5: Addr_AbsIdxX(); LDA(); break;
-		case 0xF6: Addr_AbsIdxY(); LDA(); break;
-		case 0xF7: Addr_DirIndIdxY(); LDA(); break;
-		case 0xF8: Addr_Dir(); LDX(); break;
-		case 0xF9: Addr_DirIdxY(); LDX(); break;
-		case 0xFA: Addr_DirToDir(); MOV(); break;
-		case 0xFB: Addr_DirIdxX(); LDY(); break;
-		case 0xFC: INY(); break;
-		case 0xFD: TAY(); break;
-		case 0xFE: DBNZ_Y(); break;
-		case 0xFF: STOP(); break;
+	EndCycle();
+	if((int64_t)_state.Cycle >= _targetCycle) {
+		return false;
 	}
 
-	if(_opStep == SpcOpStep::AfterAddressing) {
-		_opStep = SpcOpStep::Operation;
+	if(_opStep == SpcOpStep::ReadOpCode) {
+		StartOp();
+		EndCycle();
+		return (int64_t)_state.Cycle < _targetCycle;
 	}
+	return true;
+}
+#endif
+
+#if defined(MESEN_COMPUTED_GOTO) && !defined(DUMMYSPC)
+	//Each handler runs the next cycle itself (either the current op's next step, or the next op), until the target cycle is reached
+	#define OPCODE_CHAIN if(ChainNextCycle()) { OPCODE_DISPATCH(_opCode); } return
+#else
+	#define OPCODE_CHAIN
+#endif
+
+void Spc::Exec()
+{
+	OPCODE_SWITCH(_opCode) {
+		OPCODE_CASE(0x00): NOP(); OPCODE_NEXT;
+		OPCODE_CASE(0x01): TCALL<0>(); OPCODE_NEXT;
+		OPCODE_CASE(0x02): Addr_Dir(); SET1<0>(); OPCODE_NEXT;
+		OPCODE_CASE(0x03): Addr_Dir(); BBS<0>(); OPCODE_NEXT;
+		OPCODE_CASE(0x04): Addr_Dir(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x05): Addr_Abs(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x06): Addr_IndX(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x07): Addr_DirIdxXInd(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x08): Addr_Imm(); OR_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0x09): Addr_DirToDir(); OR(); OPCODE_NEXT;
+		OPCODE_CASE(0x0A): Addr_AbsBit(); OR1(); OPCODE_NEXT;
+		OPCODE_CASE(0x0B): Addr_Dir(); ASL(); OPCODE_NEXT;
+		OPCODE_CASE(0x0C): Addr_Abs(); ASL(); OPCODE_NEXT;
+		OPCODE_CASE(0x0D): PHP(); OPCODE_NEXT;
+		OPCODE_CASE(0x0E): Addr_Abs(); TSET1(); OPCODE_NEXT;
+		OPCODE_CASE(0x0F): BRK(); OPCODE_NEXT;
+		OPCODE_CASE(0x10): Addr_Rel(); BPL(); OPCODE_NEXT;
+		OPCODE_CASE(0x11): TCALL<1>(); OPCODE_NEXT;
+		OPCODE_CASE(0x12): Addr_Dir(); CLR1<0>(); OPCODE_NEXT;
+		OPCODE_CASE(0x13): Addr_Dir(); BBC<0>(); OPCODE_NEXT;
+		OPCODE_CASE(0x14): Addr_DirIdxX(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x15): Addr_AbsIdxX(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x16): Addr_AbsIdxY(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x17): Addr_DirIndIdxY(); OR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x18): Addr_DirImm(); OR(); OPCODE_NEXT;
+		OPCODE_CASE(0x19): Addr_IndXToIndY(); OR(); OPCODE_NEXT;
+		OPCODE_CASE(0x1A): Addr_Dir(); DECW(); OPCODE_NEXT;
+		OPCODE_CASE(0x1B): Addr_DirIdxX(); ASL(); OPCODE_NEXT;
+		OPCODE_CASE(0x1C): ASL_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x1D): DEX(); OPCODE_NEXT;
+		OPCODE_CASE(0x1E): Addr_Abs(); CPX(); OPCODE_NEXT;
+		OPCODE_CASE(0x1F): Addr_AbsIdxXInd(); JMP(); OPCODE_NEXT;
+		OPCODE_CASE(0x20): CLRP(); OPCODE_NEXT;
+		OPCODE_CASE(0x21): TCALL<2>(); OPCODE_NEXT;
+		OPCODE_CASE(0x22): Addr_Dir(); SET1<1>(); OPCODE_NEXT;
+		OPCODE_CASE(0x23): Addr_Dir(); BBS<1>(); OPCODE_NEXT;
+		OPCODE_CASE(0x24): Addr_Dir(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x25): Addr_Abs(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x26): Addr_IndX(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x27): Addr_DirIdxXInd(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x28): Addr_Imm(); AND_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0x29): Addr_DirToDir(); AND(); OPCODE_NEXT;
+		OPCODE_CASE(0x2A): Addr_AbsBit(); NOR1(); OPCODE_NEXT;
+		OPCODE_CASE(0x2B): Addr_Dir(); ROL(); OPCODE_NEXT;
+		OPCODE_CASE(0x2C): Addr_Abs(); ROL(); OPCODE_NEXT;
+		OPCODE_CASE(0x2D): PHA(); OPCODE_NEXT;
+		OPCODE_CASE(0x2E): Addr_Dir(); CBNE(); OPCODE_NEXT;
+		OPCODE_CASE(0x2F): Addr_Rel(); BRA(); OPCODE_NEXT;
+		OPCODE_CASE(0x30): Addr_Rel(); BMI(); OPCODE_NEXT;
+		OPCODE_CASE(0x31): TCALL<3>(); OPCODE_NEXT;
+		OPCODE_CASE(0x32): Addr_Dir(); CLR1<1>(); OPCODE_NEXT;
+		OPCODE_CASE(0x33): Addr_Dir(); BBC<1>(); OPCODE_NEXT;
+		OPCODE_CASE(0x34): Addr_DirIdxX(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x35): Addr_AbsIdxX(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x36): Addr_AbsIdxY(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x37): Addr_DirIndIdxY(); AND_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x38): Addr_DirImm(); AND(); OPCODE_NEXT;
+		OPCODE_CASE(0x39): Addr_IndXToIndY(); AND(); OPCODE_NEXT;
+		OPCODE_CASE(0x3A): Addr_Dir(); INCW(); OPCODE_NEXT;
+		OPCODE_CASE(0x3B): Addr_DirIdxX(); ROL(); OPCODE_NEXT;
+		OPCODE_CASE(0x3C): ROL_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x3D): INX(); OPCODE_NEXT;
+		OPCODE_CASE(0x3E): Addr_Dir(); CPX(); OPCODE_NEXT;
+		OPCODE_CASE(0x3F): Addr_Abs(); JSR(); OPCODE_NEXT;
+		OPCODE_CASE(0x40): SETP(); OPCODE_NEXT;
+		OPCODE_CASE(0x41): TCALL<4>(); OPCODE_NEXT;
+		OPCODE_CASE(0x42): Addr_Dir(); SET1<2>(); OPCODE_NEXT;
+		OPCODE_CASE(0x43): Addr_Dir(); BBS<2>(); OPCODE_NEXT;
+		OPCODE_CASE(0x44): Addr_Dir(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x45): Addr_Abs(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x46): Addr_IndX(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x47): Addr_DirIdxXInd(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x48): Addr_Imm(); EOR_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0x49): Addr_DirToDir(); EOR(); OPCODE_NEXT;
+		OPCODE_CASE(0x4A): Addr_AbsBit(); AND1(); OPCODE_NEXT;
+		OPCODE_CASE(0x4B): Addr_Dir(); LSR(); OPCODE_NEXT;
+		OPCODE_CASE(0x4C): Addr_Abs(); LSR(); OPCODE_NEXT;
+		OPCODE_CASE(0x4D): PHX(); OPCODE_NEXT;
+		OPCODE_CASE(0x4E): Addr_Abs(); TCLR1(); OPCODE_NEXT;
+		OPCODE_CASE(0x4F): PCALL(); OPCODE_NEXT;
+		OPCODE_CASE(0x50): Addr_Rel(); BVC(); OPCODE_NEXT;
+		OPCODE_CASE(0x51): TCALL<5>(); OPCODE_NEXT;
+		OPCODE_CASE(0x52): Addr_Dir(); CLR1<2>(); OPCODE_NEXT;
+		OPCODE_CASE(0x53): Addr_Dir(); BBC<2>(); OPCODE_NEXT;
+		OPCODE_CASE(0x54): Addr_DirIdxX(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x55): Addr_AbsIdxX(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x56): Addr_AbsIdxY(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x57): Addr_DirIndIdxY(); EOR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x58): Addr_DirImm(); EOR(); OPCODE_NEXT;
+		OPCODE_CASE(0x59): Addr_IndXToIndY(); EOR(); OPCODE_NEXT;
+		OPCODE_CASE(0x5A): Addr_Dir(); CMPW(); OPCODE_NEXT;
+		OPCODE_CASE(0x5B): Addr_DirIdxX(); LSR(); OPCODE_NEXT;
+		OPCODE_CASE(0x5C): LSR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x5D): TAX(); OPCODE_NEXT;
+		OPCODE_CASE(0x5E): Addr_Abs(); CPY(); OPCODE_NEXT;
+		OPCODE_CASE(0x5F): Addr_Abs(); JMP(); OPCODE_NEXT;
+		OPCODE_CASE(0x60): CLRC(); OPCODE_NEXT;
+		OPCODE_CASE(0x61): TCALL<6>(); OPCODE_NEXT;
+		OPCODE_CASE(0x62): Addr_Dir(); SET1<3>(); OPCODE_NEXT;
+		OPCODE_CASE(0x63): Addr_Dir(); BBS<3>(); OPCODE_NEXT;
+		OPCODE_CASE(0x64): Addr_Dir(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x65): Addr_Abs(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x66): Addr_IndX(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x67): Addr_DirIdxXInd(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x68): Addr_Imm(); CMP_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0x69): Addr_DirToDir(); CMP(); OPCODE_NEXT;
+		OPCODE_CASE(0x6A): Addr_AbsBit(); NAND1(); OPCODE_NEXT;
+		OPCODE_CASE(0x6B): Addr_Dir(); ROR(); OPCODE_NEXT;
+		OPCODE_CASE(0x6C): Addr_Abs(); ROR(); OPCODE_NEXT;
+		OPCODE_CASE(0x6D): PHY(); OPCODE_NEXT;
+		OPCODE_CASE(0x6E): Addr_Dir(); DBNZ(); OPCODE_NEXT;
+		OPCODE_CASE(0x6F): RTS(); OPCODE_NEXT;
+		OPCODE_CASE(0x70): Addr_Rel(); BVS(); OPCODE_NEXT;
+		OPCODE_CASE(0x71): TCALL<7>(); OPCODE_NEXT;
+		OPCODE_CASE(0x72): Addr_Dir(); CLR1<3>(); OPCODE_NEXT;
+		OPCODE_CASE(0x73): Addr_Dir(); BBC<3>(); OPCODE_NEXT;
+		OPCODE_CASE(0x74): Addr_DirIdxX(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x75): Addr_AbsIdxX(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x76): Addr_AbsIdxY(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x77): Addr_DirIndIdxY(); CMP_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x78): Addr_DirImm(); CMP(); OPCODE_NEXT;
+		OPCODE_CASE(0x79): Addr_IndXToIndY(); CMP(); OPCODE_NEXT;
+		OPCODE_CASE(0x7A): Addr_Dir(); ADDW(); OPCODE_NEXT;
+		OPCODE_CASE(0x7B): Addr_DirIdxX(); ROR(); OPCODE_NEXT;
+		OPCODE_CASE(0x7C): ROR_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x7D): TXA(); OPCODE_NEXT;
+		OPCODE_CASE(0x7E): Addr_Dir(); CPY(); OPCODE_NEXT;
+		OPCODE_CASE(0x7F): RTI(); OPCODE_NEXT;
+		OPCODE_CASE(0x80): SETC(); OPCODE_NEXT;
+		OPCODE_CASE(0x81): TCALL<8>(); OPCODE_NEXT;
+		OPCODE_CASE(0x82): Addr_Dir(); SET1<4>(); OPCODE_NEXT;
+		OPCODE_CASE(0x83): Addr_Dir(); BBS<4>(); OPCODE_NEXT;
+		OPCODE_CASE(0x84): Addr_Dir(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x85): Addr_Abs(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x86): Addr_IndX(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x87): Addr_DirIdxXInd(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x88): Addr_Imm(); ADC_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0x89): Addr_DirToDir(); ADC(); OPCODE_NEXT;
+		OPCODE_CASE(0x8A): Addr_AbsBit(); EOR1(); OPCODE_NEXT;
+		OPCODE_CASE(0x8B): Addr_Dir(); DEC(); OPCODE_NEXT;
+		OPCODE_CASE(0x8C): Addr_Abs(); DEC(); OPCODE_NEXT;
+		OPCODE_CASE(0x8D): Addr_Imm(); LDY_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0x8E): PLP(); OPCODE_NEXT;
+		OPCODE_CASE(0x8F): Addr_DirImm(); MOV_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0x90): Addr_Rel(); BCC(); OPCODE_NEXT;
+		OPCODE_CASE(0x91): TCALL<9>(); OPCODE_NEXT;
+		OPCODE_CASE(0x92): Addr_Dir(); CLR1<4>(); OPCODE_NEXT;
+		OPCODE_CASE(0x93): Addr_Dir(); BBC<4>(); OPCODE_NEXT;
+		OPCODE_CASE(0x94): Addr_DirIdxX(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x95): Addr_AbsIdxX(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x96): Addr_AbsIdxY(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x97): Addr_DirIndIdxY(); ADC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x98): Addr_DirImm(); ADC(); OPCODE_NEXT;
+		OPCODE_CASE(0x99): Addr_IndXToIndY(); ADC(); OPCODE_NEXT;
+		OPCODE_CASE(0x9A): Addr_Dir(); SUBW(); OPCODE_NEXT;
+		OPCODE_CASE(0x9B): Addr_DirIdxX(); DEC(); OPCODE_NEXT;
+		OPCODE_CASE(0x9C): DEC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0x9D): TSX(); OPCODE_NEXT;
+		OPCODE_CASE(0x9E): DIV(); OPCODE_NEXT;
+		OPCODE_CASE(0x9F): XCN(); OPCODE_NEXT;
+		OPCODE_CASE(0xA0): EI(); OPCODE_NEXT;
+		OPCODE_CASE(0xA1): TCALL<10>(); OPCODE_NEXT;
+		OPCODE_CASE(0xA2): Addr_Dir(); SET1<5>(); OPCODE_NEXT;
+		OPCODE_CASE(0xA3): Addr_Dir(); BBS<5>(); OPCODE_NEXT;
+		OPCODE_CASE(0xA4): Addr_Dir(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xA5): Addr_Abs(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xA6): Addr_IndX(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xA7): Addr_DirIdxXInd(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xA8): Addr_Imm(); SBC_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0xA9): Addr_DirToDir(); SBC(); OPCODE_NEXT;
+		OPCODE_CASE(0xAA): Addr_AbsBit(); LDC(); OPCODE_NEXT;
+		OPCODE_CASE(0xAB): Addr_Dir(); INC(); OPCODE_NEXT;
+		OPCODE_CASE(0xAC): Addr_Abs(); INC(); OPCODE_NEXT;
+		OPCODE_CASE(0xAD): Addr_Imm(); CPY_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0xAE): PLA(); OPCODE_NEXT;
+		OPCODE_CASE(0xAF): Addr_IndX(); STA_AutoIncX(); OPCODE_NEXT;
+		OPCODE_CASE(0xB0): Addr_Rel(); BCS(); OPCODE_NEXT;
+		OPCODE_CASE(0xB1): TCALL<11>(); OPCODE_NEXT;
+		OPCODE_CASE(0xB2): Addr_Dir(); CLR1<5>(); OPCODE_NEXT;
+		OPCODE_CASE(0xB3): Addr_Dir(); BBC<5>(); OPCODE_NEXT;
+		OPCODE_CASE(0xB4): Addr_DirIdxX(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xB5): Addr_AbsIdxX(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xB6): Addr_AbsIdxY(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xB7): Addr_DirIndIdxY(); SBC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xB8): Addr_DirImm(); SBC(); OPCODE_NEXT;
+		OPCODE_CASE(0xB9): Addr_IndXToIndY(); SBC(); OPCODE_NEXT;
+		OPCODE_CASE(0xBA): Addr_Dir(); LDW(); OPCODE_NEXT;
+		OPCODE_CASE(0xBB): Addr_DirIdxX(); INC(); OPCODE_NEXT;
+		OPCODE_CASE(0xBC): INC_Acc(); OPCODE_NEXT;
+		OPCODE_CASE(0xBD): TXS(); OPCODE_NEXT;
+		OPCODE_CASE(0xBE): DAS(); OPCODE_NEXT;
+		OPCODE_CASE(0xBF): Addr_IndX(); LDA_AutoIncX(); OPCODE_NEXT;
+		OPCODE_CASE(0xC0): DI(); OPCODE_NEXT;
+		OPCODE_CASE(0xC1): TCALL<12>(); OPCODE_NEXT;
+		OPCODE_CASE(0xC2): Addr_Dir(); SET1<6>(); OPCODE_NEXT;
+		OPCODE_CASE(0xC3): Addr_Dir(); BBS<6>(); OPCODE_NEXT;
+		OPCODE_CASE(0xC4): Addr_Dir(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xC5): Addr_Abs(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xC6): Addr_IndX(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xC7): Addr_DirIdxXInd(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xC8): Addr_Imm(); CPX_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0xC9): Addr_Abs(); STX(); OPCODE_NEXT;
+		OPCODE_CASE(0xCA): Addr_AbsBit(); STC(); OPCODE_NEXT;
+		OPCODE_CASE(0xCB): Addr_Dir(); STY(); OPCODE_NEXT;
+		OPCODE_CASE(0xCC): Addr_Abs(); STY(); OPCODE_NEXT;
+		OPCODE_CASE(0xCD): Addr_Imm(); LDX_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0xCE): PLX(); OPCODE_NEXT;
+		OPCODE_CASE(0xCF): MUL(); OPCODE_NEXT;
+		OPCODE_CASE(0xD0): Addr_Rel(); BNE(); OPCODE_NEXT;
+		OPCODE_CASE(0xD1): TCALL<13>(); OPCODE_NEXT;
+		OPCODE_CASE(0xD2): Addr_Dir(); CLR1<6>(); OPCODE_NEXT;
+		OPCODE_CASE(0xD3): Addr_Dir(); BBC<6>(); OPCODE_NEXT;
+		OPCODE_CASE(0xD4): Addr_DirIdxX(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xD5): Addr_AbsIdxX(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xD6): Addr_AbsIdxY(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xD7): Addr_DirIndIdxY(); STA(); OPCODE_NEXT;
+		OPCODE_CASE(0xD8): Addr_Dir(); STX(); OPCODE_NEXT;
+		OPCODE_CASE(0xD9): Addr_DirIdxY(); STX(); OPCODE_NEXT;
+		OPCODE_CASE(0xDA): Addr_Dir(); STW(); OPCODE_NEXT;
+		OPCODE_CASE(0xDB): Addr_DirIdxX(); STY(); OPCODE_NEXT;
+		OPCODE_CASE(0xDC): DEY(); OPCODE_NEXT;
+		OPCODE_CASE(0xDD): TYA(); OPCODE_NEXT;
+		OPCODE_CASE(0xDE): Addr_DirIdxX(); CBNE(); OPCODE_NEXT;
+		OPCODE_CASE(0xDF): DAA(); OPCODE_NEXT;
+		OPCODE_CASE(0xE0): CLRV(); OPCODE_NEXT;
+		OPCODE_CASE(0xE1): TCALL<14>(); OPCODE_NEXT;
+		OPCODE_CASE(0xE2): Addr_Dir(); SET1<7>(); OPCODE_NEXT;
+		OPCODE_CASE(0xE3): Addr_Dir(); BBS<7>(); OPCODE_NEXT;
+		OPCODE_CASE(0xE4): Addr_Dir(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xE5): Addr_Abs(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xE6): Addr_IndX(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xE7): Addr_DirIdxXInd(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xE8): Addr_Imm(); LDA_Imm(); OPCODE_NEXT;
+		OPCODE_CASE(0xE9): Addr_Abs(); LDX(); OPCODE_NEXT;
+		OPCODE_CASE(0xEA): Addr_AbsBit(); NOT1(); OPCODE_NEXT;
+		OPCODE_CASE(0xEB): Addr_Dir(); LDY(); OPCODE_NEXT;
+		OPCODE_CASE(0xEC): Addr_Abs(); LDY(); OPCODE_NEXT;
+		OPCODE_CASE(0xED): NOTC(); OPCODE_NEXT;
+		OPCODE_CASE(0xEE): PLY(); OPCODE_NEXT;
+		OPCODE_CASE(0xEF): SLEEP(); OPCODE_NEXT;
+		OPCODE_CASE(0xF0): Addr_Rel(); BEQ(); OPCODE_NEXT;
+		OPCODE_CASE(0xF1): TCALL<15>(); OPCODE_NEXT;
+		OPCODE_CASE(0xF2): Addr_Dir(); CLR1<7>(); OPCODE_NEXT;
+		OPCODE_CASE(0xF3): Addr_Dir(); BBC<7>(); OPCODE_NEXT;
+		OPCODE_CASE(0xF4): Addr_DirIdxX(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xF5): Addr_AbsIdxX(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xF6): Addr_AbsIdxY(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xF7): Addr_DirIndIdxY(); LDA(); OPCODE_NEXT;
+		OPCODE_CASE(0xF8): Addr_Dir(); LDX(); OPCODE_NEXT;
+		OPCODE_CASE(0xF9): Addr_DirIdxY(); LDX(); OPCODE_NEXT;
+		OPCODE_CASE(0xFA): Addr_DirToDir(); MOV(); OPCODE_NEXT;
+		OPCODE_CASE(0xFB): Addr_DirIdxX(); LDY(); OPCODE_NEXT;
+		OPCODE_CASE(0xFC): INY(); OPCODE_NEXT;
+		OPCODE_CASE(0xFD): TAY(); OPCODE_NEXT;
+		OPCODE_CASE(0xFE): DBNZ_Y(); OPCODE_NEXT;
+		OPCODE_CASE(0xFF): STOP(); OPCODE_NEXT;
+	} OPCODE_SWITCH_END;
+
+	EndCycle();
 }
 
 //*****************
@@ -3,6 +3,7 @@
 #include "SNES/SnesConsole.h"
 #include "SNES/SnesMemoryManager.h"
 #include "SNES/SpcFileData.h"
+#include "SNES/SpcThread.h"
 #ifndef DUMMYSPC
 #include "SNES/DSP/Dsp.h"
 #else
@@ -59,8 +60,27 @@ Spc::Spc(SnesConsole* console)
 #ifndef DUMMYSPC
 Spc::~Spc()
 {
+	_thread.reset();
 	delete[] _ram;
 }
+
+void Spc::SetThreadEnabled(bool enabled)
+{
+	//Only enabled between frames - can be disabled in the middle of a frame when the debugger is started
+	if(enabled) {
+		if(_thread) {
+			//The master clock may have changed since the last frame (e.g after a reset)
+			_thread->ResetClock(_memoryManager->GetMasterClock());
+			_thread->Wake();
+		} else {
+			_thread.reset(new SpcThread(this, _memoryManager->GetMasterClock()));
+		}
+	} else if(_thread) {
+		//Let the thread process all queued port writes and catch up to the main cpu before stopping it
+		_thread->WaitForIdle();
+		_thread.reset();
+	}
+}
 #endif
 
 void Spc::Reset()
@@ -110,12 +130,11 @@ void Spc::SetSpcState(bool enabled)
 {
 	//Used by overclocking logic to disable SPC during the extra scanlines added to the PPU
 	if(_enabled != enabled) {
+		//Catch up SPC before disabling it (also waits for the SPC thread to be idle before changing its state)
+		Run();
 		if(enabled) {
 			//When re-enabling, adjust the cycle counter to prevent running extra cycles
 			UpdateClockRatio();
-		} else {
-			//Catch up SPC before disabling it
-			Run();
 		}
 		_enabled = enabled;
 	}
@@ -354,9 +373,21 @@ uint8_t Spc::CpuReadRegister(uint16_t addr)
 
 void Spc::CpuWriteRegister(uint32_t addr, uint8_t value)
 {
-	Run();
-	if(_state.NewCpuRegs[addr & 0x03] != value) {
-		_state.NewCpuRegs[addr & 0x03] = value;
+#ifndef DUMMYSPC
+	if(_thread) {
+		//The SPC thread applies the write once it reaches the current master clock
+		_thread->QueueWrite(_memoryManager->GetMasterClock(), addr & 0x03, value);
+		return;
+	}
+#endif
+	ProcessCpuWrite(_memoryManager->GetMasterClock(), addr & 0x03, value);
+}
+
+void Spc::ProcessCpuWrite(uint64_t masterClock, uint8_t addr, uint8_t value)
+{
+	RunUntil(masterClock);
+	if(_state.NewCpuRegs[addr] != value) {
+		_state.NewCpuRegs[addr] = value;
 
 		//If the CPU's write lands in the first half of the SPC cycle (each cycle is 2 clocks) then the SPC 
 		//can see the new value immediately, otherwise it only sees the new value on the following cycle.
@@ -364,8 +395,8 @@ void Spc::CpuWriteRegister(uint32_t addr, uint8_t value)
 		//However, always delaying to the next SPC cycle causes Kawasaki Superbike Challenge to freeze on boot.
 		//Delaying only when the write occurs in the SPC cycle's second half allows both games to work (at the default 32040hz.)
 		//This solution behaves as if the CPU values were latched/updated every 2mhz tick (which matches the SPC's input clock)
-		if(_memoryManager->GetMasterClock() * _clockRatio - _state.Cycle <= 1) {
-			_state.CpuRegs[addr & 0x03] = value;
+		if(masterClock * _clockRatio - _state.Cycle <= 1) {
+			_state.CpuRegs[addr] = value;
 		} else {
 			_pendingCpuRegUpdate = true;
 		}
@@ -451,6 +482,13 @@ uint8_t* Spc::GetSpcRom()
 
 void Spc::Serialize(Serializer &s)
 {
+#ifndef DUMMYSPC
+	if(_thread && !s.IsSaving()) {
+		//The master clock has already been overwritten at this point, wait for the SPC thread to be idle
+		_thread->WaitForIdle();
+	}
+#endif
+
 	if(s.IsSaving() && s.GetFormat() != SerializeFormat::Map) {
 		//Catch up SPC to main CPU before creating the state
 		Run();
@@ -489,6 +527,12 @@ void Spc::Serialize(Serializer &s)
 		SVArray(_state.NewCpuRegs, 4);
 		SV(_pendingCpuRegUpdate);
 	}
+
+#ifndef DUMMYSPC
+	if(_thread && !s.IsSaving()) {
+		_thread->ResetClock(_memoryManager->GetMasterClock());
+	}
+#endif
 }
 
 uint8_t Spc::GetOpCode()
@@ -11,12 +11,14 @@
 #include "SNES/SnesCpuTypes.h"
 #include "SNES/SpcTimer.h"
 #include "Shared/MemoryOperationType.h"
+#include "Shared/OpcodeDispatch.h"
 #include "Utilities/ISerializable.h"
 
 class SnesConsole;
 class Emulator;
 class SnesMemoryManager;
 class SpcFileData;
+class SpcThread;
 class Dsp;
 struct AddressInfo;
 
@@ -35,8 +37,12 @@ private:
 	SnesConsole* _console = nullptr;
 	SnesMemoryManager* _memoryManager = nullptr;
 	unique_ptr<Dsp> _dsp;
+#ifndef DUMMYSPC
+	unique_ptr<SpcThread> _thread;
+#endif
 
 	double _clockRatio = 0.0;
+	int64_t _targetCycle = 0;
 
 	/* Temporary data used in the middle of operations */
 	uint16_t _operandA = 0;
@@ -283,7 +289,16 @@ private:
 	void EndOp();
 	void EndAddr();
 	__forceinline void ProcessCycle();
+	__forceinline void StartOp();
+	__forceinline void EndCycle();
+	__forceinline bool ChainNextCycle();
+
+#ifdef MESEN_COMPUTED_GOTO
+	//Can't be inlined, the opcode label table is a static variable
+	void Exec();
+#else
 	__forceinline void Exec();
+#endif
 	
 	void UpdateClockRatio();
 	void ExitExecLoop();
@@ -295,8 +310,14 @@ public:
 	void SetSpcState(bool enabled);
 
 	void Run();
+	void RunUntil(uint64_t masterClock);
 	void Reset();
 
+#ifndef DUMMYSPC
+	void SetThreadEnabled(bool enabled);
+	SpcThread* GetThread() { return _thread.get(); }
+#endif
+
 	uint8_t DebugRead(uint16_t addr);
 	void DebugWrite(uint16_t addr, uint8_t value);
 
@@ -304,6 +325,7 @@ public:
 
 	uint8_t CpuReadRegister(uint16_t addr);
 	void CpuWriteRegister(uint32_t addr, uint8_t value);
+	void ProcessCpuWrite(uint64_t masterClock, uint8_t addr, uint8_t value);
 
 	uint8_t DspReadRam(uint16_t addr);
 	void DspWriteRam(uint16_t addr, uint8_t value);
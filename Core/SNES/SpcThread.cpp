@@ -0,0 +1,117 @@
+#include "pch.h"
+#include "SNES/SpcThread.h"
+#include "SNES/Spc.h"
+
+SpcThread::SpcThread(Spc* spc, uint64_t masterClock)
+{
+	_spc = spc;
+	_stopFlag = false;
+	_sleeping = false;
+	_queueHead = 0;
+	_queueTail = 0;
+	_targetClock = masterClock;
+	_currentClock = masterClock;
+	_thread.reset(new thread(&SpcThread::ThreadLoop, this));
+}
+
+SpcThread::~SpcThread()
+{
+	_stopFlag = true;
+	_wakeSignal.Signal();
+	_thread->join();
+}
+
+void SpcThread::ResetClock(uint64_t masterClock)
+{
+	_targetClock = masterClock;
+	_currentClock = masterClock;
+}
+
+void SpcThread::Wake()
+{
+	_wakeSignal.Signal();
+}
+
+void SpcThread::ThreadLoop()
+{
+	uint32_t idleCount = 0;
+	while(!_stopFlag) {
+		if(ProcessPendingWork()) {
+			idleCount = 0;
+		} else if(++idleCount < SpinCountBeforeYield) {
+			continue;
+		} else if(idleCount < SpinCountBeforeSleep) {
+			std::this_thread::yield();
+		} else {
+			//Nothing to do for a while (emulation is paused, waiting for the next frame, etc.)
+			_sleeping = true;
+			if(!ProcessPendingWork()) {
+				_wakeSignal.Wait(10);
+			}
+			_sleeping = false;
+			idleCount = 0;
+		}
+	}
+}
+
+bool SpcThread::ProcessPendingWork()
+{
+	uint64_t targetClock = _targetClock.load(std::memory_order_acquire);
+	uint32_t tail = _queueTail.load(std::memory_order_relaxed);
+
+	if(tail != _queueHead.load(std::memory_order_acquire)) {
+		//Writes are always at or after the last published clock, run up to the write and apply it
+		SpcPortWrite& write = _queue[tail & QueueMask];
+		_spc->ProcessCpuWrite(write.MasterClock, write.Addr, write.Value);
+		_currentClock.store(write.MasterClock, std::memory_order_release);
+		_queueTail.store(tail + 1, std::memory_order_release);
+		return true;
+	} else if(targetClock > _currentClock.load(std::memory_order_relaxed)) {
+		_spc->RunUntil(targetClock);
+		_currentClock.store(targetClock, std::memory_order_release);
+		return true;
+	}
+
+	return false;
+}
+
+void SpcThread::QueueWrite(uint64_t masterClock, uint8_t addr, uint8_t value)
+{
+	uint32_t head = _queueHead.load(std::memory_order_relaxed);
+	uint32_t spinCount = 0;
+	while(head - _queueTail.load(std::memory_order_acquire) >= QueueSize) {
+		//Queue is full, wait for the SPC thread to process some of the writes
+		WaitForThread(spinCount);
+	}
+
+	_queue[head & QueueMask] = { masterClock, addr, value };
+	_queueHead.store(head + 1, std::memory_order_release);
+}
+
+void SpcThread::WaitForClock(uint64_t masterClock)
+{
+	SetTargetClock(masterClock);
+
+	uint32_t head = _queueHead.load(std::memory_order_relaxed);
+	uint32_t spinCount = 0;
+	while(_queueTail.load(std::memory_order_acquire) != head || _currentClock.load(std::memory_order_acquire) < masterClock) {
+		WaitForThread(spinCount);
+	}
+}
+
+void SpcThread::WaitForThread(uint32_t& spinCount)
+{
+	if(_sleeping) {
+		_wakeSignal.Signal();
+	}
+
+	//Spin for a while (the SPC thread usually only needs a few microseconds to catch up), then start yielding
+	if(++spinCount >= SpinCountBeforeYield) {
+		std::this_thread::yield();
+	}
+}
+
+void SpcThread::WaitForIdle()
+{
+	WaitForClock(_targetClock.load(std::memory_order_relaxed));
+}
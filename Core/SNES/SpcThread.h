@@ -0,0 +1,66 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/AutoResetEvent.h"
+
+class Spc;
+
+//Runs the SPC (and the DSP) on a separate thread, in parallel with the main CPU.
+//The emulation thread publishes its master clock after each CPU instruction and the SPC thread
+//is allowed to run up to that point. Writes to the APU ports are queued along with the master clock
+//at which they occurred and are applied once the SPC reaches that clock, so the SPC behaves exactly
+//as it does when both run in lockstep (save states, movies and netplay are unaffected).
+//The emulation thread only has to wait for the SPC thread when it reads an APU port, or
+//when it needs to access the SPC's state (end of frame, save states, etc.)
+class SpcThread
+{
+private:
+	static constexpr uint32_t QueueSize = 0x100;
+	static constexpr uint32_t QueueMask = QueueSize - 1;
+	static constexpr uint32_t SpinCountBeforeYield = 0x400;
+	static constexpr uint32_t SpinCountBeforeSleep = 0x4000;
+
+	struct SpcPortWrite
+	{
+		uint64_t MasterClock;
+		uint8_t Addr;
+		uint8_t Value;
+	};
+
+	Spc* _spc = nullptr;
+	unique_ptr<thread> _thread;
+	atomic<bool> _stopFlag;
+
+	//Single producer (emulation thread), single consumer (spc thread) ring buffer
+	SpcPortWrite _queue[QueueSize] = {};
+	atomic<uint32_t> _queueHead;
+	atomic<uint32_t> _queueTail;
+
+	//Master clock the SPC is allowed to run to, and master clock it has reached
+	atomic<uint64_t> _targetClock;
+	atomic<uint64_t> _currentClock;
+
+	//Used to let the thread sleep while the emulation is paused or waiting for the next frame
+	AutoResetEvent _wakeSignal;
+	atomic<bool> _sleeping;
+
+	void ThreadLoop();
+	bool ProcessPendingWork();
+	void WaitForThread(uint32_t& spinCount);
+
+public:
+	SpcThread(Spc* spc, uint64_t masterClock);
+	~SpcThread();
+
+	//Must only be called while the SPC thread is idle (i.e after a call to WaitForClock)
+	void ResetClock(uint64_t masterClock);
+	void Wake();
+
+	__forceinline void SetTargetClock(uint64_t masterClock)
+	{
+		_targetClock.store(masterClock, std::memory_order_release);
+	}
+
+	void QueueWrite(uint64_t masterClock, uint8_t addr, uint8_t value);
+	void WaitForClock(uint64_t masterClock);
+	void WaitForIdle();
+};
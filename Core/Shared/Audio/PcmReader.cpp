@@ -8,10 +8,20 @@ PcmReader::PcmReader()
 	_done = true;
 	_loopOffset = 8;
 	_outputBuffer = new int16_t[20000];
+
+	_blocks.reset(new PcmBlock[BlockCacheSize]);
+	_underrunCount = 0;
+	_bufferedBlocks = 0;
+	_stopFlag = false;
+	_thread.reset(new thread(&PcmReader::ThreadLoop, this));
 }
 
 PcmReader::~PcmReader()
 {
+	_stopFlag = true;
+	_readAheadSignal.Signal();
+	_thread->join();
+
 	delete[] _outputBuffer;
 }
 
@@ -37,17 +47,23 @@ bool PcmReader::Init(string filename, bool loop, uint32_t startOffset)
 
 		_loopOffset = (uint32_t)loopOffset;
 
-		_prevLeft = 0;
-		_prevRight = 0;
 		_done = false;
 		_loop = loop;
-		_fileOffset = startOffset;
-		_file.seekg(_fileOffset, ios::beg);
+		_filename = filename;
+		_fileOffset = startOffset & ~0x03;
 
-		_leftoverSampleCount = 0;
 		_pcmBuffer.clear();
 		_resampler.Reset();
 
+		{
+			//Blocks that belong to the previous track can't be used anymore
+			std::lock_guard<std::mutex> lock(_blockLock);
+			_trackId++;
+		}
+
+		//Start reading the track's first blocks (and its loop point) right away, in the background
+		RequestReadAhead();
+
 		return true;
 	} else {
 		_done = true;
@@ -74,43 +90,173 @@ void PcmReader::SetLoopFlag(bool loop)
 	_loop = loop;
 }
 
-void PcmReader::ReadSample(int16_t &left, int16_t &right)
+void PcmReader::LoadSamples(uint32_t samplesToLoad)
 {
-	uint8_t val[4];
-	_file.get(((char*)val)[0]);
-	_file.get(((char*)val)[1]);
-	_file.get(((char*)val)[2]);
-	_file.get(((char*)val)[3]);
-
-	left = val[0] | (val[1] << 8);
-	right = val[2] | (val[3] << 8);
+	while(samplesToLoad > 0) {
+		if(_fileOffset + 4 > _fileSize) {
+			uint32_t loopPosition = _loopOffset * 4 + 8;
+			if(_loop && loopPosition + 4 <= _fileSize) {
+				_fileOffset = loopPosition;
+			} else {
+				_done = true;
+				break;
+			}
+		}
+
+		//Read as many samples as possible from the current block
+		uint32_t length = std::min(samplesToLoad * 4, (_fileSize - _fileOffset) & ~0x03);
+		length = std::min(length, PcmReader::BlockSize - (_fileOffset % PcmReader::BlockSize));
+		ReadData(_fileOffset, length);
+
+		_fileOffset += length;
+		samplesToLoad -= length / 4;
+	}
 }
 
-void PcmReader::LoadSamples(uint32_t samplesToLoad)
+void PcmReader::ReadData(uint32_t offset, uint32_t length)
 {
-	uint32_t samplesRead = 0;
+	uint32_t index = offset / PcmReader::BlockSize;
+	uint32_t blockOffset = offset % PcmReader::BlockSize;
+
+	auto appendSamples = [&](uint8_t* data, uint32_t size) {
+		for(uint32_t i = blockOffset; i < blockOffset + length; i += 2) {
+			_pcmBuffer.push_back(i + 1 < size ? (int16_t)(data[i] | (data[i + 1] << 8)) : 0);
+		}
+	};
 
-	int16_t left = 0;
-	int16_t right = 0;
-	for(uint32_t i = _fileOffset; i < _fileSize && samplesRead < samplesToLoad; i+=4) {
-		ReadSample(left, right);
+	{
+		std::lock_guard<std::mutex> lock(_blockLock);
+		PcmBlock* block = FindBlock(_trackId, index);
+		if(block) {
+			block->LastUse = ++_useCounter;
+			appendSamples(block->Data, block->Size);
+			return;
+		}
+	}
 
-		_pcmBuffer.push_back(left);
-		_pcmBuffer.push_back(right);
+	//Underrun - the read-ahead thread hasn't read this block yet, read it now
+	_underrunCount++;
+	uint8_t data[PcmReader::BlockSize];
+	uint32_t size = ReadBlock(_file, index, data);
+	AddBlock(_trackId, index, data, size);
+	appendSamples(data, size);
+}
 
-		_prevLeft = left;
-		_prevRight = right;
+void PcmReader::RequestReadAhead()
+{
+	{
+		std::lock_guard<std::mutex> lock(_blockLock);
+		_request = { _trackId, _filename, _fileOffset, _loopOffset * 4 + 8 };
 
-		_fileOffset += 4;
-		samplesRead++;
+		uint32_t bufferedBlocks = 0;
+		uint32_t index = _fileOffset / PcmReader::BlockSize;
+		while(bufferedBlocks < PcmReader::ReadAheadBlocks && FindBlock(_trackId, index + bufferedBlocks)) {
+			bufferedBlocks++;
+		}
+		_bufferedBlocks = bufferedBlocks;
+	}
 
-		if(samplesRead < samplesToLoad && i + 4 >= _fileSize) {
-			if(_loop) {
-				i = _loopOffset * 4 + 8;
-				_fileOffset = i;
-				_file.seekg(_fileOffset, ios::beg);
-			} else {
-				_done = true;
+	_readAheadSignal.Signal();
+}
+
+PcmReader::PcmBlock* PcmReader::FindBlock(uint32_t trackId, uint32_t index)
+{
+	for(uint32_t i = 0; i < PcmReader::BlockCacheSize; i++) {
+		if(_blocks[i].TrackId == trackId && _blocks[i].Index == (int32_t)index) {
+			return &_blocks[i];
+		}
+	}
+	return nullptr;
+}
+
+void PcmReader::AddBlock(uint32_t trackId, uint32_t index, uint8_t* data, uint32_t size)
+{
+	std::lock_guard<std::mutex> lock(_blockLock);
+	if(trackId != _trackId || FindBlock(trackId, index)) {
+		//Track was changed while the block was being read, or block was already added by the other thread
+		return;
+	}
+
+	//Replace a block from a previous track, or the least recently used block
+	PcmBlock* block = nullptr;
+	for(uint32_t i = 0; i < PcmReader::BlockCacheSize; i++) {
+		if(_blocks[i].TrackId != _trackId) {
+			block = &_blocks[i];
+			break;
+		} else if(!block || _blocks[i].LastUse < block->LastUse) {
+			block = &_blocks[i];
+		}
+	}
+
+	block->TrackId = trackId;
+	block->Index = (int32_t)index;
+	block->LastUse = ++_useCounter;
+	block->Size = size;
+	memcpy(block->Data, data, size);
+}
+
+uint32_t PcmReader::ReadBlock(ifstream& file, uint32_t index, uint8_t* out)
+{
+	file.clear();
+	file.seekg((std::streamoff)index * PcmReader::BlockSize, ios::beg);
+	file.read((char*)out, PcmReader::BlockSize);
+	return (uint32_t)file.gcount();
+}
+
+void PcmReader::ThreadLoop()
+{
+	//The thread uses its own file handle, the emulation thread only uses _file when an underrun occurs
+	ifstream file;
+	uint32_t fileTrackId = 0;
+	unique_ptr<uint8_t[]> data(new uint8_t[PcmReader::BlockSize]);
+
+	while(!_stopFlag) {
+		_readAheadSignal.Wait();
+
+		ReadAheadRequest request;
+		{
+			std::lock_guard<std::mutex> lock(_blockLock);
+			request = _request;
+		}
+
+		if(request.TrackId != fileTrackId) {
+			file.close();
+			file.clear();
+			file.open(request.Filename, ios::binary);
+			fileTrackId = request.TrackId;
+		}
+
+		if(!file.is_open()) {
+			continue;
+		}
+
+		//Read the blocks that follow the current position first, then the blocks at the loop point
+		vector<uint32_t> blocks;
+		for(uint32_t i = 0; i < PcmReader::ReadAheadBlocks; i++) {
+			blocks.push_back(request.Position / PcmReader::BlockSize + i);
+		}
+		for(uint32_t i = 0; i < PcmReader::LoopBlocks; i++) {
+			blocks.push_back(request.LoopPosition / PcmReader::BlockSize + i);
+		}
+
+		for(uint32_t index : blocks) {
+			{
+				std::lock_guard<std::mutex> lock(_blockLock);
+				if(_stopFlag || request.TrackId != _trackId) {
+					break;
+				}
+
+				PcmBlock* block = FindBlock(request.TrackId, index);
+				if(block) {
+					//Keep blocks that are about to be needed (e.g the loop point) in the cache
+					block->LastUse = ++_useCounter;
+					continue;
+				}
+			}
+
+			uint32_t size = ReadBlock(file, index, data.get());
+			if(size > 0) {
+				AddBlock(request.TrackId, index, data.get(), size);
 			}
 		}
 	}
@@ -126,6 +272,7 @@ void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume
 	if(samplesNeeded > 0) {
 		uint32_t samplesToLoad = samplesNeeded * PcmReader::PcmSampleRate / _sampleRate + 2;
 		LoadSamples(samplesToLoad);
+		RequestReadAhead();
 	}
 
 	uint32_t samplesRead = _resampler.Resample<false>(_pcmBuffer.data(), (uint32_t)_pcmBuffer.size() / 2, _outputBuffer, sampleCount);
@@ -140,4 +287,4 @@ void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume
 uint32_t PcmReader::GetOffset()
 {
 	return _fileOffset;
-}
\ No newline at end of file
+}
@@ -1,35 +1,80 @@
 #pragma once
 #include "pch.h"
+#include <mutex>
 #include "Utilities/Audio/stb_vorbis.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/AutoResetEvent.h"
 
+//Streams a MSU-1 .pcm file.
+//The file is read in blocks by a background thread, ahead of the current playback position (and at the loop
+//point), so that mixing audio doesn't have to wait on the disk. The playback position is only ever updated
+//by the emulation thread, so the thread's timing has no impact on the emulation. When a block isn't ready
+//in time (underrun), it is read synchronously instead.
 class PcmReader
 {
 private:
 	static constexpr int PcmSampleRate = 44100;
-	static constexpr int SamplesToRead = 100;
+	static constexpr uint32_t BlockSize = 0x4000; //4096 stereo samples (~93ms)
+	static constexpr uint32_t ReadAheadBlocks = 8;
+	static constexpr uint32_t LoopBlocks = 2;
+	static constexpr uint32_t BlockCacheSize = ReadAheadBlocks + LoopBlocks + 4;
+
+	struct PcmBlock
+	{
+		uint32_t TrackId = 0;
+		int32_t Index = -1;
+		uint32_t LastUse = 0;
+		uint32_t Size = 0;
+		uint8_t Data[BlockSize];
+	};
+
+	struct ReadAheadRequest
+	{
+		uint32_t TrackId;
+		string Filename;
+		uint32_t Position;
+		uint32_t LoopPosition;
+	};
 
 	int16_t* _outputBuffer = nullptr;
 
 	ifstream _file;
+	string _filename;
 	uint32_t _fileOffset = 0;
 	uint32_t _fileSize = 0;
 	uint32_t _loopOffset = 0;
 
-	int16_t _prevLeft = 0;
-	int16_t _prevRight = 0;
-
 	bool _loop = false;
 	bool _done = false;
 
 	HermiteResampler _resampler;
 	vector<int16_t> _pcmBuffer;
-	uint32_t _leftoverSampleCount = 0;
 
 	uint32_t _sampleRate = 0;
 
+	//Shared with the read-ahead thread
+	std::mutex _blockLock;
+	unique_ptr<PcmBlock[]> _blocks;
+	uint32_t _useCounter = 0;
+	uint32_t _trackId = 0;
+	ReadAheadRequest _request = {};
+
+	unique_ptr<thread> _thread;
+	atomic<bool> _stopFlag;
+	AutoResetEvent _readAheadSignal;
+
+	atomic<uint32_t> _underrunCount;
+	atomic<uint32_t> _bufferedBlocks;
+
 	void LoadSamples(uint32_t samplesToLoad);
-	void ReadSample(int16_t &left, int16_t &right);
+	void ReadData(uint32_t offset, uint32_t length);
+	void RequestReadAhead();
+
+	PcmBlock* FindBlock(uint32_t trackId, uint32_t index);
+	void AddBlock(uint32_t trackId, uint32_t index, uint8_t* data, uint32_t size);
+	static uint32_t ReadBlock(ifstream& file, uint32_t index, uint8_t* out);
+
+	void ThreadLoop();
 
 public:
 	PcmReader();
@@ -41,4 +86,7 @@ public:
 	void SetLoopFlag(bool loop);
 	void ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume);
 	uint32_t GetOffset();
+
+	uint32_t GetUnderrunCount() { return _underrunCount; }
+	uint32_t GetBufferedDuration() { return _bufferedBlocks * (BlockSize / 4) * 1000 / PcmSampleRate; }
 };
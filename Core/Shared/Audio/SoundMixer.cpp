@@ -67,11 +67,12 @@ void SoundMixer::StopAudio(bool clearBuffer)
 
 void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_t sourceRate)
 {
-	if(sampleCount == 0) {
+	EmuSettings* settings = _emu->GetSettings();
+	if(sampleCount == 0 || settings->CheckFlag(EmulationFlags::Headless)) {
+		//No audio output is needed, skip resampling/mixing/effects
 		return;
 	}
 
-	EmuSettings* settings = _emu->GetSettings();
 	AudioPlayerHud* audioPlayer = _emu->GetAudioPlayerHud();
 	AudioConfig cfg = settings->GetAudioConfig();
 	bool isRecording = _waveRecorder || _emu->GetVideoRenderer()->IsRecording();
@@ -3,11 +3,20 @@
 #include "Utilities/VirtualFile.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/StringUtilities.h"
+#include "Utilities/CRC32.h"
+
+BatteryManager::BatteryManager()
+{
+	_writeFailed = false;
+}
 
 void BatteryManager::Initialize(string romName, bool setBatteryFlag)
 {
 	_romName = romName;
 	_hasBattery = setBatteryFlag;
+
+	auto lock = _fileLock.AcquireSafe();
+	_files.clear();
 }
 
 string BatteryManager::GetBasePath(string& extension)
@@ -37,10 +46,231 @@ void BatteryManager::SaveBattery(string extension, uint8_t* data, uint32_t lengt
 	}
 
 	_hasBattery = true;
-	ofstream out(GetBasePath(extension), ios::binary);
-	if(out) {
-		out.write((char*)data, length);
+
+	string filepath = GetBasePath(extension);
+	auto lock = _fileLock.AcquireSafe();
+
+	auto result = _files.find(filepath);
+	if(result == _files.end() || _writeFailed) {
+		//The file's current content is unknown (never loaded, or a write failed), write the whole file
+		WriteFile(filepath, vector<uint8_t>(data, data + length));
+		return;
+	}
+
+	BatteryFileState& file = result->second;
+	string record = GetJournalRecord(file.Data, data, length);
+	if(record.empty()) {
+		//Nothing changed since the last save
+		if(!_journalMode && file.JournalSize > 0) {
+			//Merge the journal into the save file
+			WriteFile(filepath, file.Data);
+		}
+		return;
+	}
+
+	if(_journalMode && file.JournalSize + record.size() <= std::max(MinJournalSize, length)) {
+		AppendToJournal(filepath, file, std::move(record));
+		file.Data.assign(data, data + length);
+	} else {
+		WriteFile(filepath, vector<uint8_t>(data, data + length));
+	}
+}
+
+string BatteryManager::GetJournalRecord(const vector<uint8_t>& prevData, uint8_t* data, uint32_t length)
+{
+	//Record format: file size, range count, [offset, length, data] for each range, crc32 of the record
+	string ranges;
+	uint32_t rangeCount = 0;
+	int64_t rangeStart = -1;
+
+	auto addRange = [&](uint32_t end) {
+		WriteValue(ranges, (uint32_t)rangeStart);
+		WriteValue(ranges, end - (uint32_t)rangeStart);
+		ranges.append((char*)data + rangeStart, end - (uint32_t)rangeStart);
+		rangeCount++;
+		rangeStart = -1;
+	};
+
+	for(uint32_t start = 0; start < length; start += BlockSize) {
+		uint32_t end = std::min(start + BlockSize, length);
+		bool changed = end > prevData.size() || memcmp(prevData.data() + start, data + start, end - start) != 0;
+		if(changed && rangeStart < 0) {
+			rangeStart = start;
+		} else if(!changed && rangeStart >= 0) {
+			addRange(start);
+		}
+	}
+
+	if(rangeStart >= 0) {
+		addRange(length);
+	}
+
+	if(rangeCount == 0 && prevData.size() == length) {
+		return "";
+	}
+
+	string record;
+	WriteValue(record, length);
+	WriteValue(record, rangeCount);
+	record += ranges;
+	WriteValue(record, CRC32::GetCRC((uint8_t*)record.data(), record.size()));
+	return record;
+}
+
+void BatteryManager::AppendToJournal(const string& filepath, BatteryFileState& file, string record)
+{
+	bool newJournal = file.JournalSize == 0;
+	if(newJournal) {
+		//The header contains the crc of the save file the journal applies to (the journal is ignored if the save file is replaced)
+		string header = JournalHeader;
+		WriteValue(header, file.BaseCrc);
+		record = header + record;
+	}
+	file.JournalSize += (uint32_t)record.size();
+
+	_writer.Update(GetJournalPath(filepath), [newJournal, record](const string& path) {
+		ofstream out(path, ios::out | ios::binary | (newJournal ? ios::trunc : ios::app));
+		if(!out) {
+			return false;
+		}
+		out.write(record.data(), record.size());
+		out.close();
+		return !out.fail();
+	}, [this](bool success) {
+		if(!success) {
+			//The journal might be incomplete, the next save will rewrite the whole file
+			_writeFailed = true;
+		}
+	});
+}
+
+void BatteryManager::WriteFile(const string& filepath, vector<uint8_t> data)
+{
+	BatteryFileState& file = _files[filepath];
+	file.Data = data;
+	file.BaseCrc = CRC32::GetCRC(data);
+	file.JournalSize = 0;
+	_writeFailed = false;
+
+	shared_ptr<vector<uint8_t>> buffer = std::make_shared<vector<uint8_t>>(std::move(data));
+	_writer.Update(filepath, [buffer](const string& path) {
+		//Replace the save file, and then remove the journal (its changes are included in the new file)
+		string tmpPath = path + ".tmp";
+		ofstream out(tmpPath, ios::out | ios::binary);
+		if(!out) {
+			return false;
+		}
+		out.write((char*)buffer->data(), buffer->size());
+		out.close();
+
+		if(out.fail() || !FolderUtilities::RenameFile(tmpPath, path)) {
+			FolderUtilities::RemoveFile(tmpPath);
+			return false;
+		}
+
+		FolderUtilities::RemoveFile(GetJournalPath(path));
+		return true;
+	}, [this](bool success) {
+		if(!success) {
+			_writeFailed = true;
+		}
+	});
+}
+
+void BatteryManager::LoadJournal(const string& filepath, vector<uint8_t>& data)
+{
+	auto lock = _fileLock.AcquireSafe();
+
+	ifstream in(GetJournalPath(filepath), ios::in | ios::binary);
+	if(!in) {
+		BatteryFileState& file = _files[filepath];
+		file.Data = data;
+		file.BaseCrc = CRC32::GetCRC(data);
+		file.JournalSize = 0;
+		return;
 	}
+
+	char header[4] = {};
+	uint8_t baseCrc[4] = {};
+	in.read(header, 4);
+	in.read((char*)baseCrc, 4);
+	if(in && memcmp(header, JournalHeader, 4) == 0 && ReadValue(baseCrc) == CRC32::GetCRC(data)) {
+		//Apply all the records that were completely written (the last one might be incomplete if the emulator crashed)
+		while(ApplyJournalRecord(in, data)) {
+		}
+	}
+	in.close();
+
+	//Merge the journal into the save file (this also removes invalid journals)
+	WriteFile(filepath, data);
+}
+
+bool BatteryManager::ApplyJournalRecord(istream& in, vector<uint8_t>& data)
+{
+	uint8_t header[8];
+	if(!in.read((char*)header, 8)) {
+		return false;
+	}
+
+	uint32_t fileSize = ReadValue(header);
+	uint32_t rangeCount = ReadValue(header + 4);
+	if(fileSize > MaxFileSize) {
+		return false;
+	}
+
+	struct Range
+	{
+		uint32_t Offset;
+		uint32_t Length;
+		size_t DataPos;
+	};
+
+	vector<uint8_t> record(header, header + 8);
+	vector<Range> ranges;
+	for(uint32_t i = 0; i < rangeCount; i++) {
+		uint8_t rangeHeader[8];
+		if(!in.read((char*)rangeHeader, 8)) {
+			return false;
+		}
+
+		uint32_t offset = ReadValue(rangeHeader);
+		uint32_t length = ReadValue(rangeHeader + 4);
+		if(offset > fileSize || length > fileSize - offset) {
+			return false;
+		}
+
+		record.insert(record.end(), rangeHeader, rangeHeader + 8);
+		size_t dataPos = record.size();
+		record.resize(dataPos + length);
+		if(!in.read((char*)record.data() + dataPos, length)) {
+			return false;
+		}
+		ranges.push_back({ offset, length, dataPos });
+	}
+
+	uint8_t crc[4];
+	if(!in.read((char*)crc, 4) || ReadValue(crc) != CRC32::GetCRC(record)) {
+		return false;
+	}
+
+	data.resize(fileSize, 0);
+	for(Range& range : ranges) {
+		memcpy(data.data() + range.Offset, record.data() + range.DataPos, range.Length);
+	}
+	return true;
+}
+
+void BatteryManager::WriteValue(string& out, uint32_t value)
+{
+	out.push_back(value & 0xFF);
+	out.push_back((value >> 8) & 0xFF);
+	out.push_back((value >> 16) & 0xFF);
+	out.push_back((value >> 24) & 0xFF);
+}
+
+uint32_t BatteryManager::ReadValue(const uint8_t* data)
+{
+	return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
 }
 
 vector<uint8_t> BatteryManager::LoadBattery(string extension)
@@ -57,10 +287,18 @@ vector<uint8_t> BatteryManager::LoadBattery(string extension)
 		//Used by movie player to provider initial state of ram at startup
 		batteryData = provider->LoadBattery(extension);
 	} else {
-		VirtualFile file = GetBasePath(extension);
+		string filepath = GetBasePath(extension);
+
+		//Make sure the file isn't still being written (e.g when reloading the same game)
+		_writer.Flush();
+
+		VirtualFile file = filepath;
 		if(file.IsValid()) {
 			file.ReadFile(batteryData);
 		}
+
+		//Apply any changes that were written to the journal but not merged into the save file (e.g after a crash)
+		LoadJournal(filepath, batteryData);
 	}
 
 	if(!batteryData.empty()) {
@@ -83,5 +321,14 @@ void BatteryManager::LoadBattery(string extension, uint8_t* data, uint32_t lengt
 
 uint32_t BatteryManager::GetBatteryFileSize(string extension)
 {
+	if(!_romName.empty() && !_provider.lock()) {
+		auto lock = _fileLock.AcquireSafe();
+		auto result = _files.find(GetBasePath(extension));
+		if(result != _files.end()) {
+			//The save file's content is already known, no need to read it again
+			return (uint32_t)result->second.Data.size();
+		}
+	}
+
 	return (uint32_t)LoadBattery(extension).size();
 }
\ No newline at end of file
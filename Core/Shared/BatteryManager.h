@@ -1,5 +1,8 @@
 #pragma once
 #include "pch.h"
+#include <unordered_map>
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AsyncFileWriter.h"
 
 class IBatteryProvider
 {
@@ -16,15 +19,49 @@ public:
 class BatteryManager
 {
 private:
+	//Changes are detected (and written to the journal) in blocks of this size
+	static constexpr uint32_t BlockSize = 256;
+	//The journal is compacted (merged into the save file) once it grows larger than the save file (or this size, for small files)
+	static constexpr uint32_t MinJournalSize = 0x4000;
+	static constexpr uint32_t MaxFileSize = 0x4000000;
+	static constexpr const char* JournalHeader = "MBJ1";
+
+	//Content of a battery file, as it currently exists on the disk (save file + journal)
+	struct BatteryFileState
+	{
+		vector<uint8_t> Data;
+		uint32_t BaseCrc = 0;
+		uint32_t JournalSize = 0;
+	};
+
 	string _romName;
 	bool _hasBattery = false;
+	bool _journalMode = false;
 
 	std::weak_ptr<IBatteryProvider> _provider;
 	std::weak_ptr<IBatteryRecorder> _recorder;
 
+	SimpleLock _fileLock;
+	std::unordered_map<string, BatteryFileState> _files;
+	atomic<bool> _writeFailed;
+	AsyncFileWriter _writer;
+
 	string GetBasePath(string& extension);
+	static string GetJournalPath(const string& filepath) { return filepath + ".journal"; }
+
+	string GetJournalRecord(const vector<uint8_t>& prevData, uint8_t* data, uint32_t length);
+	void AppendToJournal(const string& filepath, BatteryFileState& file, string record);
+	void WriteFile(const string& filepath, vector<uint8_t> data);
+
+	void LoadJournal(const string& filepath, vector<uint8_t>& data);
+	static bool ApplyJournalRecord(istream& in, vector<uint8_t>& data);
+
+	static void WriteValue(string& out, uint32_t value);
+	static uint32_t ReadValue(const uint8_t* data);
 
 public:
+	BatteryManager();
+
 	void Initialize(string romName, bool setBatteryFlag = false);
 
 	bool HasBattery() { return _hasBattery; }
@@ -32,9 +69,18 @@ public:
 	void SetBatteryProvider(shared_ptr<IBatteryProvider> provider);
 	void SetBatteryRecorder(shared_ptr<IBatteryRecorder> recorder);
 	
+	//When enabled, only the blocks that changed since the last save are written (appended to the journal)
+	//Used for the periodic saves done by the emulation thread, the journal is merged into the save file by the next regular save (e.g on power off)
+	void SetJournalMode(bool enabled) { _journalMode = enabled; }
+	bool IsJournalMode() { return _journalMode; }
+
 	void SaveBattery(string extension, uint8_t* data, uint32_t length);
 	
 	vector<uint8_t> LoadBattery(string extension);
 	void LoadBattery(string extension, uint8_t* data, uint32_t length);
 	uint32_t GetBatteryFileSize(string extension);
+
+	//Battery files are written by a background thread
+	bool HasPendingWrites() { return _writer.HasPendingWrites(); }
+	void FlushWrites() { _writer.Flush(); }
 };
\ No newline at end of file
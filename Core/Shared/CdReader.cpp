@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "Shared/CdReader.h"
+#include "Shared/CdSectorCache.h"
+#include "Shared/CompressedDiscImage.h"
 #include "Shared/MessageManager.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/FolderUtilities.h"
@@ -31,13 +33,8 @@ struct CueFileEntry
 	vector<CueTrackEntry> Tracks;
 };
 
-bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
+static bool ParseCueSheet(stringstream& ss, vector<CueFileEntry>& files)
 {
-	vector<CueFileEntry> files;
-
-	stringstream ss;
-	cueFile.ReadFile(ss);
-
 	string line;
 	while(std::getline(ss, line)) {
 		line = StringUtilities::TrimLeft(StringUtilities::TrimRight(line));
@@ -64,11 +61,7 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
 			
 			filename = StringUtilities::Trim(filename);
 			if(!filename.empty()) {
-				VirtualFile dataFile = cueFile.GetFolderPath() + filename;
-				if(cueFile.IsArchive()) {
-					dataFile = VirtualFile(cueFile.GetFilePath(), filename);
-				}
-				files.push_back({ dataFile });
+				files.push_back({ filename });
 			} else {
 				MessageManager::Log("[CUE] Invalid FILE entry");
 				return false;
@@ -157,15 +150,74 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
 		}
 	}
 
-	uint32_t totalPregapLbaLength = 0;
-	for(size_t i = 0; i < files.size(); i++) {
-		VirtualFile physicalFile = files[i].Filename;
+	return true;
+}
+
+bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
+{
+	vector<CueFileEntry> files;
+
+	stringstream ss;
+	cueFile.ReadFile(ss);
+	if(!ParseCueSheet(ss, files)) {
+		return false;
+	}
+
+	vector<uint64_t> fileSizes;
+	for(CueFileEntry& entry : files) {
+		VirtualFile physicalFile = cueFile.GetFolderPath() + entry.Filename;
+		if(cueFile.IsArchive()) {
+			physicalFile = VirtualFile(cueFile.GetFilePath(), entry.Filename);
+		}
+
 		if(!physicalFile.IsValid()) {
-			MessageManager::Log("[CUE] Missing or invalid file: " + files[i].Filename);
+			MessageManager::Log("[CUE] Missing or invalid file: " + entry.Filename);
 			return false;
 		}
 
-		disc.Files.push_back(files[i].Filename);
+		disc.Files.push_back(physicalFile);
+		fileSizes.push_back(physicalFile.GetSize());
+	}
+
+	if(!InitTracks(files, fileSizes, disc)) {
+		return false;
+	}
+
+	LoadSubcodeFile(cueFile, disc);
+
+	disc.SectorCache.reset(new CdSectorCache(disc));
+	return true;
+}
+
+bool CdReader::LoadCompressedImage(VirtualFile& file, DiscInfo& disc)
+{
+	shared_ptr<CompressedDiscImage> image(new CompressedDiscImage());
+	if(!image->Load(file)) {
+		return false;
+	}
+
+	vector<CueFileEntry> files;
+	stringstream ss(image->GetCueSheet());
+	if(!ParseCueSheet(ss, files)) {
+		return false;
+	}
+
+	vector<uint64_t> fileSizes = image->GetFileSizes();
+	if(files.size() != fileSizes.size() || !InitTracks(files, fileSizes, disc)) {
+		return false;
+	}
+
+	LoadSubcodeFile(file, disc);
+
+	disc.CompressedImage = image;
+	disc.SectorCache.reset(new CdSectorCache(disc));
+	return true;
+}
+
+bool CdReader::InitTracks(vector<CueFileEntry>& files, vector<uint64_t>& fileSizes, DiscInfo& disc)
+{
+	uint32_t totalPregapLbaLength = 0;
+	for(size_t i = 0; i < files.size(); i++) {
 		int startSector = i == 0 ? 0 : (disc.Tracks[disc.Tracks.size() - 1].LastSector + 1);
 		for(size_t j = 0; j < files[i].Tracks.size(); j++) {
 			CueTrackEntry entry = files[i].Tracks[j];
@@ -225,19 +277,23 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
 			if(trk.HasLeadIn && !entry.PreGap.HasGap) {
 				trk.FileOffset += (trk.StartPosition.ToLba() - trk.LeadInPosition.ToLba()) * trk.GetSectorSize();
 			}
-			trk.FileIndex = (uint32_t)disc.Files.size() - 1;
+			trk.FileIndex = (uint32_t)i;
 
 			disc.Tracks.push_back(trk);
 		}
 
 		//Set end position for last track to be the end of the current file
 		TrackInfo& lastTrk = disc.Tracks[disc.Tracks.size() - 1];
-		lastTrk.Size = (uint32_t)((disc.Files[lastTrk.FileIndex].GetSize() - lastTrk.FileOffset) / lastTrk.GetSectorSize() * lastTrk.GetSectorSize());
+		lastTrk.Size = (uint32_t)((fileSizes[lastTrk.FileIndex] - lastTrk.FileOffset) / lastTrk.GetSectorSize() * lastTrk.GetSectorSize());
 		lastTrk.SectorCount = lastTrk.Size / lastTrk.GetSectorSize();
 		lastTrk.EndPosition = DiscPosition::FromLba(lastTrk.FirstSector + lastTrk.SectorCount - 1);
 		lastTrk.LastSector = lastTrk.EndPosition.ToLba();
 	}
 
+	if(disc.Tracks.empty()) {
+		return false;
+	}
+
 	TrackInfo& discLastTrk = disc.Tracks[disc.Tracks.size() - 1];
 	disc.DiscSize = discLastTrk.FileOffset + discLastTrk.Size;
 	disc.DiscSectorCount = discLastTrk.LastSector + 1;
@@ -257,9 +313,7 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
 	}
 	MessageManager::Log("---- END TRACKS ----");
 
-	LoadSubcodeFile(cueFile, disc);
-
-	return disc.Tracks.size() > 0;
+	return true;
 }
 
 void CdReader::LoadSubcodeFile(VirtualFile& cueFile, DiscInfo& disc)
@@ -291,3 +345,20 @@ void CdReader::LoadSubcodeFile(VirtualFile& cueFile, DiscInfo& disc)
 		}
 	}
 }
+
+bool DiscInfo::ReadSector(uint32_t sector, uint8_t* out)
+{
+	return SectorCache ? SectorCache->ReadSector(sector, out) : false;
+}
+
+void DiscInfo::ReadAudioSector(uint32_t sector, int16_t* out)
+{
+	uint8_t sectorData[DiscInfo::SectorSize] = {};
+	if(GetTrack(sector) < 0 || !ReadSector(sector, sectorData)) {
+		LogDebug("Invalid sector/track");
+	}
+
+	for(int i = 0; i < DiscInfo::SectorSize / 2; i++) {
+		out[i] = (int16_t)(sectorData[i * 2] | (sectorData[i * 2 + 1] << 8));
+	}
+}
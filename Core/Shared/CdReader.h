@@ -3,6 +3,10 @@
 #include "Utilities/VirtualFile.h"
 #include "Shared/MessageManager.h"
 
+class CdSectorCache;
+class CompressedDiscImage;
+struct CueFileEntry;
+
 enum class TrackFormat
 {
 	Audio,
@@ -86,16 +90,33 @@ struct DiscInfo
 	uint32_t DiscSectorCount;
 	DiscPosition EndPosition;
 
-	int32_t GetTrack(uint32_t sector)
+	//Set when the disc was loaded from a compressed image (Files is empty in this case)
+	shared_ptr<CompressedDiscImage> CompressedImage;
+
+	//Cache of recently read sectors, shared between copies of the DiscInfo (created by CdReader)
+	shared_ptr<CdSectorCache> SectorCache;
+
+	static int32_t FindTrack(const vector<TrackInfo>& tracks, uint32_t sector)
 	{
-		for(size_t i = 0; i < Tracks.size(); i++) {
-			if(sector >= Tracks[i].FirstSector && sector <= Tracks[i].LastSector) {
-				return (int32_t)i;
+		//Tracks are sorted by sector, find the last track that starts at or before the sector
+		auto result = std::upper_bound(tracks.begin(), tracks.end(), sector, [](uint32_t sector, const TrackInfo& trk) {
+			return sector < trk.FirstSector;
+		});
+
+		if(result != tracks.begin()) {
+			const TrackInfo& trk = *(result - 1);
+			if(sector <= trk.LastSector) {
+				return (int32_t)(result - tracks.begin() - 1);
 			}
 		}
 		return -1;
 	}
 
+	int32_t GetTrack(uint32_t sector)
+	{
+		return FindTrack(Tracks, sector);
+	}
+
 	int32_t GetTrackFirstSector(int32_t track)
 	{
 		if(track < Tracks.size()) {
@@ -118,48 +139,29 @@ struct DiscInfo
 		return -1;
 	}
 
+	//Reads the sector's raw data (2352 bytes, or 2048 bytes for Mode1_2048 tracks) into out
+	bool ReadSector(uint32_t sector, uint8_t* out);
+
+	//Reads the 588 stereo samples (1176 int16 values) contained in a CD-DA sector into out
+	void ReadAudioSector(uint32_t sector, int16_t* out);
+
 	template<typename T>
 	void ReadDataSector(uint32_t sector, T& outData)
 	{
 		constexpr int Mode1_2352_SectorHeaderSize = 16;
 
+		uint8_t sectorData[DiscInfo::SectorSize];
 		int32_t track = GetTrack(sector);
 		if(track < 0) {
 			//TODO support reading pregap when it's available
 			LogDebug("Invalid sector/track (or inside pregap)");
 			outData.insert(outData.end(), 2048, 0);
+		} else if(ReadSector(sector, sectorData)) {
+			uint32_t sectorHeaderSize = Tracks[track].Format == TrackFormat::Mode1_2352 ? Mode1_2352_SectorHeaderSize : 0;
+			outData.insert(outData.end(), sectorData + sectorHeaderSize, sectorData + sectorHeaderSize + 2048);
 		} else {
-			TrackInfo& trk = Tracks[track];
-			uint32_t sectorSize = trk.GetSectorSize();
-			uint32_t sectorHeaderSize = trk.Format == TrackFormat::Mode1_2352 ? Mode1_2352_SectorHeaderSize : 0;
-			uint32_t byteOffset = trk.FileOffset + (sector - trk.FirstSector) * sectorSize;
-			if(!Files[trk.FileIndex].ReadChunk(outData, byteOffset + sectorHeaderSize, 2048)) {
-				LogDebug("Invalid read offsets");
-			}
-		}
-	}
-
-	int16_t ReadAudioSample(uint32_t sector, uint32_t sample, uint32_t byteOffset)
-	{
-		int32_t track = GetTrack(sector);
-		if(track < 0) {
-			LogDebug("Invalid sector/track");
-			return 0;
+			LogDebug("Invalid read offsets");
 		}
-
-		uint32_t fileIndex = Tracks[track].FileIndex;
-		uint32_t startByte = Tracks[track].FileOffset + (sector - Tracks[track].FirstSector) * DiscInfo::SectorSize;
-		return (int16_t)(Files[fileIndex].ReadByte(startByte + sample * 4 + byteOffset) | (Files[fileIndex].ReadByte(startByte + sample * 4 + 1 + byteOffset) << 8));
-	}
-
-	int16_t ReadLeftSample(uint32_t sector, uint32_t sample)
-	{
-		return ReadAudioSample(sector, sample, 0);
-	}
-
-	int16_t ReadRightSample(uint32_t sector, uint32_t sample)
-	{
-		return ReadAudioSample(sector, sample, 2);
 	}
 
 	void GetSubCodeQ(uint32_t sector, std::deque<uint8_t>& out)
@@ -175,9 +177,11 @@ struct DiscInfo
 class CdReader
 {
 	static void LoadSubcodeFile(VirtualFile& cueFile, DiscInfo& disc);
+	static bool InitTracks(vector<CueFileEntry>& files, vector<uint64_t>& fileSizes, DiscInfo& disc);
 
 public:
 	static bool LoadCue(VirtualFile& file, DiscInfo& disc);
+	static bool LoadCompressedImage(VirtualFile& file, DiscInfo& disc);
 
 	static uint8_t ToBcd(uint8_t value)
 	{
@@ -0,0 +1,142 @@
+#include "pch.h"
+#include "Shared/CdSectorCache.h"
+#include "Shared/CompressedDiscImage.h"
+
+CdSectorCache::CdSectorCache(DiscInfo& disc)
+{
+	_files = disc.Files;
+	_tracks = disc.Tracks;
+	_compressedImage = disc.CompressedImage;
+
+	//Spans are fetched once, here, so the read-ahead thread never modifies the VirtualFile instances
+	for(VirtualFile& file : _files) {
+		_fileData.push_back(file.GetSpan());
+	}
+
+	_entries.reset(new CacheEntry[CacheSize]);
+	_entryIndexes.reserve(CacheSize);
+
+	_stopFlag = false;
+	_readAheadSector = 0;
+	_thread.reset(new thread(&CdSectorCache::ThreadLoop, this));
+}
+
+CdSectorCache::~CdSectorCache()
+{
+	_stopFlag = true;
+	_readAheadSignal.Signal();
+	_thread->join();
+}
+
+bool CdSectorCache::ReadSector(uint32_t sector, uint8_t* out)
+{
+	if(sector != _lastRequestedSector) {
+		_lastRequestedSector = sector;
+		_readAheadSector = sector + 1;
+		_readAheadSignal.Signal();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_cacheLock);
+		auto result = _entryIndexes.find(sector);
+		if(result != _entryIndexes.end()) {
+			CacheEntry& entry = _entries[result->second];
+			entry.LastUse = ++_useCounter;
+			memcpy(out, entry.Data, entry.Size);
+			return true;
+		}
+	}
+
+	//Cache miss (e.g after a seek), read the sector directly
+	uint32_t size;
+	if(!ReadFromDisc(sector, out, size)) {
+		return false;
+	}
+	AddToCache(sector, out, size);
+	return true;
+}
+
+bool CdSectorCache::ReadFromDisc(uint32_t sector, uint8_t* out, uint32_t& size)
+{
+	int32_t track = DiscInfo::FindTrack(_tracks, sector);
+	if(track < 0) {
+		return false;
+	}
+
+	TrackInfo& trk = _tracks[track];
+	size = trk.GetSectorSize();
+	size_t byteOffset = trk.FileOffset + (size_t)(sector - trk.FirstSector) * size;
+	if(_compressedImage) {
+		return _compressedImage->Read(trk.FileIndex, byteOffset, out, size);
+	}
+
+	VirtualFileSpan& fileData = _fileData[trk.FileIndex];
+	if(byteOffset + size > fileData.Size) {
+		return false;
+	}
+
+	memcpy(out, fileData.Data + byteOffset, size);
+	return true;
+}
+
+bool CdSectorCache::IsCached(uint32_t sector)
+{
+	std::lock_guard<std::mutex> lock(_cacheLock);
+	return _entryIndexes.find(sector) != _entryIndexes.end();
+}
+
+void CdSectorCache::AddToCache(uint32_t sector, uint8_t* data, uint32_t size)
+{
+	std::lock_guard<std::mutex> lock(_cacheLock);
+	if(_entryIndexes.find(sector) != _entryIndexes.end()) {
+		//Already added by the other thread
+		return;
+	}
+
+	//Replace the least recently used entry
+	uint32_t index = 0;
+	for(uint32_t i = 1; i < CacheSize; i++) {
+		if(_entries[i].LastUse < _entries[index].LastUse) {
+			index = i;
+		}
+	}
+
+	CacheEntry& entry = _entries[index];
+	if(entry.Sector >= 0) {
+		_entryIndexes.erase(entry.Sector);
+	}
+
+	entry.Sector = (int32_t)sector;
+	entry.LastUse = ++_useCounter;
+	entry.Size = size;
+	memcpy(entry.Data, data, size);
+	_entryIndexes[sector] = index;
+}
+
+void CdSectorCache::ThreadLoop()
+{
+	uint8_t sectorData[DiscInfo::SectorSize];
+
+	while(!_stopFlag) {
+		_readAheadSignal.Wait();
+
+		uint32_t startSector = _readAheadSector;
+		for(uint32_t i = 0; i < ReadAheadCount && !_stopFlag; i++) {
+			if(_readAheadSector != startSector) {
+				//A different sector was requested (seek, or a data read while CD-DA is playing), restart from there
+				startSector = _readAheadSector;
+				i = 0;
+			}
+
+			uint32_t sector = startSector + i;
+			uint32_t size;
+			if(!IsCached(sector)) {
+				if(!ReadFromDisc(sector, sectorData, size)) {
+					//Reached the end of the disc
+					break;
+				}
+				AddToCache(sector, sectorData, size);
+			}
+		}
+	}
+}
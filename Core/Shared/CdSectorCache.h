@@ -0,0 +1,60 @@
+#pragma once
+#include "pch.h"
+#include <mutex>
+#include <unordered_map>
+#include "Shared/CdReader.h"
+#include "Utilities/AutoResetEvent.h"
+
+//LRU cache of the disc's raw sectors, filled ahead of time by a read-ahead thread.
+//Data reads and CD-DA playback are almost always sequential, so whenever a sector is requested,
+//the thread reads the next few sectors from the disc image (the image files are memory-mapped,
+//so this is where the OS actually reads them from the disk, and where compressed images are
+//decompressed). This prevents the emulation thread from stalling on disk accesses/decompression
+//when games stream audio/video data from the disc.
+class CdSectorCache
+{
+private:
+	static constexpr uint32_t CacheSize = 512; //~1.2MB, ~7 seconds of CD-DA audio
+	static constexpr uint32_t ReadAheadCount = 75; //1 second at 1x speed
+
+	struct CacheEntry
+	{
+		int32_t Sector = -1;
+		uint32_t LastUse = 0;
+		uint32_t Size = 0;
+		uint8_t Data[DiscInfo::SectorSize];
+	};
+
+	//Copies of the disc's files/tracks/image, only read by the cache and its thread
+	vector<VirtualFile> _files;
+	vector<VirtualFileSpan> _fileData;
+	vector<TrackInfo> _tracks;
+	shared_ptr<CompressedDiscImage> _compressedImage;
+
+	std::mutex _cacheLock;
+	unique_ptr<CacheEntry[]> _entries;
+	std::unordered_map<uint32_t, uint32_t> _entryIndexes;
+	uint32_t _useCounter = 0;
+
+	unique_ptr<thread> _thread;
+	atomic<bool> _stopFlag;
+	atomic<uint32_t> _readAheadSector;
+	AutoResetEvent _readAheadSignal;
+	uint32_t _lastRequestedSector = UINT32_MAX;
+
+	bool ReadFromDisc(uint32_t sector, uint8_t* out, uint32_t& size);
+	bool IsCached(uint32_t sector);
+	void AddToCache(uint32_t sector, uint8_t* data, uint32_t size);
+
+	void ThreadLoop();
+
+public:
+	CdSectorCache(DiscInfo& disc);
+	~CdSectorCache();
+
+	CdSectorCache(const CdSectorCache&) = delete;
+	CdSectorCache& operator=(const CdSectorCache&) = delete;
+
+	//Reads the sector's raw data (2352 bytes, or 2048 bytes for Mode1_2048 tracks) into out
+	bool ReadSector(uint32_t sector, uint8_t* out);
+};
@@ -0,0 +1,316 @@
+#include "pch.h"
+#include "Shared/CompressedDiscImage.h"
+#include "Shared/CdReader.h"
+#include "Shared/MessageManager.h"
+#include "Utilities/miniz.h"
+
+bool CompressedDiscImage::Load(VirtualFile& file)
+{
+	_file = file;
+	_fileData = _file.GetSpan();
+
+	if(_fileData.Size < sizeof(Header)) {
+		return false;
+	}
+
+	memcpy(&_header, _fileData.Data, sizeof(Header));
+	if(memcmp(_header.Magic, "MCDZ", 4) != 0 || _header.Version != CompressedDiscImage::Version) {
+		MessageManager::Log("[CDZ] Invalid or unsupported file");
+		return false;
+	}
+
+	uint64_t fileSizesSize = (uint64_t)_header.FileCount * sizeof(uint64_t);
+	uint64_t hunkTableSize = (uint64_t)_header.HunkCount * sizeof(HunkEntry);
+	uint64_t hunkTableOffset = sizeof(Header) + fileSizesSize + _header.CueSheetSize;
+	if(_header.HunkSize == 0 || _header.HunkSize > SectorsPerHunk * DiscInfo::SectorSize || hunkTableOffset + hunkTableSize > _fileData.Size) {
+		MessageManager::Log("[CDZ] Invalid header");
+		return false;
+	}
+
+	_fileSizes.resize(_header.FileCount);
+	memcpy(_fileSizes.data(), _fileData.Data + sizeof(Header), fileSizesSize);
+	_cueSheet = string((char*)_fileData.Data + sizeof(Header) + fileSizesSize, _header.CueSheetSize);
+	_hunks.resize(_header.HunkCount);
+	memcpy(_hunks.data(), _fileData.Data + hunkTableOffset, hunkTableSize);
+
+	//Values are compared separately against the limits (rather than adding them up) to avoid overflows with corrupted files
+	uint64_t startOffset = 0;
+	for(uint64_t fileSize : _fileSizes) {
+		if(fileSize > _header.DataSize - startOffset) {
+			MessageManager::Log("[CDZ] Invalid file sizes");
+			return false;
+		}
+		_fileStartOffsets.push_back(startOffset);
+		startOffset += fileSize;
+	}
+
+	if(startOffset != _header.DataSize || _header.DataSize / _header.HunkSize + (_header.DataSize % _header.HunkSize ? 1 : 0) != _header.HunkCount) {
+		MessageManager::Log("[CDZ] Invalid file sizes");
+		return false;
+	}
+
+	for(HunkEntry& hunk : _hunks) {
+		if(hunk.Offset > _fileData.Size || hunk.CompressedSize > _fileData.Size - hunk.Offset) {
+			MessageManager::Log("[CDZ] Invalid hunk table");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool CompressedDiscImage::Read(uint32_t fileIndex, uint64_t offset, uint8_t* out, uint32_t size)
+{
+	if(fileIndex >= _fileSizes.size() || offset + size > _fileSizes[fileIndex]) {
+		return false;
+	}
+
+	uint64_t pos = _fileStartOffsets[fileIndex] + offset;
+
+	while(size > 0) {
+		//Sectors can overlap 2 hunks (e.g when the cue sheet refers to multiple files)
+		uint32_t hunkOffset = (uint32_t)(pos % _header.HunkSize);
+		uint32_t length = std::min(size, _header.HunkSize - hunkOffset);
+
+		if(!ReadHunk((uint32_t)(pos / _header.HunkSize), hunkOffset, out, length)) {
+			return false;
+		}
+
+		out += length;
+		pos += length;
+		size -= length;
+	}
+	return true;
+}
+
+bool CompressedDiscImage::ReadHunk(uint32_t hunk, uint32_t offset, uint8_t* out, uint32_t length)
+{
+	{
+		std::lock_guard<std::mutex> lock(_cacheLock);
+		if(CachedHunk* cached = FindHunk(hunk)) {
+			memcpy(out, cached->Data.data() + offset, length);
+			return true;
+		}
+	}
+
+	//Decompress the hunk without holding the lock, the other thread can keep reading cached hunks in the meantime
+	vector<uint8_t> data(_header.HunkSize);
+	if(!DecompressHunk(hunk, data)) {
+		return false;
+	}
+	memcpy(out, data.data() + offset, length);
+
+	std::lock_guard<std::mutex> lock(_cacheLock);
+	AddHunk(hunk, data);
+	return true;
+}
+
+CompressedDiscImage::CachedHunk* CompressedDiscImage::FindHunk(uint32_t hunk)
+{
+	for(CachedHunk& cached : _cache) {
+		if(cached.Hunk == (int32_t)hunk) {
+			cached.LastUse = ++_useCounter;
+			return &cached;
+		}
+	}
+	return nullptr;
+}
+
+void CompressedDiscImage::AddHunk(uint32_t hunk, vector<uint8_t>& data)
+{
+	if(FindHunk(hunk)) {
+		//Already decompressed and added by the other thread
+		return;
+	}
+
+	//Replace the least recently used hunk
+	CachedHunk* entry = &_cache[0];
+	for(CachedHunk& cached : _cache) {
+		if(cached.LastUse < entry->LastUse) {
+			entry = &cached;
+		}
+	}
+
+	entry->Hunk = (int32_t)hunk;
+	entry->LastUse = ++_useCounter;
+	entry->Data.swap(data);
+}
+
+bool CompressedDiscImage::DecompressHunk(uint32_t hunk, vector<uint8_t>& out)
+{
+	HunkEntry& entry = _hunks[hunk];
+	uint8_t* compressedData = (uint8_t*)_fileData.Data + entry.Offset;
+	uint32_t hunkSize = (uint32_t)std::min<uint64_t>(_header.HunkSize, _header.DataSize - (uint64_t)hunk * _header.HunkSize);
+
+	if(entry.Codec == HunkCodec::Raw) {
+		if(entry.CompressedSize != hunkSize) {
+			return false;
+		}
+		memcpy(out.data(), compressedData, hunkSize);
+		return true;
+	}
+
+	uint8_t buffer[SectorsPerHunk * DiscInfo::SectorSize];
+	uint8_t* dst = entry.Codec == HunkCodec::DeflateAudio ? buffer : out.data();
+	mz_ulong decompressedSize = hunkSize;
+	if(mz_uncompress(dst, &decompressedSize, compressedData, entry.CompressedSize) != MZ_OK || decompressedSize != hunkSize) {
+		MessageManager::Log("[CDZ] Could not decompress hunk #" + std::to_string(hunk));
+		return false;
+	}
+
+	if(entry.Codec == HunkCodec::DeflateAudio) {
+		RevertAudioFilter(buffer, hunkSize, out.data());
+	}
+	return true;
+}
+
+void CompressedDiscImage::ApplyAudioFilter(uint8_t* data, uint32_t size, vector<uint8_t>& out)
+{
+	//Store the difference between consecutive samples of each channel, low bytes first, then high bytes
+	uint32_t sampleCount = size / 2;
+	out.resize(size);
+
+	int16_t prevSample[2] = {};
+	for(uint32_t i = 0; i < sampleCount; i++) {
+		int16_t sample = (int16_t)(data[i * 2] | (data[i * 2 + 1] << 8));
+		uint16_t delta = (uint16_t)(sample - prevSample[i & 0x01]);
+		prevSample[i & 0x01] = sample;
+		out[i] = (uint8_t)delta;
+		out[sampleCount + i] = (uint8_t)(delta >> 8);
+	}
+
+	if(size & 0x01) {
+		out[size - 1] = data[size - 1];
+	}
+}
+
+void CompressedDiscImage::RevertAudioFilter(uint8_t* data, uint32_t size, uint8_t* out)
+{
+	uint32_t sampleCount = size / 2;
+
+	int16_t prevSample[2] = {};
+	for(uint32_t i = 0; i < sampleCount; i++) {
+		uint16_t delta = (uint16_t)(data[i] | (data[sampleCount + i] << 8));
+		int16_t sample = (int16_t)(prevSample[i & 0x01] + delta);
+		prevSample[i & 0x01] = sample;
+		out[i * 2] = (uint8_t)sample;
+		out[i * 2 + 1] = (uint8_t)(sample >> 8);
+	}
+
+	if(size & 0x01) {
+		out[size - 1] = data[size - 1];
+	}
+}
+
+bool CompressedDiscImage::CompressHunk(uint8_t* data, uint32_t size, HunkCodec codec, vector<uint8_t>& out)
+{
+	vector<uint8_t> filteredData;
+	if(codec == HunkCodec::DeflateAudio) {
+		ApplyAudioFilter(data, size, filteredData);
+		data = filteredData.data();
+	}
+
+	mz_ulong compressedSize = mz_compressBound(size);
+	out.resize(compressedSize);
+	if(mz_compress2(out.data(), &compressedSize, data, size, MZ_BEST_COMPRESSION) != MZ_OK) {
+		return false;
+	}
+	out.resize(compressedSize);
+	return true;
+}
+
+bool CompressedDiscImage::Create(VirtualFile& cueFile, string outputFile)
+{
+	DiscInfo disc = {};
+	if(!CdReader::LoadCue(cueFile, disc)) {
+		return false;
+	}
+
+	stringstream cueSheet;
+	cueFile.ReadFile(cueSheet);
+
+	Header header = {};
+	memcpy(header.Magic, "MCDZ", 4);
+	header.Version = CompressedDiscImage::Version;
+	header.HunkSize = SectorsPerHunk * DiscInfo::SectorSize;
+	header.FileCount = (uint32_t)disc.Files.size();
+	header.CueSheetSize = (uint32_t)cueSheet.str().size();
+
+	vector<VirtualFileSpan> files;
+	vector<uint64_t> fileSizes;
+	for(VirtualFile& file : disc.Files) {
+		files.push_back(file.GetSpan());
+		fileSizes.push_back(files.back().Size);
+		header.DataSize += files.back().Size;
+	}
+	header.HunkCount = (uint32_t)((header.DataSize + header.HunkSize - 1) / header.HunkSize);
+
+	ofstream out(outputFile, ios::out | ios::binary);
+	if(!out) {
+		MessageManager::Log("[CDZ] Could not write to file: " + outputFile);
+		return false;
+	}
+
+	out.write((char*)&header, sizeof(header));
+	out.write((char*)fileSizes.data(), fileSizes.size() * sizeof(uint64_t));
+	out << cueSheet.str();
+
+	//Hunk table is written once all hunks have been compressed
+	vector<HunkEntry> hunks(header.HunkCount);
+	uint64_t hunkTableOffset = (uint64_t)out.tellp();
+	out.write((char*)hunks.data(), hunks.size() * sizeof(HunkEntry));
+
+	vector<uint8_t> hunkData(header.HunkSize);
+	vector<uint8_t> compressedData;
+	vector<uint8_t> compressedAudioData;
+	size_t fileIndex = 0;
+	size_t fileOffset = 0;
+	for(uint32_t i = 0; i < header.HunkCount; i++) {
+		//Hunks are filled using the content of all files, as if they were a single file
+		uint32_t hunkSize = 0;
+		while(hunkSize < header.HunkSize && fileIndex < files.size()) {
+			size_t length = std::min<size_t>(header.HunkSize - hunkSize, files[fileIndex].Size - fileOffset);
+			memcpy(hunkData.data() + hunkSize, files[fileIndex].Data + fileOffset, length);
+			hunkSize += (uint32_t)length;
+			fileOffset += length;
+			if(fileOffset == files[fileIndex].Size) {
+				fileIndex++;
+				fileOffset = 0;
+			}
+		}
+
+		//Keep whichever codec gives the best result (the audio filter only helps for CD-DA tracks)
+		HunkEntry& hunk = hunks[i];
+		hunk.Offset = (uint64_t)out.tellp();
+		hunk.Codec = HunkCodec::Raw;
+		hunk.CompressedSize = hunkSize;
+		uint8_t* data = hunkData.data();
+
+		if(CompressHunk(hunkData.data(), hunkSize, HunkCodec::Deflate, compressedData) && compressedData.size() < hunk.CompressedSize) {
+			hunk.Codec = HunkCodec::Deflate;
+			hunk.CompressedSize = (uint32_t)compressedData.size();
+			data = compressedData.data();
+		}
+
+		if(CompressHunk(hunkData.data(), hunkSize, HunkCodec::DeflateAudio, compressedAudioData) && compressedAudioData.size() < hunk.CompressedSize) {
+			hunk.Codec = HunkCodec::DeflateAudio;
+			hunk.CompressedSize = (uint32_t)compressedAudioData.size();
+			data = compressedAudioData.data();
+		}
+
+		out.write((char*)data, hunk.CompressedSize);
+	}
+
+	uint64_t compressedSize = (uint64_t)out.tellp();
+	out.seekp(hunkTableOffset);
+	out.write((char*)hunks.data(), hunks.size() * sizeof(HunkEntry));
+	out.close();
+
+	if(!out) {
+		MessageManager::Log("[CDZ] Could not write to file: " + outputFile);
+		return false;
+	}
+
+	MessageManager::Log("[CDZ] Compressed " + std::to_string(header.DataSize / 1024) + " KB to " + std::to_string(compressedSize / 1024) + " KB");
+	return true;
+}
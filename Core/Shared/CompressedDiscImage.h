@@ -0,0 +1,94 @@
+#pragma once
+#include "pch.h"
+#include <mutex>
+#include "Utilities/VirtualFile.h"
+
+//Compressed disc image (.cdz)
+//Contains the disc's cue sheet along with the content of all the files it refers to, concatenated
+//and split into fixed-size hunks that are compressed individually (so any sector can be read without
+//having to decompress the whole file).
+//File layout (little endian):
+//	Header
+//	uint64_t FileSizes[FileCount]
+//	char CueSheet[CueSheetSize]
+//	HunkEntry Hunks[HunkCount]
+//	Compressed hunk data
+class CompressedDiscImage
+{
+private:
+	static constexpr uint32_t Version = 1;
+	static constexpr uint32_t SectorsPerHunk = 8;
+	static constexpr uint32_t HunkCacheSize = 8;
+
+	enum class HunkCodec : uint8_t
+	{
+		Raw = 0,
+		Deflate = 1,
+
+		//Deflate, after converting 16-bit stereo samples to deltas (split into low/high byte planes), for CD-DA audio
+		DeflateAudio = 2
+	};
+
+	struct Header
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint32_t HunkSize;
+		uint32_t HunkCount;
+		uint64_t DataSize;
+		uint32_t FileCount;
+		uint32_t CueSheetSize;
+	};
+
+	struct HunkEntry
+	{
+		uint64_t Offset;
+		uint32_t CompressedSize;
+		HunkCodec Codec;
+		uint8_t Reserved[3];
+	};
+
+	struct CachedHunk
+	{
+		int32_t Hunk = -1;
+		uint32_t LastUse = 0;
+		vector<uint8_t> Data;
+	};
+
+	VirtualFile _file;
+	VirtualFileSpan _fileData;
+
+	Header _header = {};
+	vector<uint64_t> _fileSizes;
+	vector<uint64_t> _fileStartOffsets;
+	string _cueSheet;
+	vector<HunkEntry> _hunks;
+
+	//Hunks can be read by both the emulation thread and CdSectorCache's read-ahead thread
+	//The lock only protects the cache, hunks are decompressed without holding it
+	std::mutex _cacheLock;
+	CachedHunk _cache[HunkCacheSize];
+	uint32_t _useCounter = 0;
+
+	bool ReadHunk(uint32_t hunk, uint32_t offset, uint8_t* out, uint32_t length);
+	CachedHunk* FindHunk(uint32_t hunk);
+	void AddHunk(uint32_t hunk, vector<uint8_t>& data);
+	bool DecompressHunk(uint32_t hunk, vector<uint8_t>& out);
+
+	static void ApplyAudioFilter(uint8_t* data, uint32_t size, vector<uint8_t>& out);
+	static void RevertAudioFilter(uint8_t* data, uint32_t size, uint8_t* out);
+	static bool CompressHunk(uint8_t* data, uint32_t size, HunkCodec codec, vector<uint8_t>& out);
+
+public:
+	static constexpr const char* Extension = ".cdz";
+
+	bool Load(VirtualFile& file);
+
+	string GetCueSheet() { return _cueSheet; }
+	vector<uint64_t> GetFileSizes() { return _fileSizes; }
+
+	//Reads data from one of the files referred to by the cue sheet
+	bool Read(uint32_t fileIndex, uint64_t offset, uint8_t* out, uint32_t size);
+
+	static bool Create(VirtualFile& cueFile, string outputFile);
+};
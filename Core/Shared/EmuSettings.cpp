@@ -13,6 +13,7 @@ EmuSettings::EmuSettings(Emulator* emu)
 {
 	_emu = emu;
 	_flags = 0;
+	_maxSpeedOverrides = 0;
 	_debuggerFlags = 0;
 
 	std::random_device rd;
@@ -450,7 +451,7 @@ OverscanDimensions EmuSettings::GetOverscan()
 
 uint32_t EmuSettings::GetEmulationSpeed()
 {
-	if(CheckFlag(EmulationFlags::MaximumSpeed)) {
+	if(CheckFlag(EmulationFlags::MaximumSpeed) || _maxSpeedOverrides != 0) {
 		return 0;
 	} else if(CheckFlag(EmulationFlags::Turbo)) {
 		return _emulation.TurboSpeed;
@@ -517,6 +518,15 @@ bool EmuSettings::CheckFlag(EmulationFlags flag)
 	return (_flags & (int)flag) != 0;
 }
 
+void EmuSettings::SetMaxSpeedOverride(MaxSpeedOverride source, bool enabled)
+{
+	if(enabled) {
+		_maxSpeedOverrides |= (int)source;
+	} else {
+		_maxSpeedOverrides &= ~(int)source;
+	}
+}
+
 void EmuSettings::SetDebuggerFlag(DebuggerFlags flag, bool enabled)
 {
 	if(enabled) {
@@ -33,6 +33,7 @@ private:
 	WsConfig _ws;
 
 	atomic<uint32_t> _flags;
+	atomic<uint32_t> _maxSpeedOverrides;
 	atomic<uint64_t> _debuggerFlags;
 
 	string _audioDevice;
@@ -121,6 +122,9 @@ public:
 	void ClearFlag(EmulationFlags flag);
 	bool CheckFlag(EmulationFlags flag);
 
+	//Each source can enable/disable its override independently, the emulation runs at maximum speed while any of them is enabled
+	void SetMaxSpeedOverride(MaxSpeedOverride source, bool enabled);
+
 	void SetDebuggerFlag(DebuggerFlags flag, bool enabled);
 	bool CheckDebuggerFlag(DebuggerFlags flags);
 
@@ -25,6 +25,7 @@
 #include "Shared/HistoryViewer.h"
 #include "Netplay/GameServer.h"
 #include "Netplay/GameClient.h"
+#include "Netplay/RollbackManager.h"
 #include "Shared/Interfaces/IConsole.h"
 #include "Shared/Interfaces/IBarcodeReader.h"
 #include "Shared/Interfaces/ITapeRecorder.h"
@@ -62,6 +63,7 @@ Emulator::Emulator() :
 	_cheatManager(new CheatManager(this)),
 	_movieManager(new MovieManager(this)),
 	_historyViewer(new HistoryViewer(this)),
+	_rollbackManager(new RollbackManager(this)),
 	_gameServer(new GameServer(this)),
 	_gameClient(new GameClient(this)),
 	_rewindManager(new RewindManager(this))
@@ -105,6 +107,10 @@ void Emulator::Release()
 	_videoDecoder->StopThread();
 	_videoRenderer->StopThread();
 	_shortcutKeyHandler.reset();
+
+	//Wait for the save states/recent game file/battery files to be written to the disk before exiting
+	_saveStateManager->FlushWrites();
+	_batteryManager->FlushWrites();
 }
 
 void Emulator::Run()
@@ -134,16 +140,24 @@ void Emulator::Run()
 
 	while(!_stopFlag) {
 		bool useRunAhead = _settings->GetEmulationConfig().RunAheadFrames > 0 && !_debugger && !_audioPlayerHud && !_rewindManager->IsRewinding() && _settings->GetEmulationSpeed() > 0 && _settings->GetEmulationSpeed() <= 100;
-		if(useRunAhead) {
+		bool frameEmulated = true;
+		if(_rollbackManager->IsEnabled()) {
+			frameEmulated = RunFrameWithRollback();
+		} else if(useRunAhead) {
 			RunFrameWithRunAhead();
 		} else {
 			_console->RunFrame();
 			_rewindManager->ProcessEndOfFrame();
 			_historyViewer->ProcessEndOfFrame();
+			_movieManager->ProcessEndOfFrame();
 			ProcessSystemActions();
 		}
 
-		ProcessAutoSaveState();
+		if(frameEmulated) {
+			//Frame-based counters, skipped while a rollback client is waiting for the host's input
+			ProcessAutoSaveState();
+			ProcessBatteryFlush();
+		}
 
 		WaitForLock();
 
@@ -183,6 +197,24 @@ void Emulator::ProcessAutoSaveState()
 	}
 }
 
+void Emulator::ProcessBatteryFlush()
+{
+	if(_batteryFlushFrameCounter > 0) {
+		_batteryFlushFrameCounter--;
+		if(_batteryFlushFrameCounter == 0) {
+			//Only the parts of the battery-backed memory that changed since the last flush are written to the disk
+			_batteryManager->SetJournalMode(true);
+			_console->SaveBattery();
+			_batteryManager->SetJournalMode(false);
+		}
+	} else {
+		uint32_t flushDelay = _settings->GetPreferences().BatteryFlushDelay;
+		if(flushDelay > 0) {
+			_batteryFlushFrameCounter = (uint32_t)(GetFps() * flushDelay);
+		}
+	}
+}
+
 bool Emulator::ProcessSystemActions()
 {
 	if(_systemActionManager->IsResetPressed()) {
@@ -222,6 +254,7 @@ void Emulator::RunFrameWithRunAhead()
 	_console->RunFrame();
 	_rewindManager->ProcessEndOfFrame();
 	_historyViewer->ProcessEndOfFrame();
+	_movieManager->ProcessEndOfFrame();
 
 	bool wasReset = ProcessSystemActions();
 	if(!wasReset) {
@@ -232,6 +265,30 @@ void Emulator::RunFrameWithRunAhead()
 	}
 }
 
+bool Emulator::RunFrameWithRollback()
+{
+	if(!_rollbackManager->WaitForInput(50)) {
+		//Too far ahead of the netplay host, wait for its input before running another frame
+		//(returns periodically to let the emulation loop process pause/lock requests)
+		return false;
+	}
+
+	//Emulate the frames that used mispredicted input again (no audio/video)
+	_isRunAheadFrame = true;
+	_rollbackManager->ProcessRollback();
+	_isRunAheadFrame = false;
+
+	_rollbackManager->BeginFrame();
+	_console->RunFrame();
+	_rollbackManager->EndFrame();
+
+	_rewindManager->ProcessEndOfFrame();
+	_historyViewer->ProcessEndOfFrame();
+	_movieManager->ProcessEndOfFrame();
+	ProcessSystemActions();
+	return true;
+}
+
 void Emulator::OnBeforeSendFrame()
 {
 	if(!_isRunAheadFrame) {
@@ -292,6 +349,9 @@ void Emulator::Stop(bool sendNotification, bool preventRecentGameSave, bool save
 	if(!preventRecentGameSave && _console && !_settings->GetPreferences().DisableGameSelectionScreen && !_audioPlayerHud) {
 		RomInfo romInfo = GetRomInfo();
 		_saveStateManager->SaveRecentGame(romInfo.RomFile.GetFileName(), romInfo.RomFile, romInfo.PatchFile);
+
+		//The UI lists the recent game files when the emulation stops, make sure this one has been written
+		_saveStateManager->FlushWrites();
 	}
 
 	if(sendNotification) {
@@ -505,6 +565,7 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 	_console->GetControlManager()->UpdateInputState();
 
 	_autoSaveStateFrameCounter = 0;
+	_batteryFlushFrameCounter = 0;
 
 	//Mark the thread as paused, and release the debugger lock to avoid
 	//deadlocks with DebugBreakHelper if GameLoaded event starts the debugger
@@ -1052,10 +1113,16 @@ void Emulator::ResetDebugger(bool startDebugger)
 	}
 
 	if(_emulationThreadId == std::this_thread::get_id()) {
+		if(startDebugger) {
+			_console->OnBeforeDebuggerStart();
+		}
 		_debugger.reset(startDebugger ? new Debugger(this, _console.get()) : nullptr);
 	} else {
 		//Need to pause emulator to change _debugger (when not called from the emulation thread)
 		auto emuLock = AcquireLock();
+		if(startDebugger) {
+			_console->OnBeforeDebuggerStart();
+		}
 		_debugger.reset(startDebugger ? new Debugger(this, _console.get()) : nullptr);
 	}
 }
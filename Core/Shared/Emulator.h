@@ -24,6 +24,7 @@ class BatteryManager;
 class CheatManager;
 class MovieManager;
 class HistoryViewer;
+class RollbackManager;
 class FrameLimiter;
 class DebugStats;
 class BaseControlManager;
@@ -81,6 +82,7 @@ private:
 	const unique_ptr<CheatManager> _cheatManager;
 	const unique_ptr<MovieManager> _movieManager;
 	const unique_ptr<HistoryViewer> _historyViewer;
+	const unique_ptr<RollbackManager> _rollbackManager;
 	
 	const shared_ptr<GameServer> _gameServer;
 	const shared_ptr<GameClient> _gameClient;
@@ -116,6 +118,7 @@ private:
 	double _frameDelay = 0;
 	
 	uint32_t _autoSaveStateFrameCounter = 0;
+	uint32_t _batteryFlushFrameCounter = 0;
 	int32_t _stopCode = 0;
 	bool _stopRequested = false;
 
@@ -123,8 +126,10 @@ private:
 	void WaitForPauseEnd();
 
 	void ProcessAutoSaveState();
+	void ProcessBatteryFlush();
 	bool ProcessSystemActions();
 	void RunFrameWithRunAhead();
+	bool RunFrameWithRollback();
 
 	void BlockDebuggerRequests();
 	void ResetDebugger(bool startDebugger = false);
@@ -201,6 +206,7 @@ public:
 	CheatManager* GetCheatManager() { return _cheatManager.get(); }
 	MovieManager* GetMovieManager() { return _movieManager.get(); }
 	HistoryViewer* GetHistoryViewer() { return _historyViewer.get(); }
+	RollbackManager* GetRollbackManager() { return _rollbackManager.get(); }
 	GameServer* GetGameServer() { return _gameServer.get(); }
 	GameClient* GetGameClient() { return _gameClient.get(); }
 	shared_ptr<SystemActionManager> GetSystemActionManager() { return _systemActionManager; }
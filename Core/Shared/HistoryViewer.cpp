@@ -44,7 +44,9 @@ bool HistoryViewer::Initialize(Emulator* mainEmu)
 	//Disable battery saving for this instance
 	_emu->GetBatteryManager()->Initialize("");
 	
+	//The blocks are shared with the main instance's rewind manager (they are never modified once added to the history)
 	_history = mainEmu->GetRewindManager()->GetHistory();
+	_anchors.Clear();
 	
 	_emu->UnregisterInputProvider(this);
 	_emu->RegisterInputProvider(this);
@@ -77,7 +79,7 @@ HistoryViewerState HistoryViewer::GetState()
 
 	uint32_t segmentCount = 0;
 	for(size_t i = 0; i < _history.size(); i++) {
-		if(_history[i].EndOfSegment || i == _history.size() - 1) {
+		if(_history[i]->EndOfSegment || i == _history.size() - 1) {
 			state.Segments[segmentCount] = (uint32_t)i * RewindManager::BufferSize;
 			segmentCount++;
 
@@ -101,8 +103,7 @@ void HistoryViewer::SeekTo(uint32_t seekPosition)
 		auto lock = _emu->AcquireLock();
 		
 		_position = seekPosition;
-		RewindData rewindData = _history[_position];
-		rewindData.LoadState(_emu, _history, _position);
+		_history[_position]->LoadState(_emu, _history, _anchors, _position);
 
 		_emu->GetSoundMixer()->StopAudio(true);
 		_pollCounter = 0;
@@ -120,7 +121,10 @@ bool HistoryViewer::CreateSaveState(string outputFile, uint32_t position)
 
 	std::stringstream stateData;
 	_emu->GetSaveStateManager()->GetSaveStateHeader(stateData);
-	_history[position].GetStateData(stateData, _history, position);
+	{
+		auto lock = _emu->AcquireLock();
+		_history[position]->GetStateData(stateData, _history, position, _anchors);
+	}
 
 	ofstream output(outputFile, ios::binary);
 	if(output) {
@@ -166,10 +170,11 @@ void HistoryViewer::ResumeGameplay(uint32_t resumePosition)
 		}
 	}
 
+	RewindAnchorCache anchors;
 	if(resumePosition < _history.size()) {
-		_history[resumePosition].LoadState(_mainEmu, _history, resumePosition);
+		_history[resumePosition]->LoadState(_mainEmu, _history, anchors, resumePosition);
 	} else {
-		_history[_history.size() - 1].LoadState(_mainEmu, _history, (int32_t)_history.size() - 1);
+		_history[_history.size() - 1]->LoadState(_mainEmu, _history, anchors, (int32_t)_history.size() - 1);
 	}
 }
 
@@ -177,7 +182,7 @@ bool HistoryViewer::SetInput(BaseControlDevice *device)
 {
 	uint8_t port = device->GetPort();
 	if(_position < _history.size()) {
-		std::deque<ControlDeviceState> &stateData = _history[_position].InputLogs[port];
+		const std::deque<ControlDeviceState> &stateData = _history[_position]->InputLogs[port];
 		if(_pollCounter < stateData.size()) {
 			ControlDeviceState state = stateData[_pollCounter];
 			device->SetRawState(state);
@@ -195,7 +200,7 @@ void HistoryViewer::ProcessEndOfFrame()
 		return;
 	}
 
-	if(_pollCounter >= (uint32_t)_history[_position].FrameCount) {
+	if(_pollCounter >= (uint32_t)_history[_position]->FrameCount) {
 		_pollCounter = 0;
 		_position++;
 
@@ -206,7 +211,6 @@ void HistoryViewer::ProcessEndOfFrame()
 			return;
 		}
 
-		RewindData rewindData = _history[_position];
-		rewindData.LoadState(_emu, _history, _position);
+		_history[_position]->LoadState(_emu, _history, _anchors, _position);
 	}
 }
@@ -30,9 +30,13 @@ struct HistoryViewerOptions
 class HistoryViewer : public IInputProvider
 {
 private:
+	//Number of decompressed full states kept in memory (each one covers 30 blocks), to make seeking back and forth faster
+	static constexpr uint32_t AnchorCacheSize = 8;
+
 	Emulator* _emu = nullptr;
 	Emulator* _mainEmu = nullptr;
-	deque<RewindData> _history;
+	RewindHistory _history;
+	RewindAnchorCache _anchors = RewindAnchorCache(HistoryViewer::AnchorCacheSize);
 	uint32_t _position = 0;
 	uint32_t _pollCounter = 0;
 
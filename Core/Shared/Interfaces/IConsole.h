@@ -107,5 +107,12 @@ public:
 	virtual void ProcessCheatCode(InternalCheatCode& code, uint32_t addr, uint8_t& value) {}
 
 	virtual void ProcessNotification(ConsoleNotificationType type, void* parameter) {}
+
+	//Called right before the debugger is started (can be in the middle of a frame)
+	//Cpus that run on a separate thread must be stopped, the debugger expects all cpus to run on the emulation thread
+	virtual void OnBeforeDebuggerStart() {}
+
+	//Console-specific lines shown in the debug info overlay (e.g coprocessor timings)
+	virtual vector<string> GetDebugStats() { return {}; }
 };
 
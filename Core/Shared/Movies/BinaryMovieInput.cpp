@@ -0,0 +1,118 @@
+#include "pch.h"
+#include <cstring>
+#include "Shared/Movies/BinaryMovieInput.h"
+
+BinaryMovieInput::BinaryMovieInput(uint32_t keyframeInterval, uint32_t stateFormatVersion)
+{
+	_keyframeInterval = keyframeInterval;
+	_stateFormatVersion = stateFormatVersion;
+}
+
+void BinaryMovieInput::AddFrame()
+{
+	//Each frame starts with its device count
+	_frameOffsets.push_back((uint32_t)_data.size());
+	_data.push_back(0);
+}
+
+void BinaryMovieInput::AddDeviceState(ControlDeviceState& state)
+{
+	if(_frameOffsets.empty() || state.State.size() > 0xFF) {
+		return;
+	}
+
+	_data[_frameOffsets.back()]++;
+	_data.push_back((uint8_t)state.State.size());
+	_data.insert(_data.end(), state.State.begin(), state.State.end());
+}
+
+uint8_t BinaryMovieInput::GetDeviceCount(uint32_t frame)
+{
+	return frame < _frameOffsets.size() ? _data[_frameOffsets[frame]] : 0;
+}
+
+bool BinaryMovieInput::GetDeviceState(uint32_t frame, uint8_t deviceIndex, ControlDeviceState& state)
+{
+	if(deviceIndex >= GetDeviceCount(frame)) {
+		return false;
+	}
+
+	uint32_t pos = _frameOffsets[frame] + 1;
+	for(uint8_t i = 0; i < deviceIndex; i++) {
+		pos += _data[pos] + 1;
+	}
+
+	uint8_t size = _data[pos];
+	state.State = vector<uint8_t>(_data.begin() + pos + 1, _data.begin() + pos + 1 + size);
+	return true;
+}
+
+string BinaryMovieInput::GetKeyframeFilename(uint32_t frame)
+{
+	return "Keyframe" + std::to_string(frame) + ".dat";
+}
+
+bool BinaryMovieInput::IsKeyframeFilename(string filename, uint32_t* frame)
+{
+	if(filename.size() <= 12 || filename.substr(0, 8) != "Keyframe" || filename.substr(filename.size() - 4) != ".dat") {
+		return false;
+	}
+
+	string frameNumber = filename.substr(8, filename.size() - 12);
+	if(frameNumber.find_first_not_of("0123456789") != string::npos || frameNumber.size() > 9) {
+		return false;
+	}
+
+	if(frame) {
+		*frame = (uint32_t)std::stoul(frameNumber);
+	}
+	return true;
+}
+
+void BinaryMovieInput::Save(ostream& out)
+{
+	uint32_t header[5] = { BinaryMovieInput::FormatVersion, _keyframeInterval, _stateFormatVersion, (uint32_t)_frameOffsets.size(), (uint32_t)_data.size() };
+	out.write("MMI", 3);
+	out.write((char*)header, sizeof(header));
+	out.write((char*)_frameOffsets.data(), _frameOffsets.size() * sizeof(uint32_t));
+	out.write((char*)_data.data(), _data.size());
+}
+
+bool BinaryMovieInput::Load(istream& in)
+{
+	char magic[3] = {};
+	uint32_t header[5] = {};
+	in.read(magic, 3);
+	in.read((char*)header, sizeof(header));
+	if(!in || memcmp(magic, "MMI", 3) != 0 || header[0] != BinaryMovieInput::FormatVersion) {
+		return false;
+	}
+
+	_keyframeInterval = header[1];
+	_stateFormatVersion = header[2];
+	_frameOffsets.resize(header[3]);
+	_data.resize(header[4]);
+	in.read((char*)_frameOffsets.data(), _frameOffsets.size() * sizeof(uint32_t));
+	in.read((char*)_data.data(), _data.size());
+	if(!in) {
+		return false;
+	}
+
+	//Validate the frame index, to avoid reading out of bounds if the file is corrupted
+	uint32_t expectedOffset = 0;
+	for(uint32_t offset : _frameOffsets) {
+		if(offset != expectedOffset || offset >= _data.size()) {
+			return false;
+		}
+
+		uint32_t pos = offset + 1;
+		for(uint8_t i = 0, count = _data[offset]; i < count; i++) {
+			if(pos >= _data.size()) {
+				return false;
+			}
+			pos += _data[pos] + 1;
+		}
+		expectedOffset = pos;
+	}
+	return expectedOffset == _data.size();
+}
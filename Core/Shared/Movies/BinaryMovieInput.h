@@ -0,0 +1,38 @@
+#pragma once
+#include "pch.h"
+#include "Shared/ControlDeviceState.h"
+
+//Input data for binary movies (Input.bin) - each frame contains the raw (packed) state of each device, in polling order
+//A frame index (the offset of each frame's data) allows reading any frame's input without parsing the previous frames
+class BinaryMovieInput
+{
+private:
+	static constexpr uint32_t FormatVersion = 1;
+
+	vector<uint32_t> _frameOffsets;
+	vector<uint8_t> _data;
+
+	uint32_t _keyframeInterval = 0;
+	uint32_t _stateFormatVersion = 0;
+
+public:
+	BinaryMovieInput(uint32_t keyframeInterval = 0, uint32_t stateFormatVersion = 0);
+
+	void AddFrame();
+	void AddDeviceState(ControlDeviceState& state);
+
+	uint32_t GetFrameCount() { return (uint32_t)_frameOffsets.size(); }
+	uint8_t GetDeviceCount(uint32_t frame);
+	bool GetDeviceState(uint32_t frame, uint8_t deviceIndex, ControlDeviceState& state);
+
+	//Number of frames between each save state (keyframe) stored in the movie, and the format version of these states
+	uint32_t GetKeyframeInterval() { return _keyframeInterval; }
+	uint32_t GetStateFormatVersion() { return _stateFormatVersion; }
+
+	void Save(ostream& out);
+	bool Load(istream& in);
+
+	//Keyframes are stored as separate files in the movie's archive
+	static string GetKeyframeFilename(uint32_t frame);
+	static bool IsKeyframeFilename(string filename, uint32_t* frame = nullptr);
+};
@@ -2,6 +2,8 @@
 #include "Shared/Movies/MesenMovie.h"
 #include "Shared/Movies/MovieTypes.h"
 #include "Shared/Movies/MovieManager.h"
+#include "Shared/Movies/MovieRecorder.h"
+#include "Shared/Movies/BinaryMovieInput.h"
 #include "Shared/MessageManager.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/BaseControlDevice.h"
@@ -12,6 +14,7 @@
 #include "Shared/BatteryManager.h"
 #include "Shared/CheatManager.h"
 #include "Utilities/ZipReader.h"
+#include "Utilities/ZipWriter.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/HexUtilities.h"
 #include "Utilities/VirtualFile.h"
@@ -32,7 +35,11 @@ MesenMovie::~MesenMovie()
 void MesenMovie::Stop()
 {
 	if(_playing) {
-		bool isEndOfMovie = _lastPollCounter >= _inputData.size();
+		bool isEndOfMovie = _lastPollCounter >= GetFrameCount();
+
+		if(_seeking) {
+			EndSeek(false);
+		}
 
 		if(!_forTest) {
 			MessageManager::DisplayMessage("Movies", isEndOfMovie ? "MovieEnded" : "MovieStopped");
@@ -66,13 +73,19 @@ bool MesenMovie::SetInput(BaseControlDevice *device)
 		_deviceIndex = 0;
 	}
 
-	if(_inputData.size() > inputRowIndex && _inputData[inputRowIndex].size() > _deviceIndex) {
-		device->SetTextState(_inputData[inputRowIndex][_deviceIndex]);
+	size_t deviceCount = GetDeviceCount(inputRowIndex);
+	if(deviceCount > _deviceIndex) {
+		SetDeviceInput(inputRowIndex, _deviceIndex, device);
 
 		_deviceIndex++;
-		if(_deviceIndex >= _inputData[inputRowIndex].size()) {
+		if(_deviceIndex >= deviceCount) {
 			//Move to the next frame's data
 			_deviceIndex = 0;
+
+			if(_seeking && inputRowIndex + 1 >= _seekTarget) {
+				//The frame being emulated is the last one before the frame that was seeked to
+				EndSeek(true);
+			}
 		}
 	} else {
 		//End of input data reached (movie end)
@@ -86,6 +99,179 @@ bool MesenMovie::IsPlaying()
 	return _playing;
 }
 
+uint32_t MesenMovie::GetFrameCount()
+{
+	return _binaryInput ? _binaryInput->GetFrameCount() : (uint32_t)_inputData.size();
+}
+
+size_t MesenMovie::GetDeviceCount(uint32_t frame)
+{
+	if(_binaryInput) {
+		return _binaryInput->GetDeviceCount(frame);
+	}
+	return frame < _inputData.size() ? _inputData[frame].size() : 0;
+}
+
+void MesenMovie::SetDeviceInput(uint32_t frame, size_t deviceIndex, BaseControlDevice* device)
+{
+	if(_binaryInput) {
+		ControlDeviceState state;
+		if(_binaryInput->GetDeviceState(frame, (uint8_t)deviceIndex, state)) {
+			device->SetRawState(state);
+		}
+	} else {
+		device->SetTextState(_inputData[frame][deviceIndex]);
+	}
+}
+
+bool MesenMovie::Seek(uint32_t frame)
+{
+	if(!_playing || !_binaryInput || frame >= _binaryInput->GetFrameCount()) {
+		return false;
+	}
+
+	auto lock = _emu->AcquireLock();
+
+	//Load the closest keyframe before the requested frame, and emulate the remaining frames at maximum speed
+	auto keyframe = _keyframes.upper_bound(frame);
+	if(keyframe == _keyframes.begin()) {
+		return false;
+	}
+	keyframe--;
+
+	if(keyframe->second.empty()) {
+		vector<uint8_t> stateData;
+		if(!_reader->ExtractFile(BinaryMovieInput::GetKeyframeFilename(keyframe->first), stateData)) {
+			return false;
+		}
+		keyframe->second = string(stateData.begin(), stateData.end());
+	}
+
+	stringstream state(keyframe->second);
+	if(_emu->Deserialize(state, SaveStateManager::FileFormatVersion, false, std::nullopt, false) != DeserializeResult::Success) {
+		MessageManager::Log("[Movie] Could not load keyframe: " + std::to_string(keyframe->first));
+		return false;
+	}
+
+	_controlManager->SetPollCounter(keyframe->first);
+	_lastPollCounter = keyframe->first;
+	_deviceIndex = 0;
+
+	if(frame > keyframe->first) {
+		StartSeek(frame);
+	} else if(_seeking) {
+		EndSeek(true);
+	}
+	return true;
+}
+
+void MesenMovie::StartSeek(uint32_t frame)
+{
+	if(!_seeking) {
+		_pauseAfterSeek = _emu->IsPaused();
+	}
+
+	_seeking = true;
+	_seekTarget = frame;
+	_emu->GetSettings()->SetMaxSpeedOverride(MaxSpeedOverride::MovieSeek, true);
+	if(_pauseAfterSeek) {
+		_emu->Resume();
+	}
+}
+
+void MesenMovie::EndSeek(bool restoreState)
+{
+	_seeking = false;
+	_emu->GetSettings()->SetMaxSpeedOverride(MaxSpeedOverride::MovieSeek, false);
+	if(restoreState && _pauseAfterSeek) {
+		_emu->PauseOnNextFrame();
+	}
+}
+
+void MesenMovie::ProcessEndOfFrame()
+{
+	if(!_playing || !_binaryInput || _binaryInput->GetKeyframeInterval() == 0) {
+		return;
+	}
+
+	//Save the keyframes that are missing from the movie file (e.g for movies converted from the text format) as the movie plays
+	//This allows seeking quickly to any frame that was played at least once
+	uint32_t frame = _controlManager->GetPollCounter();
+	auto keyframe = _keyframes.upper_bound(frame);
+	if(keyframe != _keyframes.begin() && frame < _binaryInput->GetFrameCount()) {
+		keyframe--;
+		if(frame - keyframe->first >= _binaryInput->GetKeyframeInterval()) {
+			stringstream state;
+			_emu->Serialize(state, false);
+			_keyframes[frame] = state.str();
+		}
+	}
+}
+
+bool MesenMovie::Export(string filename)
+{
+	//Called right after the movie is loaded (the emulation is paused, at the start of the movie)
+	ZipWriter writer;
+	if(!writer.Initialize(filename)) {
+		return false;
+	}
+
+	//Settings, save data, etc. are identical in both formats
+	for(string& name : _reader->GetFileList()) {
+		if(name != "Input.txt" && name != "Input.bin" && !BinaryMovieInput::IsKeyframeFilename(name)) {
+			vector<uint8_t> fileData;
+			if(_reader->ExtractFile(name, fileData)) {
+				writer.AddFile(fileData, name);
+			}
+		}
+	}
+
+	//Each device converts its own input between the text and binary formats (their current state is restored afterwards)
+	vector<shared_ptr<BaseControlDevice>> devices = _controlManager->GetControlDevices();
+	vector<ControlDeviceState> deviceStates;
+	for(shared_ptr<BaseControlDevice>& device : devices) {
+		deviceStates.push_back(device->GetRawState());
+	}
+
+	uint32_t frameCount = GetFrameCount();
+	if(MovieManager::IsBinaryMovie(filename)) {
+		BinaryMovieInput input(MovieRecorder::KeyframeInterval, SaveStateManager::FileFormatVersion);
+		for(uint32_t i = 0; i < frameCount; i++) {
+			input.AddFrame();
+			for(size_t j = 0, count = std::min(GetDeviceCount(i), devices.size()); j < count; j++) {
+				SetDeviceInput(i, j, devices[j].get());
+				ControlDeviceState state = devices[j]->GetRawState();
+				input.AddDeviceState(state);
+			}
+		}
+
+		stringstream inputData;
+		input.Save(inputData);
+		writer.AddFile(inputData, "Input.bin");
+
+		//Only the first keyframe can be created without playing the movie, the others are saved during playback
+		stringstream state;
+		_emu->Serialize(state, false);
+		writer.AddFile(state, BinaryMovieInput::GetKeyframeFilename(0));
+	} else {
+		stringstream inputData;
+		for(uint32_t i = 0; i < frameCount; i++) {
+			for(size_t j = 0, count = std::min(GetDeviceCount(i), devices.size()); j < count; j++) {
+				SetDeviceInput(i, j, devices[j].get());
+				inputData << ("|" + devices[j]->GetTextState());
+			}
+			inputData << "\n";
+		}
+		writer.AddFile(inputData, "Input.txt");
+	}
+
+	for(size_t i = 0; i < devices.size(); i++) {
+		devices[i]->SetRawState(deviceStates[i]);
+	}
+
+	return writer.Save();
+}
+
 vector<uint8_t> MesenMovie::LoadBattery(string extension)
 {
 	vector<uint8_t> batteryData;
@@ -114,24 +300,15 @@ bool MesenMovie::Play(VirtualFile &file)
 	_reader.reset(new ZipReader());
 	_reader->LoadArchive(ss);
 
-	stringstream settingsData, inputData;
+	stringstream settingsData;
 	if(!_reader->GetStream("GameSettings.txt", settingsData)) {
 		MessageManager::Log("[Movie] File not found: GameSettings.txt");
 		return false;
 	}
-	if(!_reader->GetStream("Input.txt", inputData)) {
-		MessageManager::Log("[Movie] File not found: Input.txt");
+	if(!LoadInput()) {
 		return false;
 	}
 
-	while(inputData) {
-		string line;
-		std::getline(inputData, line);
-		if(line.substr(0, 1) == "|") {
-			_inputData.push_back(StringUtilities::Split(line.substr(1), '|'));
-		}
-	}
-
 	_deviceIndex = 0;
 
 	ParseSettings(settingsData);
@@ -177,11 +354,57 @@ bool MesenMovie::Play(VirtualFile &file)
 
 	_controlManager->UpdateControlDevices();
 	_controlManager->SetPollCounter(0);
+
+	if(_binaryInput && _keyframes.find(0) == _keyframes.end()) {
+		//Use the movie's initial state as the first keyframe
+		stringstream state;
+		_emu->Serialize(state, false);
+		_keyframes[0] = state.str();
+	}
+
 	_playing = true;
 
 	return true;
 }
 
+bool MesenMovie::LoadInput()
+{
+	stringstream inputData;
+	if(_reader->GetStream("Input.bin", inputData)) {
+		//Binary movie
+		_binaryInput.reset(new BinaryMovieInput());
+		if(!_binaryInput->Load(inputData)) {
+			MessageManager::Log("[Movie] Invalid input data: Input.bin");
+			return false;
+		}
+
+		if(_binaryInput->GetStateFormatVersion() == SaveStateManager::FileFormatVersion) {
+			//Keyframes saved by other versions can't be loaded, they will be replaced as the movie plays
+			for(string& name : _reader->GetFileList()) {
+				uint32_t frame;
+				if(BinaryMovieInput::IsKeyframeFilename(name, &frame)) {
+					_keyframes[frame] = string();
+				}
+			}
+		}
+		return true;
+	}
+
+	if(!_reader->GetStream("Input.txt", inputData)) {
+		MessageManager::Log("[Movie] File not found: Input.txt");
+		return false;
+	}
+
+	while(inputData) {
+		string line;
+		std::getline(inputData, line);
+		if(line.substr(0, 1) == "|") {
+			_inputData.push_back(StringUtilities::Split(line.substr(1), '|'));
+		}
+	}
+	return true;
+}
+
 template<typename T>
 T FromString(string name, const vector<string> &enumNames, T defaultValue)
 {
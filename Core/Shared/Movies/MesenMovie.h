@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pch.h"
+#include <map>
 #include "Utilities/VirtualFile.h"
 #include "Shared/BatteryManager.h"
 #include "Shared/Interfaces/INotificationListener.h"
@@ -9,6 +10,7 @@
 class ZipReader;
 class Emulator;
 class BaseControlManager;
+class BinaryMovieInput;
 struct CheatCode;
 
 class MesenMovie final : public IMovie, public INotificationListener, public IBatteryProvider, public std::enable_shared_from_this<MesenMovie>
@@ -24,6 +26,7 @@ private:
 	size_t _deviceIndex = 0;
 	uint32_t _lastPollCounter = 0;
 	vector<vector<string>> _inputData;
+	unique_ptr<BinaryMovieInput> _binaryInput;
 	vector<string> _cheats;
 	vector<CheatCode> _originalCheats;
 	stringstream _emuSettingsBackup;
@@ -31,6 +34,13 @@ private:
 	string _filename;
 	bool _forTest = false;
 
+	//Save states used to seek in binary movies, by frame (empty until loaded from the movie file)
+	std::map<uint32_t, string> _keyframes;
+
+	bool _seeking = false;
+	uint32_t _seekTarget = 0;
+	bool _pauseAfterSeek = false;
+
 private:
 	void ParseSettings(stringstream &data);
 	bool ApplySettings(istream& settingsData);
@@ -42,12 +52,23 @@ private:
 	void LoadCheats();
 	bool LoadCheat(string cheatData, CheatCode &code);
 
+	bool LoadInput();
+	uint32_t GetFrameCount();
+	size_t GetDeviceCount(uint32_t frame);
+	void SetDeviceInput(uint32_t frame, size_t deviceIndex, BaseControlDevice* device);
+
+	void StartSeek(uint32_t frame);
+	void EndSeek(bool restoreState);
+
 public:
 	MesenMovie(Emulator* emu, bool silent);
 	virtual ~MesenMovie();
 
 	bool Play(VirtualFile &file) override;
 	void Stop() override;
+	bool Seek(uint32_t frame) override;
+	bool Export(string filename) override;
+	void ProcessEndOfFrame() override;
 
 	bool SetInput(BaseControlDevice* device) override;
 	bool IsPlaying() override;
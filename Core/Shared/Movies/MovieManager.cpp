@@ -13,6 +13,11 @@ MovieManager::MovieManager(Emulator* emu)
 	_emu = emu;
 }
 
+bool MovieManager::IsBinaryMovie(string filename)
+{
+	return FolderUtilities::GetExtension(filename) == ".mmb";
+}
+
 void MovieManager::Record(RecordMovieOptions options)
 {
 	//Stop any active recording/playback before starting playback for this movie
@@ -71,3 +76,35 @@ bool MovieManager::Recording()
 {
 	return _recorder != nullptr;
 }
+
+bool MovieManager::Seek(uint32_t frame)
+{
+	shared_ptr<IMovie> player = _player.lock();
+	return player && player->Seek(frame);
+}
+
+bool MovieManager::Convert(VirtualFile file, string outputFile)
+{
+	//Keep the emulation paused until the conversion is done - the input is converted using the movie's controllers,
+	//which are only set up while the movie is being played
+	auto lock = _emu->AcquireLock(false);
+	Play(file, true);
+
+	shared_ptr<IMovie> player = _player.lock();
+	bool result = player && player->Export(outputFile);
+	Stop();
+	return result;
+}
+
+void MovieManager::ProcessEndOfFrame()
+{
+	shared_ptr<IMovie> player = _player.lock();
+	if(player) {
+		player->ProcessEndOfFrame();
+	}
+
+	shared_ptr<MovieRecorder> recorder = _recorder.lock();
+	if(recorder) {
+		recorder->ProcessEndOfFrame();
+	}
+}
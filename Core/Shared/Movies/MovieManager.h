@@ -17,6 +17,10 @@ public:
 	virtual bool Play(VirtualFile& file) = 0;
 	virtual void Stop() = 0;
 	virtual bool IsPlaying() = 0;
+
+	virtual bool Seek(uint32_t frame) = 0;
+	virtual bool Export(string filename) = 0;
+	virtual void ProcessEndOfFrame() = 0;
 };
 
 class MovieManager
@@ -29,9 +33,20 @@ private:
 public:
 	MovieManager(Emulator* emu);
 
+	//Movies saved with the .mmb extension store their input in binary form, along with periodic save states (used for seeking)
+	static bool IsBinaryMovie(string filename);
+
 	void Record(RecordMovieOptions options);
 	void Play(VirtualFile file, bool silent = false);
 	void Stop();
 	bool Playing();
 	bool Recording();
+
+	//Jumps to the specified frame of the movie being played (binary movies only)
+	bool Seek(uint32_t frame);
+
+	//Converts a text movie (.mmo) to a binary movie (.mmb), or vice versa - the movie's game must be loaded
+	bool Convert(VirtualFile file, string outputFile);
+
+	void ProcessEndOfFrame();
 };
\ No newline at end of file
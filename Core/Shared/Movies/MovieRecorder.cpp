@@ -15,6 +15,8 @@
 #include "Shared/RewindData.h"
 #include "Shared/Movies/MovieTypes.h"
 #include "Shared/Movies/MovieRecorder.h"
+#include "Shared/Movies/MovieManager.h"
+#include "Shared/Movies/BinaryMovieInput.h"
 #include "Shared/BatteryManager.h"
 #include "Shared/CheatManager.h"
 #include "Utilities/Serializer.h"
@@ -39,6 +41,12 @@ bool MovieRecorder::Record(RecordMovieOptions options)
 	_inputData = stringstream();
 	_saveStateData = stringstream();
 	_hasSaveState = false;
+	_keyframes.clear();
+	if(MovieManager::IsBinaryMovie(_filename)) {
+		_binaryInput.reset(new BinaryMovieInput(MovieRecorder::KeyframeInterval, SaveStateManager::FileFormatVersion));
+	} else {
+		_binaryInput.reset();
+	}
 
 	if(!_writer->Initialize(_filename)) {
 		MessageManager::DisplayMessage("Movies", "CouldNotWriteToFile", FolderUtilities::GetFilename(_filename, true));
@@ -67,6 +75,10 @@ bool MovieRecorder::Record(RecordMovieOptions options)
 			_emu->GetSaveStateManager()->SaveState(_saveStateData);
 			_hasSaveState = true;
 		}
+
+		if(_binaryInput) {
+			SaveKeyframe(0);
+		}
 		
 		_emu->GetBatteryManager()->SetBatteryRecorder(nullptr);
 		_emu->Unlock();
@@ -131,7 +143,18 @@ bool MovieRecorder::Stop()
 	if(_writer) {
 		_emu->UnregisterInputRecorder(this);
 
-		_writer->AddFile(_inputData, "Input.txt");
+		if(_binaryInput) {
+			stringstream inputData;
+			_binaryInput->Save(inputData);
+			_writer->AddFile(inputData, "Input.bin");
+
+			for(auto& keyframe : _keyframes) {
+				vector<uint8_t> stateData(keyframe.second.begin(), keyframe.second.end());
+				_writer->AddFile(stateData, BinaryMovieInput::GetKeyframeFilename(keyframe.first));
+			}
+		} else {
+			_writer->AddFile(_inputData, "Input.txt");
+		}
 
 		stringstream out;
 		GetGameSettings(out);
@@ -170,12 +193,39 @@ bool MovieRecorder::Stop()
 
 void MovieRecorder::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
 {
+	if(_binaryInput) {
+		_binaryInput->AddFrame();
+		for(shared_ptr<BaseControlDevice> &device : devices) {
+			ControlDeviceState state = device->GetRawState();
+			_binaryInput->AddDeviceState(state);
+		}
+		return;
+	}
+
 	for(shared_ptr<BaseControlDevice> &device : devices) {
 		_inputData << ("|" + device->GetTextState());
 	}
 	_inputData << "\n";
 }
 
+void MovieRecorder::SaveKeyframe(uint32_t frame)
+{
+	stringstream state;
+	_emu->Serialize(state, false);
+	_keyframes[frame] = state.str();
+}
+
+void MovieRecorder::ProcessEndOfFrame()
+{
+	//Called by the emulation thread between frames - save a keyframe every KeyframeInterval frames for binary movies
+	if(_binaryInput && !_keyframes.empty()) {
+		uint32_t frame = _binaryInput->GetFrameCount();
+		if(frame - _keyframes.rbegin()->first >= MovieRecorder::KeyframeInterval) {
+			SaveKeyframe(frame);
+		}
+	}
+}
+
 void MovieRecorder::OnLoadBattery(string extension, vector<uint8_t> batteryData)
 {
 	_batteryData[extension] = batteryData;
@@ -193,7 +243,7 @@ void MovieRecorder::ProcessNotification(ConsoleNotificationType type, void *para
 	}
 }
 
-bool MovieRecorder::CreateMovie(string movieFile, deque<RewindData> &data, uint32_t startPosition, uint32_t endPosition, bool hasBattery)
+bool MovieRecorder::CreateMovie(string movieFile, RewindHistory &data, uint32_t startPosition, uint32_t endPosition, bool hasBattery)
 {
 	shared_ptr<IConsole> console = _emu->GetConsole();
 	if(!console) {
@@ -210,13 +260,14 @@ bool MovieRecorder::CreateMovie(string movieFile, deque<RewindData> &data, uint3
 			_hasSaveState = true;
 			_saveStateData = stringstream();
 			_emu->GetSaveStateManager()->GetSaveStateHeader(_saveStateData);
-			data[startPosition].GetStateData(_saveStateData, data, startPosition);
+			RewindAnchorCache anchors;
+			data[startPosition]->GetStateData(_saveStateData, data, startPosition, anchors);
 		}
 
 		_inputData = stringstream();
 
 		for(uint32_t i = startPosition; i < endPosition; i++) {
-			RewindData rewindData = data[i];
+			const RewindData& rewindData = *data[i];
 			for(uint32_t j = 0; j < RewindManager::BufferSize; j++) {
 				for(shared_ptr<BaseControlDevice> &device : devices) {
 					uint8_t port = device->GetPort();
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include <deque>
+#include <map>
 #include <unordered_map>
 #include "Shared/Interfaces/IInputRecorder.h"
 #include "Shared/Interfaces/INotificationListener.h"
@@ -10,9 +11,14 @@
 
 class ZipWriter;
 class Emulator;
+class BinaryMovieInput;
 
 class MovieRecorder final : public INotificationListener, public IInputRecorder, public IBatteryRecorder, public IBatteryProvider, public std::enable_shared_from_this<MovieRecorder>
 {
+public:
+	//Number of frames between each save state stored in binary movies (~30 seconds)
+	static constexpr uint32_t KeyframeInterval = 1800;
+
 private:
 	static const uint32_t MovieFormatVersion = 2;
 
@@ -26,6 +32,12 @@ private:
 	bool _hasSaveState = false;
 	stringstream _saveStateData;
 
+	//Binary movies only
+	unique_ptr<BinaryMovieInput> _binaryInput;
+	std::map<uint32_t, string> _keyframes;
+
+	void SaveKeyframe(uint32_t frame);
+
 	void GetGameSettings(stringstream &out);
 	void WriteString(stringstream &out, string name, string value);
 	void WriteInt(stringstream &out, string name, uint32_t value);
@@ -48,5 +60,7 @@ public:
 	// Inherited via INotificationListener
 	void ProcessNotification(ConsoleNotificationType type, void *parameter) override;
 
-	bool CreateMovie(string movieFile, deque<RewindData>& data, uint32_t startPosition, uint32_t endPosition, bool hasBattery);
+	void ProcessEndOfFrame();
+
+	bool CreateMovie(string movieFile, RewindHistory& data, uint32_t startPosition, uint32_t endPosition, bool hasBattery);
 };
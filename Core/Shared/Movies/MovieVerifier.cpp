@@ -0,0 +1,151 @@
+#include "pch.h"
+#include "Shared/Movies/MovieVerifier.h"
+#include "Shared/Movies/MovieManager.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/NotificationManager.h"
+#include "Shared/MemoryType.h"
+#include "Debugger/DebugUtilities.h"
+#include "Utilities/VirtualFile.h"
+#include "Utilities/HexUtilities.h"
+#include "Utilities/CRC32.h"
+#include "Utilities/sha1.h"
+#include "Utilities/Timer.h"
+#include "Utilities/magic_enum.hpp"
+
+MovieVerifier::MovieVerifier(Emulator* emu) : _stateHasher(emu)
+{
+	_emu = emu;
+	_running = false;
+}
+
+void MovieVerifier::ProcessNotification(ConsoleNotificationType type, void* parameter)
+{
+	if(type == ConsoleNotificationType::GameLoaded) {
+		_stateHasher.Reset();
+	} else if(type == ConsoleNotificationType::PpuFrameDone && _running && !_emu->IsRunAheadFrame()) {
+		uint32_t hash;
+		uint32_t frame = _emu->GetFrameCount();
+		if(_stateHasher.ProcessFrame(frame, hash)) {
+			_stateHashes.push_back({ frame, hash });
+		}
+
+		if(!_emu->GetMovieManager()->Playing()) {
+			//The movie ended during this frame, take the digest before the emulation thread runs any other frame
+			_running = false;
+			_endFrame = frame;
+			_memoryDigest = GetMemoryDigest();
+			_signal.Signal();
+		}
+	}
+}
+
+string MovieVerifier::GetMemoryDigest()
+{
+	//Same memory types as the periodic hashes (everything except roms and the cpu address spaces)
+	std::stringstream out;
+	vector<uint8_t> allMemory;
+	bool first = true;
+
+	out << "\"memory\":[";
+	for(int i = (int)DebugUtilities::GetLastCpuMemoryType() + 1; i < (int)MemoryType::None; i++) {
+		MemoryType memType = (MemoryType)i;
+		if(DebugUtilities::IsRom(memType)) {
+			continue;
+		}
+
+		ConsoleMemoryInfo memInfo = _emu->GetMemory(memType);
+		if(memInfo.Memory && memInfo.Size > 0) {
+			uint8_t* memory = (uint8_t*)memInfo.Memory;
+			allMemory.insert(allMemory.end(), memory, memory + memInfo.Size);
+
+			out << (first ? "" : ",");
+			out << "{\"type\":\"" << magic_enum::enum_name(memType) << "\",\"size\":" << memInfo.Size << ",\"crc32\":\"" << HexUtilities::ToHex32(CRC32::GetCRC(memory, memInfo.Size)) << "\"}";
+			first = false;
+		}
+	}
+	out << "],\"digest\":\"" << SHA1::GetHash(allMemory) << "\"";
+	return out.str();
+}
+
+string MovieVerifier::EscapeJson(string str)
+{
+	string result;
+	for(char c : str) {
+		if(c == '"' || c == '\\') {
+			result += '\\';
+			result += c;
+		} else if((uint8_t)c < 0x20) {
+			result += "\\u00" + HexUtilities::ToHex((uint8_t)c);
+		} else {
+			result += c;
+		}
+	}
+	return result;
+}
+
+string MovieVerifier::Run(string romFile, string movieFile, uint32_t timeoutSeconds)
+{
+	EmuSettings* settings = _emu->GetSettings();
+
+	//Skip everything that isn't needed to play the movie: video filters/rendering, audio mixing/resampling, rewind history, etc.
+	settings->SetFlag(EmulationFlags::Headless);
+	settings->SetFlag(EmulationFlags::MaximumSpeed);
+	settings->GetPreferences().RewindBufferSize = 0;
+	settings->GetPreferences().BatteryFlushDelay = 0;
+	settings->GetPreferences().PauseOnMovieEnd = false;
+	settings->GetEmulationConfig().RunAheadFrames = 0;
+
+	_emu->GetNotificationManager()->RegisterNotificationListener(shared_from_this());
+
+	string error;
+	Timer timer;
+
+	_emu->Lock();
+	if(!_emu->LoadRom(romFile, VirtualFile())) {
+		error = "Could not load the rom";
+	} else {
+		_emu->GetMovieManager()->Play(VirtualFile(movieFile), true);
+		if(!_emu->GetMovieManager()->Playing()) {
+			error = "Could not load the movie";
+		}
+	}
+	_running = error.empty();
+	_emu->Unlock();
+
+	bool completed = false;
+	if(error.empty()) {
+		_emu->Resume();
+		completed = _signal.Wait(timeoutSeconds * 1000);
+	}
+	_running = false;
+	double elapsedMs = timer.GetElapsedMS();
+	uint32_t frameCount = completed ? _endFrame : _emu->GetFrameCount();
+
+	if(_emu->IsRunning()) {
+		_emu->Stop(false, true, false);
+	}
+	settings->ClearFlag(EmulationFlags::MaximumSpeed);
+	settings->ClearFlag(EmulationFlags::Headless);
+
+	std::stringstream out;
+	out << "{\"rom\":\"" << EscapeJson(romFile) << "\",\"movie\":\"" << EscapeJson(movieFile) << "\",";
+	if(!error.empty()) {
+		out << "\"result\":\"error\",\"error\":\"" << EscapeJson(error) << "\"}";
+		return out.str();
+	}
+
+	out << "\"result\":\"" << (completed ? "completed" : "timeout") << "\",";
+	out << "\"frames\":" << frameCount << ",\"elapsedMs\":" << (uint64_t)elapsedMs << ",";
+	out << "\"hashInterval\":" << StateHasher::HashInterval << ",\"stateHashes\":[";
+	for(size_t i = 0; i < _stateHashes.size(); i++) {
+		out << (i > 0 ? "," : "") << "{\"frame\":" << _stateHashes[i].first << ",\"hash\":\"" << HexUtilities::ToHex32(_stateHashes[i].second) << "\"}";
+	}
+	out << "]";
+
+	if(completed) {
+		out << "," << _memoryDigest;
+	}
+	out << "}";
+	return out.str();
+}
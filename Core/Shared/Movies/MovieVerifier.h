@@ -0,0 +1,35 @@
+#pragma once
+#include "pch.h"
+#include "Shared/Interfaces/INotificationListener.h"
+#include "Netplay/StateHasher.h"
+#include "Utilities/AutoResetEvent.h"
+
+class Emulator;
+
+//Plays a movie at maximum speed without producing any video/audio output (used to verify movies in bulk, e.g on a CI server)
+//The results are returned as a single line of JSON: a hash of the console's memory every StateHasher::HashInterval frames,
+//and a digest of the console's memory at the end of the movie, which can be compared against the results of previous runs
+class MovieVerifier : public INotificationListener, public std::enable_shared_from_this<MovieVerifier>
+{
+private:
+	Emulator* _emu = nullptr;
+
+	StateHasher _stateHasher;
+	vector<std::pair<uint32_t, uint32_t>> _stateHashes;
+
+	atomic<bool> _running;
+	uint32_t _endFrame = 0;
+	string _memoryDigest;
+	AutoResetEvent _signal;
+
+	string GetMemoryDigest();
+	static string EscapeJson(string str);
+
+public:
+	MovieVerifier(Emulator* emu);
+
+	void ProcessNotification(ConsoleNotificationType type, void* parameter) override;
+
+	//A timeout of 0 waits until the movie ends
+	string Run(string romFile, string movieFile, uint32_t timeoutSeconds);
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+//Opcode dispatch macros for the switch-based CPU interpreters (GbCpu and Spc).
+//By default, these expand to a regular switch statement.
+//When building with MESEN_THREADED_DISPATCH (e.g "make THREADED_DISPATCH=true") on GCC/Clang,
+//they expand to a computed goto through a 256-entry label table instead (MSVC always uses the switch).
+//
+//Usage:
+//	OPCODE_SWITCH(opCode) {
+//		OPCODE_CASE(0x00): NOP(); OPCODE_NEXT;
+//		...
+//		OPCODE_CASE(0xFF): RST(0x38); OPCODE_NEXT;
+//	} OPCODE_SWITCH_END;
+//
+//Every opcode from 0x00 to 0xFF must have its own OPCODE_CASE (the label table references all of them),
+//and there can only be one OPCODE_SWITCH per function (the labels are function-scoped).
+//
+//OPCODE_NEXT ends the handlers of the cpu's main opcode table. With computed goto, each handler gets its own
+//copy of the cpu's OPCODE_CHAIN statement, which starts the next instruction and jumps straight to its handler
+//with OPCODE_DISPATCH (one indirect jump per handler, rather than a single shared one).
+//OPCODE_CHAIN must be defined by the cpu before the switch (it can be empty to fall through to OPCODE_SWITCH_END).
+//OPCODE_BREAK ends the handlers of secondary tables (e.g prefixed opcodes), which return to the main handler.
+//
+//Other cpus don't use these macros:
+//-NesCpu and PceCpu dispatch through a table of member function pointers (one indirect call per instruction),
+// there is no switch to convert and their handlers are shared by several opcodes.
+//-SmsCpu and WsCpu decode prefixes before the main switch (ExecOpCode<prefix> for SMS, segment/rep prefixes for WS),
+// so chaining would have to go back through the prefix decoding, which leaves them with the same single indirect jump
+// as the switch.
+//With the GB and SPC cpus, computed goto dispatch measured within noise of the switch (see PGOHelper --cpubenchmark),
+//so it stays opt-in and the remaining cpus keep their current dispatch.
+#if defined(MESEN_THREADED_DISPATCH) && (defined(__GNUC__) || defined(__clang__))
+	#define MESEN_COMPUTED_GOTO
+#endif
+
+#ifdef MESEN_COMPUTED_GOTO
+	#define OPCODE_CAT(a, b) a##b
+	#define OPCODE_LABEL(op) OPCODE_CAT(op_, op)
+	#define OPCODE_LABEL_ADDR(op) &&OPCODE_LABEL(op)
+	#define OPCODE_LABEL_ROW(row) \
+		OPCODE_LABEL_ADDR(row##0), OPCODE_LABEL_ADDR(row##1), OPCODE_LABEL_ADDR(row##2), OPCODE_LABEL_ADDR(row##3), \
+		OPCODE_LABEL_ADDR(row##4), OPCODE_LABEL_ADDR(row##5), OPCODE_LABEL_ADDR(row##6), OPCODE_LABEL_ADDR(row##7), \
+		OPCODE_LABEL_ADDR(row##8), OPCODE_LABEL_ADDR(row##9), OPCODE_LABEL_ADDR(row##A), OPCODE_LABEL_ADDR(row##B), \
+		OPCODE_LABEL_ADDR(row##C), OPCODE_LABEL_ADDR(row##D), OPCODE_LABEL_ADDR(row##E), OPCODE_LABEL_ADDR(row##F)
+
+	#define OPCODE_SWITCH(opCode) \
+		static void* const _opLabels[256] = { \
+			OPCODE_LABEL_ROW(0x0), OPCODE_LABEL_ROW(0x1), OPCODE_LABEL_ROW(0x2), OPCODE_LABEL_ROW(0x3), \
+			OPCODE_LABEL_ROW(0x4), OPCODE_LABEL_ROW(0x5), OPCODE_LABEL_ROW(0x6), OPCODE_LABEL_ROW(0x7), \
+			OPCODE_LABEL_ROW(0x8), OPCODE_LABEL_ROW(0x9), OPCODE_LABEL_ROW(0xA), OPCODE_LABEL_ROW(0xB), \
+			OPCODE_LABEL_ROW(0xC), OPCODE_LABEL_ROW(0xD), OPCODE_LABEL_ROW(0xE), OPCODE_LABEL_ROW(0xF) \
+		}; \
+		OPCODE_DISPATCH(opCode);
+
+	#define OPCODE_DISPATCH(opCode) goto *_opLabels[(uint8_t)(opCode)]
+	#define OPCODE_CASE(op) OPCODE_LABEL(op)
+	#define OPCODE_NEXT OPCODE_CHAIN; goto op_done
+	#define OPCODE_BREAK goto op_done
+	#define OPCODE_SWITCH_END op_done:
+#else
+	#define OPCODE_SWITCH(opCode) switch(opCode)
+	#define OPCODE_CASE(op) case op
+	#define OPCODE_NEXT break
+	#define OPCODE_BREAK break
+	#define OPCODE_SWITCH_END
+#endif
@@ -4,37 +4,62 @@
 #include "Shared/SaveStateManager.h"
 #include "Utilities/CompressionHelper.h"
 
-void RewindData::GetStateData(stringstream &stateData, deque<RewindData>& prevStates, int32_t position)
+const vector<uint8_t>& RewindAnchorCache::GetData(const shared_ptr<const vector<uint8_t>>& source)
 {
+	for(size_t i = 0; i < _anchors.size(); i++) {
+		if(_anchors[i].Source == source) {
+			if(i > 0) {
+				//Move to the front of the list, the oldest anchors are removed first
+				Anchor anchor = std::move(_anchors[i]);
+				_anchors.erase(_anchors.begin() + i);
+				_anchors.push_front(std::move(anchor));
+			}
+			return _anchors.front().Data;
+		}
+	}
+
 	vector<uint8_t> data;
-	CompressionHelper::Decompress(_saveStateData, data);
+	CompressionHelper::Decompress(*source, data);
+	SetData(source, std::move(data));
+	return _anchors.front().Data;
+}
 
-	if(!IsFullState) {
-		position = (position > 0 ? position : (int32_t)prevStates.size()) - 1;
-		ProcessXorState(data, prevStates, position);
+void RewindAnchorCache::SetData(const shared_ptr<const vector<uint8_t>>& source, vector<uint8_t>&& data)
+{
+	_anchors.push_front({ source, std::move(data) });
+	while(_anchors.size() > _maxCount) {
+		_anchors.pop_back();
+	}
+}
+
+void RewindData::GetStateData(stringstream &stateData, RewindHistory& prevStates, int32_t position, RewindAnchorCache& anchors) const
+{
+	if(IsFullState) {
+		const vector<uint8_t>& data = anchors.GetData(_saveStateData);
+		stateData.write((char*)data.data(), data.size());
+		return;
 	}
 
+	vector<uint8_t> data;
+	CompressionHelper::Decompress(*_saveStateData, data);
+
+	position = (position > 0 ? position : (int32_t)prevStates.size()) - 1;
+	ProcessXorState(data, prevStates, position, anchors);
+
 	stateData.write((char*)data.data(), data.size());
 }
 
 template<typename T>
-void RewindData::ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t position)
+void RewindData::ProcessXorState(T& data, RewindHistory& prevStates, int32_t position, RewindAnchorCache& anchors) const
 {
 	//Find last full state and XOR with it
 	while(position >= 0 && position < prevStates.size()) {
-		RewindData& prevState = prevStates[position];
+		const RewindData& prevState = *prevStates[position];
 		if(prevState.IsFullState) {
 			//XOR with previous state to restore state data to its initial state
-			if(!prevState._uncompressedData.empty()) {
-				for(size_t i = 0, len = std::min(prevState._uncompressedData.size(), data.size()); i < len; i++) {
-					data[i] ^= prevState._uncompressedData[i];
-				}
-			} else {
-				vector<uint8_t> prevStateData;
-				CompressionHelper::Decompress(prevState._saveStateData, prevStateData);
-				for(size_t i = 0, len = std::min(prevStateData.size(), data.size()); i < len; i++) {
-					data[i] ^= prevStateData[i];
-				}
+			const vector<uint8_t>& prevStateData = anchors.GetData(prevState._saveStateData);
+			for(size_t i = 0, len = std::min(prevStateData.size(), data.size()); i < len; i++) {
+				data[i] ^= prevStateData[i];
 			}
 			break;
 		}
@@ -42,28 +67,20 @@ void RewindData::ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t
 	}
 }
 
-void RewindData::LoadState(Emulator* emu, deque<RewindData>& prevStates, int32_t position, bool sendNotification)
+void RewindData::LoadState(Emulator* emu, RewindHistory& prevStates, RewindAnchorCache& anchors, int32_t position, bool sendNotification) const
 {
-	if(_saveStateData.size() == 0) {
+	if(!_saveStateData || _saveStateData->size() == 0) {
 		return;
 	}
-		
-	vector<uint8_t> data;
-	CompressionHelper::Decompress(_saveStateData, data);
-
-	if(!IsFullState) {
-		position = (position > 0 ? position : (int32_t)prevStates.size()) - 1;
-		ProcessXorState(data, prevStates, position);
-	}
 
 	stringstream stream;
-	stream.write((char*)data.data(), data.size());
+	GetStateData(stream, prevStates, position, anchors);
 	stream.seekg(0, ios::beg);
 
 	emu->Deserialize(stream, SaveStateManager::FileFormatVersion, true, std::nullopt, sendNotification);
 }
 
-void RewindData::SaveState(Emulator* emu, deque<RewindData>& prevStates, int32_t position)
+void RewindData::SaveState(Emulator* emu, RewindHistory& prevStates, RewindAnchorCache& anchors, int32_t position)
 {
 	std::stringstream state;
 	emu->Serialize(state, true, 0);
@@ -74,23 +91,19 @@ void RewindData::SaveState(Emulator* emu, deque<RewindData>& prevStates, int32_t
 
 	if(position > 0 && (position % 30) != 0) {
 		position--;
-		ProcessXorState(data, prevStates, position);
+		ProcessXorState(data, prevStates, position, anchors);
 	} else {
 		IsFullState = true;
-		while(position > 0) {
-			position--;
-			RewindData& prevState = prevStates[position];
-			if(prevState.IsFullState) {
-				//Get rid of previous full state's uncompressed data once the next full state is added
-				prevState._uncompressedData = {};
-				break;
-			}
-		}
+	}
 
-		//Keep uncompressed data for the next 30 states - this avoids having to decompress the state 30 times
-		_uncompressedData = vector<uint8_t>(data.begin(), data.end());
+	vector<uint8_t> compressedData;
+	CompressionHelper::Compress(data, 1, compressedData);
+	_saveStateData = std::make_shared<const vector<uint8_t>>(std::move(compressedData));
+
+	if(IsFullState) {
+		//Keep the uncompressed data for the next 30 states - this avoids having to decompress the state 30 times
+		anchors.SetData(_saveStateData, vector<uint8_t>(data.begin(), data.end()));
 	}
 
-	CompressionHelper::Compress(data, 1, _saveStateData);
 	FrameCount = 0;
-}
+}
\ No newline at end of file
@@ -4,15 +4,41 @@
 #include "Shared/BaseControlDevice.h"
 
 class Emulator;
+class RewindData;
+
+//Blocks are never modified once they are added to the history, which allows the history viewer to share them with the rewind manager
+typedef deque<shared_ptr<const RewindData>> RewindHistory;
+
+//Keeps the decompressed data for the last few full states that were used (each XOR state needs the previous full state's data)
+//Each user of the history has its own cache, since they can run on different threads
+class RewindAnchorCache
+{
+private:
+	struct Anchor
+	{
+		shared_ptr<const vector<uint8_t>> Source;
+		vector<uint8_t> Data;
+	};
+
+	std::deque<Anchor> _anchors;
+	uint32_t _maxCount;
+
+public:
+	RewindAnchorCache(uint32_t maxCount = 1) : _maxCount(maxCount) { }
+
+	const vector<uint8_t>& GetData(const shared_ptr<const vector<uint8_t>>& source);
+	void SetData(const shared_ptr<const vector<uint8_t>>& source, vector<uint8_t>&& data);
+	void Clear() { _anchors.clear(); }
+};
 
 class RewindData
 {
 private:
-	vector<uint8_t> _saveStateData;
-	vector<uint8_t> _uncompressedData;
+	//Compressed state, shared by all copies of this block
+	shared_ptr<const vector<uint8_t>> _saveStateData;
 
 	template<typename T>
-	void ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t position);
+	void ProcessXorState(T& data, RewindHistory& prevStates, int32_t position, RewindAnchorCache& anchors) const;
 
 public:
 	std::deque<ControlDeviceState> InputLogs[BaseControlDevice::PortCount];
@@ -20,9 +46,9 @@ public:
 	bool EndOfSegment = false;
 	bool IsFullState = false;
 
-	void GetStateData(stringstream& stateData, deque<RewindData>& prevStates, int32_t position);
-	uint32_t GetStateSize() { return (uint32_t)_saveStateData.size(); }
+	void GetStateData(stringstream& stateData, RewindHistory& prevStates, int32_t position, RewindAnchorCache& anchors) const;
+	uint32_t GetStateSize() const { return _saveStateData ? (uint32_t)_saveStateData->size() : 0; }
 
-	void LoadState(Emulator* emu, deque<RewindData>& prevStates, int32_t position = -1, bool sendNotification = true);
-	void SaveState(Emulator* emu, deque<RewindData>& prevStates, int32_t position = -1);
-};
+	void LoadState(Emulator* emu, RewindHistory& prevStates, RewindAnchorCache& anchors, int32_t position = -1, bool sendNotification = true) const;
+	void SaveState(Emulator* emu, RewindHistory& prevStates, RewindAnchorCache& anchors, int32_t position = -1);
+};
\ No newline at end of file
@@ -43,6 +43,7 @@ void RewindManager::Reset()
 void RewindManager::ClearBuffer()
 {
 	_hasHistory = false;
+	_historyGeneration++;
 	_history.clear();
 	_historyBackup.clear();
 	_framesToFastForward = 0;
@@ -52,6 +53,7 @@ void RewindManager::ClearBuffer()
 	_audioHistoryBuilder.clear();
 	_rewindState = RewindState::Stopped;
 	_currentHistory = {};
+	_anchors.Clear();
 }
 
 void RewindManager::ProcessNotification(ConsoleNotificationType type, void * parameter)
@@ -108,7 +110,7 @@ RewindStats RewindManager::GetStats()
 {
 	uint32_t memoryUsage = 0;
 	for(int i = (int)_history.size() - 1; i >= 0; i--) {
-		memoryUsage += _history[i].GetStateSize();
+		memoryUsage += _history[i]->GetStateSize();
 	}
 	
 	RewindStats stats = {};
@@ -124,14 +126,14 @@ void RewindManager::AddHistoryBlock()
 	if(maxHistorySize > 0) {
 		uint32_t memoryUsage = 0;
 		for(int i = (int)_history.size() - 1; i >= 0; i--) {
-			memoryUsage += _history[i].GetStateSize();
+			memoryUsage += _history[i]->GetStateSize();
 			if((memoryUsage >> 20) >= maxHistorySize) {
 				//Remove all old state data above the memory limit
 				for(int j = 0; j < i; j++) {
 					_history.pop_front();
 				}
 
-				while(_history.size() > 0 && !_history.front().IsFullState) {
+				while(_history.size() > 0 && !_history.front()->IsFullState) {
 					//Remove everything until the next full state
 					_history.pop_front();
 				}
@@ -140,10 +142,11 @@ void RewindManager::AddHistoryBlock()
 		}
 
 		if(_currentHistory.FrameCount > 0) {
-			_history.push_back(_currentHistory);
+			_history.push_back(std::make_shared<const RewindData>(std::move(_currentHistory)));
 		}
+		_historyGeneration++;
 		_currentHistory = RewindData();
-		_currentHistory.SaveState(_emu, _history);
+		_currentHistory.SaveState(_emu, _history, _anchors);
 	}
 }
 
@@ -153,19 +156,19 @@ void RewindManager::PopHistory()
 		StopRewinding();
 	} else {
 		if(_currentHistory.FrameCount <= 0 && !IsStepBack()) {
-			_currentHistory = _history.back();
+			_currentHistory = *_history.back();
 			_history.pop_back();
 		}
 
-		if(IsStepBack() && _currentHistory.FrameCount <= 1 && !_history.empty() && !_history.back().EndOfSegment) {
+		if(IsStepBack() && _currentHistory.FrameCount <= 1 && !_history.empty() && !_history.back()->EndOfSegment) {
 			//Go back an extra frame to ensure step back works across 30-frame chunks
 			_historyBackup.push_front(_currentHistory);
-			_currentHistory = _history.back();
+			_currentHistory = *_history.back();
 			_history.pop_back();
 		}
 
 		_historyBackup.push_front(_currentHistory);
-		_currentHistory.LoadState(_emu, _history, -1, false);
+		_currentHistory.LoadState(_emu, _history, _anchors, -1, false);
 
 		if(!_audioHistoryBuilder.empty()) {
 			_audioHistory.insert(_audioHistory.begin(), _audioHistoryBuilder.begin(), _audioHistoryBuilder.end());
@@ -194,6 +197,7 @@ void RewindManager::InternalStart(bool forDebugger)
 	}
 
 	_rewindState = forDebugger ? RewindState::Debugging : RewindState::Starting;
+	_historyGeneration++;
 	_videoHistoryBuilder.clear();
 	_videoHistory.clear();
 	_audioHistoryBuilder.clear();
@@ -236,7 +240,7 @@ void RewindManager::ForceStop(bool deleteFutureData)
 			}
 		} else {
 			while(_historyBackup.size() > 1) {
-				_history.push_back(_historyBackup.front());
+				_history.push_back(std::make_shared<const RewindData>(std::move(_historyBackup.front())));
 				_historyBackup.pop_front();
 			}
 			_currentHistory = _historyBackup.front();
@@ -258,8 +262,8 @@ void RewindManager::Stop()
 			if(_historyBackup.size() > 1) {
 				_framesToFastForward = (uint32_t)_videoHistory.size() + _historyBackup.front().FrameCount;
 				do {
-					_history.push_back(_historyBackup.front());
 					_framesToFastForward -= _historyBackup.front().FrameCount;
+					_history.push_back(std::make_shared<const RewindData>(std::move(_historyBackup.front())));
 					_historyBackup.pop_front();
 
 					_currentHistory = _historyBackup.front();
@@ -270,14 +274,14 @@ void RewindManager::Stop()
 			//We started rewinding, but didn't actually visually rewind anything yet
 			//Move back to the save state containing the frame currently shown on the screen
 			while(_historyBackup.size() > 1) {
-				_history.push_back(_historyBackup.front());
+				_history.push_back(std::make_shared<const RewindData>(std::move(_historyBackup.front())));
 				_historyBackup.pop_front();
 			}
 			_currentHistory = _historyBackup.front();
 			_framesToFastForward = _historyBackup.front().FrameCount;
 		}
 
-		_currentHistory.LoadState(_emu, _history);
+		_currentHistory.LoadState(_emu, _history, _anchors);
 		if(_framesToFastForward > 0) {
 			_rewindState = RewindState::Stopping;
 			_currentHistory.FrameCount = 0;
@@ -307,7 +311,7 @@ void RewindManager::ProcessEndOfFrame()
 			//Reached the end of the current 30-frame block, move to the next,
 			//the step back target cycle could be at the start of the next block
 			if(_historyBackup.size() > 1) {
-				_history.push_back(_historyBackup.front());
+				_history.push_back(std::make_shared<const RewindData>(std::move(_historyBackup.front())));
 				_historyBackup.pop_front();
 				_currentHistory = _historyBackup.front();
 			}
@@ -355,7 +359,7 @@ void RewindManager::ProcessFrame(RenderedFrame& frame, bool forRewind)
 		}
 	} else if(_rewindState == RewindState::Stopping) {
 		//Display nothing while resyncing
-	} else if(_rewindState == RewindState::Debugging) {
+	} else if(_rewindState == RewindState::Debugging || _stepBackReplay) {
 		//Keep the last frame to be able to display it once step back reaches its target
 		VideoFrame newFrame;
 		newFrame.Data = vector<uint32_t>((uint32_t*)frame.FrameBuffer, (uint32_t*)frame.FrameBuffer + frame.Width * frame.Height);
@@ -387,7 +391,7 @@ bool RewindManager::ProcessAudio(int16_t * soundBuffer, uint32_t sampleCount)
 			//Mute while we prepare to rewind
 			return false;
 		}
-	} else if(_rewindState == RewindState::Stopping || _rewindState == RewindState::Debugging) {
+	} else if(_rewindState == RewindState::Stopping || _rewindState == RewindState::Debugging || _stepBackReplay) {
 		//Mute while we resync
 		return false;
 	} else {
@@ -435,6 +439,61 @@ void RewindManager::StopRewinding(bool forDebugger, bool deleteFutureData)
 	}
 }
 
+RewindHistoryPosition RewindManager::GetHistoryPosition()
+{
+	RewindHistoryPosition pos = {};
+	if(_rewindState == RewindState::Stopped) {
+		pos.Generation = _historyGeneration;
+		pos.FrameCount = _currentHistory.FrameCount;
+		for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+			pos.InputLogSize[i] = (uint32_t)_currentHistory.InputLogs[i].size();
+		}
+	}
+	return pos;
+}
+
+bool RewindManager::RestoreHistoryPosition(RewindHistoryPosition& pos)
+{
+	if(_settings->GetPreferences().RewindBufferSize == 0) {
+		//Rewind is disabled, there is no history to update
+		return true;
+	}
+
+	//Only possible if the position is within the block that is currently being recorded
+	if(_rewindState != RewindState::Stopped || pos.Generation != _historyGeneration || pos.FrameCount > _currentHistory.FrameCount) {
+		return false;
+	}
+
+	//Discard the frames recorded after this position (they will be recorded again as the emulation runs forward)
+	_currentHistory.FrameCount = pos.FrameCount;
+	for(int i = 0; i < BaseControlDevice::PortCount; i++) {
+		while(_currentHistory.InputLogs[i].size() > pos.InputLogSize[i]) {
+			_currentHistory.InputLogs[i].pop_back();
+		}
+	}
+	return true;
+}
+
+void RewindManager::StartStepBackReplay()
+{
+	_stepBackReplay = true;
+	_videoHistory.clear();
+}
+
+void RewindManager::StopStepBackReplay()
+{
+	if(_stepBackReplay) {
+		_stepBackReplay = false;
+		if(!_videoHistory.empty()) {
+			//Display the last frame generated during the replay (same as when step back uses the rewind history)
+			VideoFrame& frameData = _videoHistory.back();
+			RenderedFrame oldFrame(frameData.Data.data(), frameData.Width, frameData.Height, frameData.Scale, frameData.FrameNumber, frameData.InputData);
+			_emu->GetVideoRenderer()->UpdateFrame(oldFrame);
+			_videoHistory.clear();
+		}
+	}
+}
+
 bool RewindManager::IsRewinding()
 {
 	return _rewindState != RewindState::Stopped;
@@ -450,16 +509,17 @@ void RewindManager::RewindSeconds(uint32_t seconds)
 	if(_rewindState == RewindState::Stopped) {
 		uint32_t removeCount = (seconds * 60 / RewindManager::BufferSize) + 1;
 		auto lock = _emu->AcquireLock();
+		_historyGeneration++;
 
 		for(uint32_t i = 0; i < removeCount; i++) {
 			if(!_history.empty()) {
-				_currentHistory = _history.back();
+				_currentHistory = *_history.back();
 				_history.pop_back();
 			} else {
 				break;
 			}
 		}
-		_currentHistory.LoadState(_emu, _history);
+		_currentHistory.LoadState(_emu, _history, _anchors);
 	}
 }
 
@@ -468,10 +528,11 @@ bool RewindManager::HasHistory()
 	return _hasHistory;
 }
 
-deque<RewindData> RewindManager::GetHistory()
+RewindHistory RewindManager::GetHistory()
 {
-	deque<RewindData> history = _history;
-	history.push_back(_currentHistory);
+	//Only the block that is currently being recorded is copied, the other blocks are shared with the caller
+	RewindHistory history = _history;
+	history.push_back(std::make_shared<const RewindData>(_currentHistory));
 	return history;
 }
 
@@ -29,6 +29,13 @@ struct VideoFrame
 	vector<ControllerData> InputData;
 };
 
+struct RewindHistoryPosition
+{
+	uint32_t Generation = 0;
+	int32_t FrameCount = 0;
+	uint32_t InputLogSize[BaseControlDevice::PortCount] = {};
+};
+
 struct RewindStats
 {
 	uint32_t MemoryUsage;
@@ -46,14 +53,19 @@ private:
 	EmuSettings* _settings = nullptr;
 	
 	bool _hasHistory = false;
+	uint32_t _historyGeneration = 1;
 
-	deque<RewindData> _history;
+	RewindHistory _history;
 	deque<RewindData> _historyBackup;
 	RewindData _currentHistory = {};
+	RewindAnchorCache _anchors;
 
 	RewindState _rewindState = RewindState::Stopped;
 	int32_t _framesToFastForward = 0;
 
+	//Set while the debugger's step back runs forward from one of its checkpoints (the rewind history isn't used in this case)
+	bool _stepBackReplay = false;
+
 	deque<VideoFrame> _videoHistory;
 	vector<VideoFrame> _videoHistoryBuilder;
 	deque<int16_t> _audioHistory;
@@ -91,8 +103,16 @@ public:
 	bool IsStepBack();
 	void RewindSeconds(uint32_t seconds);
 
+	//Mutes the audio and keeps the frames off the screen while step back replays frames from a checkpoint
+	//The last frame generated is displayed when the replay ends
+	void StartStepBackReplay();
+	void StopStepBackReplay();
+
+	RewindHistoryPosition GetHistoryPosition();
+	bool RestoreHistoryPosition(RewindHistoryPosition& pos);
+
 	bool HasHistory();
-	deque<RewindData> GetHistory();
+	RewindHistory GetHistory();
 	RewindStats GetStats();
 
 	void SendFrame(RenderedFrame& frame, bool forRewind);
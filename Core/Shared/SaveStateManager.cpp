@@ -3,6 +3,7 @@
 #include "Utilities/ZipWriter.h"
 #include "Utilities/ZipReader.h"
 #include "Utilities/PNGHelper.h"
+#include "Utilities/Serializer.h"
 #include "Shared/SaveStateManager.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
@@ -58,22 +59,61 @@ bool SaveStateManager::LoadState()
 	return LoadState(_lastIndex);
 }
 
-void SaveStateManager::GetSaveStateHeader(ostream &stream)
+void SaveStateManager::CaptureSaveState(CapturedSaveState& data, bool includeState)
+{
+	data.EmuVersion = _emu->GetSettings()->GetVersion();
+	data.ConsoleType = (uint32_t)_emu->GetConsoleType();
+
+	PpuFrameInfo frame = _emu->GetPpuFrame();
+	data.FrameBuffer = vector<uint8_t>(frame.FrameBuffer, frame.FrameBuffer + frame.FrameBufferSize);
+	data.Width = frame.Width;
+	data.Height = frame.Height;
+	data.Scale = (uint32_t)(_emu->GetVideoDecoder()->GetLastFrameScale() * 100);
+
+	RomInfo romInfo = _emu->GetRomInfo();
+	data.RomName = FolderUtilities::GetFilename(romInfo.RomFile.GetFileName(), true);
+
+	if(includeState) {
+		//Compression is done when the state is written
+		std::stringstream state;
+		_emu->Serialize(state, false, 0);
+		data.State = state.str();
+	}
+}
+
+void SaveStateManager::WriteSaveState(CapturedSaveState& data, ostream& stream)
 {
-	uint32_t emuVersion = _emu->GetSettings()->GetVersion();
-	uint32_t formatVersion = SaveStateManager::FileFormatVersion;
 	stream.write("MSS", 3);
-	WriteValue(stream, emuVersion);
-	WriteValue(stream, formatVersion);
+	WriteValue(stream, data.EmuVersion);
+	WriteValue(stream, SaveStateManager::FileFormatVersion);
 
-	WriteValue(stream, (uint32_t)_emu->GetConsoleType());
+	WriteValue(stream, data.ConsoleType);
 
-	SaveVideoData(stream);
+	WriteValue(stream, (uint32_t)data.FrameBuffer.size());
+	WriteValue(stream, data.Width);
+	WriteValue(stream, data.Height);
+	WriteValue(stream, data.Scale);
 
-	RomInfo romInfo = _emu->GetRomInfo();
-	string romName = FolderUtilities::GetFilename(romInfo.RomFile.GetFileName(), true);
-	WriteValue(stream, (uint32_t)romName.size());
-	stream.write(romName.c_str(), romName.size());
+	unsigned long compressedSize = compressBound((unsigned long)data.FrameBuffer.size());
+	vector<uint8_t> compressedData(compressedSize, 0);
+	compress2(compressedData.data(), &compressedSize, data.FrameBuffer.data(), (unsigned long)data.FrameBuffer.size(), MZ_DEFAULT_LEVEL);
+
+	WriteValue(stream, (uint32_t)compressedSize);
+	stream.write((char*)compressedData.data(), (uint32_t)compressedSize);
+
+	WriteValue(stream, (uint32_t)data.RomName.size());
+	stream.write(data.RomName.c_str(), data.RomName.size());
+
+	if(!data.State.empty()) {
+		Serializer::CompressTo(data.State, stream);
+	}
+}
+
+void SaveStateManager::GetSaveStateHeader(ostream &stream)
+{
+	CapturedSaveState data;
+	CaptureSaveState(data, false);
+	WriteSaveState(data, stream);
 }
 
 void SaveStateManager::SaveState(ostream &stream)
@@ -82,50 +122,49 @@ void SaveStateManager::SaveState(ostream &stream)
 	_emu->Serialize(stream, false);
 }
 
-bool SaveStateManager::SaveState(string filepath, bool showSuccessMessage)
+void SaveStateManager::QueueSaveState(string filepath, std::function<void()> onSaved)
 {
-	ofstream file(filepath, ios::out | ios::binary);
+	shared_ptr<CapturedSaveState> data = std::make_shared<CapturedSaveState>();
+	{
+		auto lock = _emu->AcquireLock();
+		CaptureSaveState(*data, true);
+		_emu->ProcessEvent(EventType::StateSaved);
+	}
 
-	if(file) {
-		{
-			auto lock = _emu->AcquireLock();
-			SaveState(file);
-			_emu->ProcessEvent(EventType::StateSaved);
+	_writer.Write(filepath, [data](const string& tmpPath) {
+		ofstream file(tmpPath, ios::out | ios::binary);
+		if(!file) {
+			return false;
 		}
+		WriteSaveState(*data, file);
 		file.close();
+		return !file.fail();
+	}, [filepath, onSaved](bool success) {
+		if(!success) {
+			MessageManager::DisplayMessage("Error", "CouldNotWriteToFile", filepath);
+		} else if(onSaved) {
+			onSaved();
+		}
+	});
+}
 
+void SaveStateManager::SaveState(string filepath, bool showSuccessMessage)
+{
+	QueueSaveState(filepath, [filepath, showSuccessMessage]() {
 		if(showSuccessMessage) {
 			MessageManager::DisplayMessage("SaveStates", "SaveStateSavedFile", filepath);
 		}
-		return true;
-	}
-	return false;
+	});
 }
 
 void SaveStateManager::SaveState(int stateIndex, bool displayMessage)
 {
 	string filepath = SaveStateManager::GetStateFilepath(stateIndex);
-	if(SaveState(filepath, false)) {
+	QueueSaveState(filepath, [stateIndex, displayMessage]() {
 		if(displayMessage) {
 			MessageManager::DisplayMessage("SaveStates", "SaveStateSaved", std::to_string(stateIndex));
 		}
-	}
-}
-
-void SaveStateManager::SaveVideoData(ostream& stream)
-{
-	PpuFrameInfo frame = _emu->GetPpuFrame();
-	WriteValue(stream, frame.FrameBufferSize);
-	WriteValue(stream, frame.Width);
-	WriteValue(stream, frame.Height);
-	WriteValue(stream, (uint32_t)(_emu->GetVideoDecoder()->GetLastFrameScale() * 100));
-
-	unsigned long compressedSize = compressBound(frame.FrameBufferSize);
-	vector<uint8_t> compressedData(compressedSize, 0);
-	compress2(compressedData.data(), &compressedSize, (const unsigned char*)frame.FrameBuffer, frame.FrameBufferSize, MZ_DEFAULT_LEVEL);
-
-	WriteValue(stream, (uint32_t)compressedSize);
-	stream.write((char*)compressedData.data(), (uint32_t)compressedSize);
+	});
 }
 
 bool SaveStateManager::GetVideoData(vector<uint8_t>& out, RenderedFrame& frame, istream& stream)
@@ -224,6 +263,9 @@ bool SaveStateManager::LoadState(istream &stream)
 
 bool SaveStateManager::LoadState(string filepath, bool showSuccessMessage)
 {
+	//Make sure the state isn't still being written
+	_writer.Flush();
+
 	ifstream file(filepath, ios::in | ios::binary);
 	bool result = false;
 
@@ -267,16 +309,16 @@ void SaveStateManager::SaveRecentGame(string romName, string romPath, string pat
 	}
 
 	string filename = FolderUtilities::GetFilename(_emu->GetRomInfo().RomFile.GetFileName(), false) + ".rgd";
-	ZipWriter writer;
-	writer.Initialize(FolderUtilities::CombinePath(FolderUtilities::GetRecentGamesFolder(), filename));
+	string filepath = FolderUtilities::CombinePath(FolderUtilities::GetRecentGamesFolder(), filename);
 
-	std::stringstream pngStream;
-	_emu->GetVideoDecoder()->TakeScreenshot(pngStream);
-	writer.AddFile(pngStream, "Screenshot.png");
+	//Only copy the data here, the png encoding, compression and zip file are done by the writer thread
+	shared_ptr<ScreenshotData> screenshot = std::make_shared<ScreenshotData>();
+	if(!_emu->GetVideoDecoder()->GetScreenshotData(*screenshot)) {
+		screenshot.reset();
+	}
 
-	std::stringstream stateStream;
-	SaveStateManager::SaveState(stateStream);
-	writer.AddFile(stateStream, "Savestate.mss");
+	shared_ptr<CapturedSaveState> state = std::make_shared<CapturedSaveState>();
+	CaptureSaveState(*state, true);
 
 	std::stringstream romInfoStream;
 	romInfoStream << romName << std::endl;
@@ -288,13 +330,35 @@ void SaveStateManager::SaveRecentGame(string romName, string romPath, string pat
 	if(aspectRatio > 0) {
 		romInfoStream << "aspectratio=" << aspectRatio << std::endl;
 	}
+	string romInfo = romInfoStream.str();
 
-	writer.AddFile(romInfoStream, "RomInfo.txt");
-	writer.Save();
+	Emulator* emu = _emu;
+	_writer.Write(filepath, [emu, screenshot, state, romInfo](const string& tmpPath) {
+		ZipWriter writer;
+		if(!writer.Initialize(tmpPath)) {
+			return false;
+		}
+
+		std::stringstream pngStream;
+		if(screenshot) {
+			BaseVideoFilter::EncodeScreenshot(emu, *screenshot, "", &pngStream);
+		}
+		writer.AddFile(pngStream, "Screenshot.png");
+
+		std::stringstream stateStream;
+		WriteSaveState(*state, stateStream);
+		writer.AddFile(stateStream, "Savestate.mss");
+
+		std::stringstream romInfoStream(romInfo);
+		writer.AddFile(romInfoStream, "RomInfo.txt");
+		return writer.Save();
+	});
 }
 
 void SaveStateManager::LoadRecentGame(string filename, bool resetGame)
 {
+	_writer.Flush();
+
 	VirtualFile file(filename);
 	if(!file.IsValid()) {
 		MessageManager::DisplayMessage("Error", "CouldNotLoadFile", file.GetFileName());
@@ -327,6 +391,8 @@ void SaveStateManager::LoadRecentGame(string filename, bool resetGame)
 
 int32_t SaveStateManager::GetSaveStatePreview(string saveStatePath, uint8_t* pngData)
 {
+	_writer.Flush();
+
 	ifstream stream(saveStatePath, ios::binary);
 
 	if(!stream) {
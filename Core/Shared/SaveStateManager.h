@@ -1,9 +1,26 @@
 #pragma once
 #include "pch.h"
+#include "Utilities/AsyncFileWriter.h"
 
 class Emulator;
 struct RenderedFrame;
 
+//Copy of everything needed to write a save state file, taken while the emulation is paused
+//The compression and file I/O are then done by the writer thread
+struct CapturedSaveState
+{
+	uint32_t EmuVersion = 0;
+	uint32_t ConsoleType = 0;
+	vector<uint8_t> FrameBuffer;
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	uint32_t Scale = 0;
+	string RomName;
+
+	//Uncompressed state data (empty when only the header is needed)
+	string State;
+};
+
 class SaveStateManager
 {
 private:
@@ -11,13 +28,17 @@ private:
 
 	atomic<uint32_t> _lastIndex;
 	Emulator* _emu;
+	AsyncFileWriter _writer;
 
 	string GetStateFilepath(int stateIndex);
-	void SaveVideoData(ostream& stream);
 	bool GetVideoData(vector<uint8_t>& out, RenderedFrame& frame, istream& stream);
 
-	void WriteValue(ostream& stream, uint32_t value);
-	uint32_t ReadValue(istream& stream);
+	void CaptureSaveState(CapturedSaveState& data, bool includeState);
+	static void WriteSaveState(CapturedSaveState& data, ostream& stream);
+	void QueueSaveState(string filepath, std::function<void()> onSaved);
+
+	static void WriteValue(ostream& stream, uint32_t value);
+	static uint32_t ReadValue(istream& stream);
 
 public:
 	static constexpr uint32_t FileFormatVersion = 4;
@@ -32,7 +53,7 @@ public:
 	void GetSaveStateHeader(ostream & stream);
 
 	void SaveState(ostream &stream);
-	bool SaveState(string filepath, bool showSuccessMessage = true);
+	void SaveState(string filepath, bool showSuccessMessage = true);
 	void SaveState(int stateIndex, bool displayMessage = true);
 	bool LoadState(istream &stream);
 	bool LoadState(string filepath, bool showSuccessMessage = true);
@@ -43,6 +64,10 @@ public:
 
 	int32_t GetSaveStatePreview(string saveStatePath, uint8_t* pngData);
 
+	//Save states and recent game files are written by a background thread
+	bool HasPendingWrites() { return _writer.HasPendingWrites(); }
+	void FlushWrites() { _writer.Flush(); }
+
 	void SelectSaveSlot(int slotIndex);
 	void MoveToNextSlot();
 	void MoveToPreviousSlot();
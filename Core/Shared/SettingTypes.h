@@ -12,6 +12,14 @@ enum class EmulationFlags
 	ConsoleMode = 0x10,
 	TestMode = 0x20,
 	OutputToStdout = 0x40,
+	Headless = 0x80,
+};
+
+//Internal features that can make the emulation run at maximum speed for a while, without changing the user's settings
+enum class MaxSpeedOverride
+{
+	NetplayCatchUp = 0x01,
+	MovieSeek = 0x02,
 };
 
 enum class ScaleFilterType
@@ -566,6 +574,7 @@ struct SnesConfig
 
 	bool EnableRandomPowerOnState = false;
 	bool EnableStrictBoardMappings = false;
+	bool RunSpcOnSeparateThread = false;
 	RamState RamPowerOnState = RamState::Random;
 	int32_t SpcClockSpeedAdjustment = 0;
 
@@ -804,6 +813,7 @@ struct DebugConfig
 	bool ShowMemoryValues = false;
 
 	bool AutoResetCdl = false;
+	bool DisableCdlLogging = false;
 
 	bool UsePredictiveBreakpoints = false;
 	bool SingleBreakpointPerInstruction = false;
@@ -881,6 +891,7 @@ struct PreferencesConfig
 
 	uint32_t AutoSaveStateDelay = 5;
 	uint32_t RewindBufferSize = 300;
+	uint32_t BatteryFlushDelay = 10;
 
 	const char* SaveFolderOverride = nullptr;
 	const char* SaveStateFolderOverride = nullptr;
@@ -165,49 +165,56 @@ void BaseVideoFilter::YiqToRgb(double y, double i, double q, double& r, double&
 
 void BaseVideoFilter::TakeScreenshot(VideoFilterType filterType, string filename, std::stringstream *stream)
 {
-	uint32_t* pngBuffer;
-	FrameInfo frameInfo;
-	uint32_t* frameBuffer = nullptr;
+	ScreenshotData data;
+	if(GetScreenshotData(filterType, data)) {
+		EncodeScreenshot(_emu, data, filename, stream);
+	}
+}
+
+bool BaseVideoFilter::GetScreenshotData(VideoFilterType filterType, ScreenshotData& data)
+{
 	{
 		auto lock = _frameLock.AcquireSafe();
 		if(_bufferSize == 0 || !GetOutputBuffer()) {
-			return;
+			return false;
 		}
 
-		frameBuffer = new uint32_t[_bufferSize];
-		memcpy(frameBuffer, GetOutputBuffer(), _bufferSize * sizeof(frameBuffer[0]));
-		frameInfo = _frameInfo;
+		data.FrameBuffer = vector<uint32_t>(GetOutputBuffer(), GetOutputBuffer() + _bufferSize);
+		data.Frame = _frameInfo;
 	}
 
-	pngBuffer = frameBuffer;
-	
-	uint8_t scale = 1;
+	data.FilterType = filterType;
+	data.ScreenRotation = _emu->GetSettings()->GetVideoConfig().ScreenRotation;
+	_emu->GetScreenRotationOverride(data.ScreenRotation);
+	return true;
+}
 
-	uint32_t screenRotation = _emu->GetSettings()->GetVideoConfig().ScreenRotation;
-	_emu->GetScreenRotationOverride(screenRotation);
+void BaseVideoFilter::EncodeScreenshot(Emulator* emu, ScreenshotData& data, string filename, std::stringstream* stream)
+{
+	uint32_t* pngBuffer = data.FrameBuffer.data();
+	FrameInfo frameInfo = data.Frame;
+	uint8_t scale = 1;
 
-	unique_ptr<RotateFilter> rotateFilter(new RotateFilter(screenRotation));
-	if(screenRotation != 0) {
+	unique_ptr<RotateFilter> rotateFilter(new RotateFilter(data.ScreenRotation));
+	if(data.ScreenRotation != 0) {
 		pngBuffer = rotateFilter->ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height);
 		frameInfo = rotateFilter->GetFrameInfo(frameInfo);
 	}
 
-	unique_ptr<ScaleFilter> scaleFilter = ScaleFilter::GetScaleFilter(_emu, filterType);
+	unique_ptr<ScaleFilter> scaleFilter = ScaleFilter::GetScaleFilter(emu, data.FilterType);
 	if(scaleFilter) {
 		pngBuffer = scaleFilter->ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height);
 		frameInfo = scaleFilter->GetFrameInfo(frameInfo);
 		scale = scaleFilter->GetScale();
 	}
 
-	ScanlineFilter::ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height, _emu->GetSettings()->GetVideoConfig().ScanlineIntensity, scale);
+	ScanlineFilter::ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height, emu->GetSettings()->GetVideoConfig().ScanlineIntensity, scale);
 	
 	if(!filename.empty()) {
 		PNGHelper::WritePNG(filename, pngBuffer, frameInfo.Width, frameInfo.Height);
 	} else {
 		PNGHelper::WritePNG(*stream, pngBuffer, frameInfo.Width, frameInfo.Height);
 	}
-
-	delete[] frameBuffer;
 }
 
 void BaseVideoFilter::TakeScreenshot(string romName, VideoFilterType filterType)
@@ -5,6 +5,15 @@
 
 class Emulator;
 
+//Copy of the last frame, used to create a screenshot (the filters and png encoding can then be done on any thread)
+struct ScreenshotData
+{
+	vector<uint32_t> FrameBuffer;
+	FrameInfo Frame = {};
+	VideoFilterType FilterType = VideoFilterType::None;
+	uint32_t ScreenRotation = 0;
+};
+
 class BaseVideoFilter
 {
 private:
@@ -51,6 +60,9 @@ public:
 	void TakeScreenshot(string romName, VideoFilterType filterType);
 	void TakeScreenshot(VideoFilterType filterType, string filename, std::stringstream *stream = nullptr);
 
+	bool GetScreenshotData(VideoFilterType filterType, ScreenshotData& data);
+	static void EncodeScreenshot(Emulator* emu, ScreenshotData& data, string filename, std::stringstream* stream = nullptr);
+
 	virtual HudScaleFactors GetScaleFactor() { return { 1.0, 1.0 }; }
 	virtual OverscanDimensions GetOverscan();
 	void SetOverscan(OverscanDimensions dimensions);
@@ -5,7 +5,9 @@
 #include "Shared/Interfaces/IAudioDevice.h"
 #include "Shared/Emulator.h"
 #include "Shared/RewindManager.h"
+#include "Netplay/RollbackManager.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/Interfaces/IConsole.h"
 
 void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 {
@@ -103,4 +105,19 @@ void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 		ss << "   Per min.: " << std::fixed << std::setprecision(2) << (memUsage * 60 * 60 / rewindStats.HistoryDuration) << " MB";
 		hud->DrawString(9, 82, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
 	}
+
+	IConsole* console = emu->GetConsoleUnsafe();
+	vector<string> consoleStats = console ? console->GetDebugStats() : vector<string>();
+	if(emu->GetRollbackManager()->IsEnabled()) {
+		consoleStats.push_back(emu->GetRollbackManager()->GetStatsText());
+	}
+	if(!consoleStats.empty()) {
+		int height = 13 + (int)consoleStats.size() * 9;
+		hud->DrawRectangle(8, 96, 239, height, 0x40000000, true, 1, startFrame);
+		hud->DrawRectangle(8, 96, 239, height, 0xFFFFFF, false, 1, startFrame);
+		hud->DrawString(10, 98, "Console Stats", 0xFFFFFF, 0xFF000000, 1, startFrame);
+		for(size_t i = 0; i < consoleStats.size(); i++) {
+			hud->DrawString(10, 109 + (int)i * 9, consoleStats[i], 0xFFFFFF, 0xFF000000, 1, startFrame);
+		}
+	}
 }
@@ -184,6 +184,12 @@ void VideoDecoder::UpdateFrame(RenderedFrame frame, bool sync, bool forRewind)
 		return;
 	}
 
+	if(_emu->GetSettings()->CheckFlag(EmulationFlags::Headless)) {
+		//No video output is needed, skip filters, HUD and rendering entirely
+		_frameCount++;
+		return;
+	}
+
 	if(_frameChanged) {
 		//Last frame isn't done decoding yet - sometimes Signal() introduces a 25-30ms delay
 		while(_frameChanged) {
@@ -255,3 +261,8 @@ void VideoDecoder::TakeScreenshot(std::stringstream &stream)
 		_videoFilter->TakeScreenshot(_videoFilterType, "", &stream);
 	}
 }
+
+bool VideoDecoder::GetScreenshotData(ScreenshotData& data)
+{
+	return _videoFilter && _videoFilter->GetScreenshotData(_videoFilterType, data);
+}
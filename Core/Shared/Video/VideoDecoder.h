@@ -6,6 +6,7 @@
 #include "Shared/RenderedFrame.h"
 
 class BaseVideoFilter;
+struct ScreenshotData;
 class ScaleFilter;
 class RotateFilter;
 class IRenderingDevice;
@@ -52,6 +53,7 @@ public:
 	void DecodeFrame(bool synchronous = false);
 	void TakeScreenshot();
 	void TakeScreenshot(std::stringstream &stream);
+	bool GetScreenshotData(ScreenshotData& data);
 	
 	void ForceFilterUpdate() { _forceFilterUpdate = true; }
 
@@ -81,6 +81,7 @@ void WsDebugger::OnBeforeBreak(CpuType cpuType)
 	_memoryManager->OnBeforeBreak();
 }
 
+template<uint8_t hooks>
 void WsDebugger::ProcessInstruction()
 {
 	WsCpuState& state = _cpu->GetState();
@@ -92,12 +93,14 @@ void WsDebugger::ProcessInstruction()
 	InstructionProgress.StartCycle = state.CycleCount;
 
 	if(addressInfo.Address >= 0) {
-		if(addressInfo.Type == MemoryType::WsPrgRom) {
-			if(WsDisUtils::IsConditionalJump(_prevOpCode)) {
-				uint8_t opSize = WsDisUtils::GetOpSize(_prevProgramCounter, MemoryType::WsMemory, _memoryDumper);
-				_codeDataLogger->SetCode(addressInfo.Address, WsDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter, opSize));
-			} else {
-				_codeDataLogger->SetCode(addressInfo.Address, WsDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter, 0));
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Type == MemoryType::WsPrgRom) {
+				if(WsDisUtils::IsConditionalJump(_prevOpCode)) {
+					uint8_t opSize = WsDisUtils::GetOpSize(_prevProgramCounter, MemoryType::WsMemory, _memoryDumper);
+					_codeDataLogger->SetCode(addressInfo.Address, WsDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter, opSize));
+				} else {
+					_codeDataLogger->SetCode(addressInfo.Address, WsDisUtils::GetOpFlags(_prevOpCode, pc, _prevProgramCounter, 0));
+				}
 			}
 		}
 		_disassembler->BuildCache(addressInfo, 0, CpuType::Ws);
@@ -105,15 +108,17 @@ void WsDebugger::ProcessInstruction()
 
 	ProcessCallStackUpdates(addressInfo, pc, state.SP);
 
-	if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP) {
-		//If we're on the expected return address, break immediately (for step over/step out)
-		if(WsDisUtils::IsReturnInstruction(_prevOpCode)) {
-			_step->Break(BreakSource::CpuStep);
-		} else {
-			uint8_t prefix = _memoryManager->DebugRead(_prevProgramCounter);
-			if(prefix == 0xF2 || prefix == 0xF3) {
-				//REPZ/REPNZ prefix
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		if(_step->BreakAddress == (int32_t)pc && _step->BreakStackPointer == state.SP) {
+			//If we're on the expected return address, break immediately (for step over/step out)
+			if(WsDisUtils::IsReturnInstruction(_prevOpCode)) {
 				_step->Break(BreakSource::CpuStep);
+			} else {
+				uint8_t prefix = _memoryManager->DebugRead(_prevProgramCounter);
+				if(prefix == 0xF2 || prefix == 0xF3) {
+					//REPZ/REPNZ prefix
+					_step->Break(BreakSource::CpuStep);
+				}
 			}
 		}
 	}
@@ -122,30 +127,32 @@ void WsDebugger::ProcessInstruction()
 	_prevProgramCounter = pc;
 	_prevStackPointer = state.SP;
 
-	if(_settings->CheckDebuggerFlag(DebuggerFlags::WsDebuggerEnabled)) {
-		if(_settings->GetDebugConfig().WsBreakOnInvalidOpCode && WsDisUtils::IsUndefinedOpCode(_prevOpCode)) {
-			_step->Break(BreakSource::BreakOnUndefinedOpCode);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		if(_settings->CheckDebuggerFlag(DebuggerFlags::WsDebuggerEnabled)) {
+			if(_settings->GetDebugConfig().WsBreakOnInvalidOpCode && WsDisUtils::IsUndefinedOpCode(_prevOpCode)) {
+				_step->Break(BreakSource::BreakOnUndefinedOpCode);
+			}
 		}
-	}
 
-	_step->ProcessCpuExec();
+		_step->ProcessCpuExec();
 
-	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec();
-		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _console->GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(CpuType::Ws, _breakpointManager.get(), memOp, absAddr);
+		if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
+			_dummyCpu->SetDummyState(state);
+			_dummyCpu->Exec();
+			for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _console->GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Ws, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
-	}
 
-	_debugger->ProcessBreakConditions(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		_debugger->ProcessBreakConditions(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
-template<uint8_t accessWidth>
+template<uint8_t accessWidth, uint8_t hooks>
 void WsDebugger::ProcessRead(uint32_t addr, uint16_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _console->GetAbsoluteAddress(addr);
@@ -153,33 +160,47 @@ void WsDebugger::ProcessRead(uint32_t addr, uint16_t value, MemoryOperationType
 	InstructionProgress.LastMemOperation = operation;
 
 	if(type == MemoryOperationType::ExecOpCode) {
-		if(_traceLogger->IsEnabled()) {
-			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Ws);
-			_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Ws);
+				_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
+			}
 		}
 		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _console->GetMasterClock());
-		if(_step->ProcessCpuCycle()) {
-			_debugger->SleepUntilResume(CpuType::Ws, BreakSource::CpuStep, &operation);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			if(_step->ProcessCpuCycle()) {
+				_debugger->SleepUntilResume(CpuType::Ws, BreakSource::CpuStep, &operation);
+			}
 		}
 	} else if(type == MemoryOperationType::ExecOperand) {
-		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::WsPrgRom) {
-			_codeDataLogger->SetCode(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::WsPrgRom) {
+				_codeDataLogger->SetCode(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		_memoryAccessCounter->ProcessMemoryExec<accessWidth>(addressInfo, _console->GetMasterClock());
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	} else {
-		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::WsPrgRom) {
-			_codeDataLogger->SetData<0, accessWidth>(addressInfo.Address);
+		if constexpr(hooks & DebugHookFlags::CodeDataLogger) {
+			if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::WsPrgRom) {
+				_codeDataLogger->SetData<0, accessWidth>(addressInfo.Address);
+			}
 		}
 
-		if(_traceLogger->IsEnabled()) {
-			_traceLogger->LogNonExec(operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::TraceLogger) {
+			if(_traceLogger->IsEnabled()) {
+				_traceLogger->LogNonExec(operation, addressInfo);
+			}
 		}
 
 		if(addr < 0xFE00 || addr >= 0xFF80) {
@@ -190,18 +211,22 @@ void WsDebugger::ProcessRead(uint32_t addr, uint16_t value, MemoryOperationType
 					//Only warn the first time
 					_debugger->Log("[WS] Uninitialized memory read: $" + HexUtilities::ToHex20(addr));
 				}
-				if(_settings->CheckDebuggerFlag(DebuggerFlags::WsDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				if constexpr(hooks & DebugHookFlags::BreakChecks) {
+					if(_settings->CheckDebuggerFlag(DebuggerFlags::WsDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+						_step->Break(BreakSource::BreakOnUninitMemoryRead);
+					}
 				}
 			}
 		}
 
-		_step->ProcessCpuCycle();
-		_debugger->ProcessBreakConditions<accessWidth>(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		if constexpr(hooks & DebugHookFlags::BreakChecks) {
+			_step->ProcessCpuCycle();
+			_debugger->ProcessBreakConditions<accessWidth>(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+		}
 	}
 }
 
-template<uint8_t accessWidth>
+template<uint8_t accessWidth, uint8_t hooks>
 void WsDebugger::ProcessWrite(uint32_t addr, uint16_t value, MemoryOperationType type)
 {
 	AddressInfo addressInfo = _console->GetAbsoluteAddress(addr);
@@ -209,25 +234,31 @@ void WsDebugger::ProcessWrite(uint32_t addr, uint16_t value, MemoryOperationType
 	InstructionProgress.LastMemOperation = operation;
 
 	if(addressInfo.Type == MemoryType::WsWorkRam || addressInfo.Type == MemoryType::WsCartRam) {
-		if(addressInfo.Type == MemoryType::WsWorkRam) {
-			bool isMono = _ppu->GetState().Mode == WsVideoMode::Monochrome;
-			if(isMono && addressInfo.Address >= 0x2000 && addressInfo.Address <= 0x3FFF) {
-				_eventManager->AddEvent(DebugEventType::Register, operation);
-			} else if(!isMono && (addressInfo.Address >= 0xFE00 || (addressInfo.Address >= 0x4000 && addressInfo.Address <= 0xBFFF))) {
-				_eventManager->AddEvent(DebugEventType::Register, operation);
+		if constexpr(hooks & DebugHookFlags::EventManager) {
+			if(addressInfo.Type == MemoryType::WsWorkRam) {
+				bool isMono = _ppu->GetState().Mode == WsVideoMode::Monochrome;
+				if(isMono && addressInfo.Address >= 0x2000 && addressInfo.Address <= 0x3FFF) {
+					_eventManager->AddEvent(DebugEventType::Register, operation);
+				} else if(!isMono && (addressInfo.Address >= 0xFE00 || (addressInfo.Address >= 0x4000 && addressInfo.Address <= 0xBFFF))) {
+					_eventManager->AddEvent(DebugEventType::Register, operation);
+				}
 			}
 		}
 
 		_disassembler->InvalidateCache(addressInfo, CpuType::Ws);
 	}
 
-	if(_traceLogger->IsEnabled()) {
-		_traceLogger->LogNonExec(operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::TraceLogger) {
+		if(_traceLogger->IsEnabled()) {
+			_traceLogger->LogNonExec(operation, addressInfo);
+		}
 	}
 
 	_memoryAccessCounter->ProcessMemoryWrite<accessWidth>(addressInfo, _console->GetMasterClock());
-	_step->ProcessCpuCycle();
-	_debugger->ProcessBreakConditions<accessWidth>(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	if constexpr(hooks & DebugHookFlags::BreakChecks) {
+		_step->ProcessCpuCycle();
+		_debugger->ProcessBreakConditions<accessWidth>(CpuType::Ws, *_step.get(), _breakpointManager.get(), operation, addressInfo);
+	}
 }
 
 template<MemoryOperationType opType, typename T>
@@ -519,8 +550,12 @@ template void WsDebugger::ProcessMemoryAccess<MemoryOperationType::Read>(uint32_
 template void WsDebugger::ProcessMemoryAccess<MemoryOperationType::Write>(uint32_t addr, uint8_t value, MemoryType memType);
 template void WsDebugger::ProcessMemoryAccess<MemoryOperationType::Write>(uint32_t addr, uint16_t value, MemoryType memType);
 
-template void WsDebugger::ProcessRead<1>(uint32_t addr, uint16_t value, MemoryOperationType type);
-template void WsDebugger::ProcessRead<2>(uint32_t addr, uint16_t value, MemoryOperationType type);
+//Instantiates the hooks for each combination of the features that can be enabled (see Debugger::RefreshHookFlags)
+#define INSTANTIATE_HOOKS(hooks) \
+	template void WsDebugger::ProcessInstruction<hooks>(); \
+	template void WsDebugger::ProcessRead<1, hooks>(uint32_t addr, uint16_t value, MemoryOperationType type); \
+	template void WsDebugger::ProcessRead<2, hooks>(uint32_t addr, uint16_t value, MemoryOperationType type); \
+	template void WsDebugger::ProcessWrite<1, hooks>(uint32_t addr, uint16_t value, MemoryOperationType type); \
+	template void WsDebugger::ProcessWrite<2, hooks>(uint32_t addr, uint16_t value, MemoryOperationType type);
 
-template void WsDebugger::ProcessWrite<1>(uint32_t addr, uint16_t value, MemoryOperationType type);
-template void WsDebugger::ProcessWrite<2>(uint32_t addr, uint16_t value, MemoryOperationType type);
+DEBUG_CPU_HOOK_COMBINATIONS(INSTANTIATE_HOOKS)
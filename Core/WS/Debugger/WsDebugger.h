@@ -62,10 +62,10 @@ public:
 
 	void Reset() override;
 
-	void ProcessInstruction();
+	template<uint8_t hooks> void ProcessInstruction();
 	
-	template<uint8_t accessWidth> void ProcessRead(uint32_t addr, uint16_t value, MemoryOperationType type);
-	template<uint8_t accessWidth> void ProcessWrite(uint32_t addr, uint16_t value, MemoryOperationType type);
+	template<uint8_t accessWidth, uint8_t hooks> void ProcessRead(uint32_t addr, uint16_t value, MemoryOperationType type);
+	template<uint8_t accessWidth, uint8_t hooks> void ProcessWrite(uint32_t addr, uint16_t value, MemoryOperationType type);
 
 	template<MemoryOperationType opType, typename T>
 	void ProcessMemoryAccess(uint32_t addr, T value, MemoryType memType);
@@ -17,6 +17,7 @@
 #include "Core/Debugger/LabelManager.h"
 #include "Core/Debugger/ScriptManager.h"
 #include "Core/Debugger/Profiler.h"
+#include "Core/Debugger/SamplingProfiler.h"
 #include "Core/Debugger/IAssembler.h"
 #include "Core/Debugger/BaseEventManager.h"
 #include "Core/Debugger/ITraceLogger.h"
@@ -107,6 +108,11 @@ extern "C"
 
 	DllExport void __stdcall ResetProfiler(CpuType cpuType) { WithToolVoid(GetCallstackManager(cpuType), GetProfiler()->Reset()); }
 
+	DllExport void __stdcall SetSamplingProfilerOptions(CpuType cpuType, SamplingProfilerOptions options) { WithToolVoid(GetCallstackManager(cpuType), GetSamplingProfiler()->SetOptions(options)); }
+	DllExport void __stdcall ResetSamplingProfiler(CpuType cpuType) { WithToolVoid(GetCallstackManager(cpuType), GetSamplingProfiler()->Reset()); }
+	DllExport uint64_t __stdcall GetSamplingProfilerSampleCount(CpuType cpuType) { return WithTool(uint64_t, GetCallstackManager(cpuType), GetSamplingProfiler()->GetSampleCount()); }
+	DllExport bool __stdcall ExportSamplingProfilerData(CpuType cpuType, const char* filename) { return WithTool(bool, GetCallstackManager(cpuType), GetSamplingProfiler()->ExportFoldedStacks(filename)); }
+
 	DllExport void __stdcall GetConsoleState(BaseState& state, ConsoleType consoleType) { WithDebugger(void, GetConsoleState(state, consoleType)); }
 	DllExport void __stdcall GetCpuState(BaseState& state, CpuType cpuType) { WithDebugger(void, GetCpuState(state, cpuType)); }
 	DllExport void __stdcall GetPpuState(BaseState& state, CpuType cpuType) { WithDebugger(void, GetPpuState(state, cpuType)); }
@@ -142,10 +148,14 @@ extern "C"
 	DllExport AddressInfo __stdcall GetRelativeAddress(AddressInfo absAddress, CpuType cpuType) { return WithDebugger(AddressInfo, GetRelativeAddress(absAddress, cpuType)); }
 
 	DllExport void __stdcall SetLabel(uint32_t address, MemoryType memType, char* label, char* comment) { WithDebugger(void, GetLabelManager()->SetLabel(address, memType, label, comment)); }
+	DllExport void __stdcall SetLabels(CodeLabelInfo labels[], uint32_t count) { WithDebugger(void, GetLabelManager()->SetLabels(labels, count)); }
 	DllExport void __stdcall ClearLabels() { WithDebugger(void, GetLabelManager()->ClearLabels()); }
 
 	DllExport void __stdcall ResetMemoryAccessCounts() { WithDebugger(void, GetMemoryAccessCounter()->ResetCounts()); }
 	DllExport void __stdcall GetMemoryAccessCounts(uint32_t offset, uint32_t length, MemoryType memoryType, AddressCounters* counts) { WithDebugger(void, GetMemoryAccessCounter()->GetAccessCounts(offset, length, memoryType, counts)); }
+	DllExport bool __stdcall StartMemoryAccessHeatmapCapture(const char* filename, uint32_t frameCount) { return WithDebugger(bool, GetMemoryAccessCounter()->StartHeatmapCapture(filename, frameCount)); }
+	DllExport void __stdcall StopMemoryAccessHeatmapCapture() { WithDebugger(void, GetMemoryAccessCounter()->StopHeatmapCapture()); }
+	DllExport bool __stdcall IsMemoryAccessHeatmapCaptureRunning() { return WithDebugger(bool, GetMemoryAccessCounter()->IsHeatmapCaptureRunning()); }
 
 	DllExport CdlStatistics __stdcall GetCdlStatistics(MemoryType memoryType) { return WithDebugger(CdlStatistics, GetCdlManager()->GetCdlStatistics(memoryType)); }
 	DllExport uint32_t __stdcall GetCdlFunctions(MemoryType memoryType, uint32_t functions[], uint32_t maxSize) { return WithDebugger(uint32_t, GetCdlManager()->GetCdlFunctions(memoryType, functions, maxSize)); }
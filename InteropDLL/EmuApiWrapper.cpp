@@ -1,4 +1,5 @@
 #include "Common.h"
+#include <random>
 #include "Core/Shared/Emulator.h"
 #include "Core/Shared/EmuSettings.h"
 #include "Core/Shared/Video/VideoDecoder.h"
@@ -11,11 +12,24 @@
 #include "Core/Shared/ShortcutKeyHandler.h"
 #include "Core/Shared/TimingInfo.h"
 #include "Core/Shared/CheatManager.h"
+#include "Core/Shared/CompressedDiscImage.h"
 #include "Core/Shared/DebuggerRequest.h"
+#include "Core/Shared/OpcodeDispatch.h"
 #include "Core/Netplay/GameClient.h"
 #include "Core/Netplay/GameServer.h"
+#include "Core/Netplay/RollbackManager.h"
+#include "Core/Netplay/GameConnection.h"
+#include "Core/Netplay/HandShakeMessage.h"
+#include "Core/Netplay/ServerInformationMessage.h"
+#include "Core/Netplay/MessageType.h"
+#include "Core/Netplay/StateHasher.h"
+#include "Core/Shared/BaseControlManager.h"
+#include "Core/Shared/Interfaces/IInputRecorder.h"
 #include "Utilities/ArchiveReader.h"
+#include "Utilities/CRC32.h"
 #include "Utilities/FolderUtilities.h"
+#include "Utilities/Socket.h"
+#include "Utilities/SocketPoller.h"
 #include "Utilities/StringUtilities.h"
 #include "InteropNotificationListeners.h"
 
@@ -174,16 +188,19 @@ extern "C" {
 
 	DllExport void __stdcall GetArchiveRomList(char* filename, char* outBuffer, uint32_t maxLength) { 
 		std::ostringstream out;
-		unique_ptr<ArchiveReader> reader = ArchiveReader::GetReader(filename);
-		if(reader) {
-			for(string romName : reader->GetFileList(VirtualFile::RomExtensions)) {
-				out << romName << "[!|!]";
-			}
+		for(string romName : ArchiveReader::GetCachedFileList(filename, VirtualFile::RomExtensions)) {
+			out << romName << "[!|!]";
 		}
 
 		StringUtilities::CopyToBuffer(out.str(), outBuffer, maxLength);
 	}
 
+	DllExport bool __stdcall CompressDiscImage(char* cueFile, char* outputFile)
+	{
+		VirtualFile file(cueFile);
+		return CompressedDiscImage::Create(file, outputFile);
+	}
+
 	DllExport bool __stdcall IsRunning()
 	{
 		return _emu->IsRunning();
@@ -292,6 +309,7 @@ extern "C" {
 	DllExport void __stdcall LoadState(uint32_t stateIndex) { _emu->GetSaveStateManager()->LoadState(stateIndex); }
 	DllExport void __stdcall SaveStateFile(char* filepath) { _emu->GetSaveStateManager()->SaveState(filepath); }
 	DllExport void __stdcall LoadStateFile(char* filepath) { _emu->GetSaveStateManager()->LoadState(filepath); }
+	DllExport bool __stdcall HasPendingSaveStateWrites() { return _emu->GetSaveStateManager()->HasPendingWrites(); }
 	DllExport void __stdcall LoadRecentGame(char* filepath, bool resetGame) { _emu->GetSaveStateManager()->LoadRecentGame(filepath, resetGame); }
 	DllExport int32_t __stdcall GetSaveStatePreview(char* saveStatePath, uint8_t* pngData) { return _emu->GetSaveStateManager()->GetSaveStatePreview(saveStatePath, pngData); }
 
@@ -312,6 +330,34 @@ extern "C" {
 		void SetDisabled(bool disabled) {}
 	};
 
+	static void PgoLoadRom(VirtualFile romFile)
+	{
+		KeyManager::SetSettings(_emu->GetSettings());
+		_emu->Initialize();
+
+		//Map key #10 to the start button for all consoles - this key is toggled on/off every 4 frames
+		NesConfig& nesCfg = _emu->GetSettings()->GetNesConfig();
+		nesCfg.Port1.Type = ControllerType::NesController;
+		nesCfg.Port1.Keys.Mapping1.Start = 10;
+
+		SnesConfig& snesCfg = _emu->GetSettings()->GetSnesConfig();
+		snesCfg.Port1.Type = ControllerType::SnesController;
+		snesCfg.Port1.Keys.Mapping1.Start = 10;
+
+		GameboyConfig& gbCfg = _emu->GetSettings()->GetGameboyConfig();
+		gbCfg.Model = GameboyModel::GameboyColor;
+		gbCfg.Controller.Keys.Mapping1.Start = 10;
+
+		PcEngineConfig& pceCfg = _emu->GetSettings()->GetPcEngineConfig();
+		pceCfg.Port1.Type = ControllerType::PceController;
+		pceCfg.Port1.Keys.Mapping1.Start = 10;
+
+		_emu->LoadRom(romFile, VirtualFile());
+
+		//Set after loading the rom - loading resets the rewind manager, which clears this flag
+		_emu->GetSettings()->SetFlag(EmulationFlags::MaximumSpeed);
+	}
+
 	DllExport void __stdcall PgoRunTest(vector<string> testRoms, bool enableDebugger)
 	{
 		FolderUtilities::SetHomeFolder("../PGOMesenHome");
@@ -321,28 +367,7 @@ extern "C" {
 		for(size_t i = 0; i < testRoms.size(); i++) {
 			std::cout << "Running: " << testRoms[i] << std::endl;
 
-			KeyManager::SetSettings(_emu->GetSettings());
-			_emu->Initialize();
-
-			//Map key #10 to the start button for all consoles - this key is toggled on/off every 4 frames
-			NesConfig& nesCfg = _emu->GetSettings()->GetNesConfig();
-			nesCfg.Port1.Type = ControllerType::NesController;
-			nesCfg.Port1.Keys.Mapping1.Start = 10;
-
-			SnesConfig& snesCfg = _emu->GetSettings()->GetSnesConfig();
-			snesCfg.Port1.Type = ControllerType::SnesController;
-			snesCfg.Port1.Keys.Mapping1.Start = 10;
-
-			GameboyConfig& gbCfg = _emu->GetSettings()->GetGameboyConfig();
-			gbCfg.Model = GameboyModel::GameboyColor;
-			gbCfg.Controller.Keys.Mapping1.Start = 10;
-
-			PcEngineConfig& pceCfg = _emu->GetSettings()->GetPcEngineConfig();
-			pceCfg.Port1.Type = ControllerType::PceController;
-			pceCfg.Port1.Keys.Mapping1.Start = 10;
-
-			_emu->GetSettings()->SetFlag(EmulationFlags::MaximumSpeed);
-			_emu->LoadRom((VirtualFile)testRoms[i], VirtualFile());
+			PgoLoadRom(testRoms[i]);
 
 			if(enableDebugger) {
 				//turn on debugger to profile the debugger's code too
@@ -356,4 +381,729 @@ extern "C" {
 			_emu->Release();
 		}
 	}
+
+	//Minimal assembler used to build the cpu benchmark roms
+	class PgoRomBuilder
+	{
+	private:
+		vector<uint8_t>& _rom;
+		uint32_t _romOffset;
+		uint16_t _baseAddr;
+		uint16_t _addr;
+
+	public:
+		PgoRomBuilder(vector<uint8_t>& rom, uint32_t romOffset, uint16_t baseAddr) : _rom(rom)
+		{
+			_romOffset = romOffset;
+			_baseAddr = baseAddr;
+			_addr = baseAddr;
+		}
+
+		uint16_t GetAddr() { return _addr; }
+		void SetAddr(uint16_t addr) { _addr = addr; }
+
+		void Emit(std::initializer_list<uint8_t> bytes)
+		{
+			for(uint8_t value : bytes) {
+				_rom[_romOffset + (uint16_t)(_addr - _baseAddr)] = value;
+				_addr++;
+			}
+		}
+
+		void EmitWord(uint8_t opCode, uint16_t value) { Emit({ opCode, (uint8_t)value, (uint8_t)(value >> 8) }); }
+		void EmitBranch(uint8_t opCode, uint16_t target) { Emit({ opCode, (uint8_t)(target - (_addr + 2)) }); }
+
+		void SetWord(uint16_t addr, uint16_t value)
+		{
+			_rom[_romOffset + (uint16_t)(addr - _baseAddr)] = (uint8_t)value;
+			_rom[_romOffset + (uint16_t)(addr - _baseAddr) + 1] = (uint8_t)(value >> 8);
+		}
+	};
+
+	struct PgoCpuBenchmark
+	{
+		string Name;
+		string Filename;
+		vector<uint8_t> Rom;
+
+		//Each iteration of the benchmark loop increments a 32-bit counter at the start of this ram
+		MemoryType CounterMemType;
+		uint32_t InstructionsPerLoop;
+	};
+
+	static uint32_t EmitGbBenchmarkLoop(PgoRomBuilder& code, uint16_t sub)
+	{
+		//Counter at $C000-$C003 (start of work ram), scratch values at $C010-$C011
+		code.Emit({ 0xAF }); //XOR A
+		for(uint16_t i = 0; i < 4; i++) {
+			code.EmitWord(0xEA, 0xC000 + i); //LD (nn), A
+		}
+		uint16_t loop = code.GetAddr();
+		code.EmitWord(0x21, 0xC010); //LD HL, $C010
+		code.Emit({ 0x7E, 0xC6, 0x03, 0x22 }); //LD A, (HL), ADD A, $03, LD (HL+), A
+		code.Emit({ 0x46, 0x04, 0x70, 0x0E, 0x08 }); //LD B, (HL), INC B, LD (HL), B, LD C, $08
+		uint16_t inner = code.GetAddr();
+		code.Emit({ 0x0D }); //DEC C
+		code.EmitBranch(0x20, inner); //JR NZ, inner
+		code.Emit({ 0x07, 0xA8, 0x57 }); //RLCA, XOR B, LD D, A
+		code.EmitWord(0xCD, sub); //CALL sub
+		code.EmitWord(0x21, 0xC000); //LD HL, $C000
+		for(int i = 0; i < 3; i++) {
+			code.Emit({ 0x34 }); //INC (HL)
+			code.EmitBranch(0x20, loop); //JR NZ, loop
+			code.Emit({ 0x2C }); //INC L
+		}
+		code.Emit({ 0x34 }); //INC (HL)
+		code.EmitBranch(0x18, loop); //JR loop
+
+		//LD HL/LD A/ADD/LD (HL+) + LD B/INC B/LD (HL)/LD C + 8x DEC/JR + RLCA/XOR/LD D + CALL/RET + LD HL/INC (HL)/JR
+		return 4 + 4 + 16 + 3 + 2 + 3;
+	}
+
+	static uint32_t EmitSpcBenchmarkLoop(PgoRomBuilder& code, uint16_t sub)
+	{
+		//Counter at $00-$03 (direct page), scratch values at $10-$12
+		code.Emit({ 0xE8, 0x00, 0xC4, 0x00, 0xC4, 0x01, 0xC4, 0x02, 0xC4, 0x03 }); //MOV A, #$00, MOV $00-$03, A
+		uint16_t loop = code.GetAddr();
+		code.Emit({ 0xE4, 0x10, 0x60, 0x88, 0x03, 0xC4, 0x10 }); //MOV A, $10, CLRC, ADC A, #$03, MOV $10, A
+		code.Emit({ 0xF8, 0x11, 0x3D, 0xD8, 0x11, 0x8D, 0x08 }); //MOV X, $11, INC X, MOV $11, X, MOV Y, #$08
+		uint16_t inner = code.GetAddr();
+		code.Emit({ 0xDC }); //DEC Y
+		code.EmitBranch(0xD0, inner); //BNE inner
+		code.Emit({ 0x1C, 0x44, 0x12, 0xC4, 0x12 }); //ASL A, EOR A, $12, MOV $12, A
+		code.EmitWord(0x3F, sub); //CALL sub
+		for(uint8_t i = 0; i < 3; i++) {
+			code.Emit({ 0xAB, i }); //INC counter
+			code.EmitBranch(0xD0, loop); //BNE loop
+		}
+		code.Emit({ 0xAB, 0x03 }); //INC $03
+		code.EmitBranch(0x2F, loop); //BRA loop
+
+		//MOV/CLRC/ADC/MOV + MOV/INC/MOV/MOV + 8x DEC/BNE + ASL/EOR/MOV + CALL/RET + INC/BNE
+		return 4 + 4 + 16 + 3 + 2 + 2;
+	}
+
+	//Only the cpus that can be built with threaded dispatch (see Shared/OpcodeDispatch.h) are benchmarked
+	static vector<PgoCpuBenchmark> GetCpuBenchmarks()
+	{
+		vector<PgoCpuBenchmark> benchmarks;
+
+		{
+			//Game Boy - 32KB ROM-only cart
+			PgoCpuBenchmark bench = { "Game Boy (SM83)", "CpuBenchmark.gb", vector<uint8_t>(0x8000, 0), MemoryType::GbWorkRam };
+			static constexpr uint8_t logo[48] = {
+				0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83, 0x00, 0x0C, 0x00, 0x0D,
+				0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E, 0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99,
+				0xBB, 0xBB, 0x67, 0x63, 0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E
+			};
+			memcpy(bench.Rom.data() + 0x104, logo, sizeof(logo));
+			uint8_t checksum = 0;
+			for(int i = 0x134; i <= 0x14C; i++) {
+				checksum = checksum - bench.Rom[i] - 1;
+			}
+			bench.Rom[0x14D] = checksum;
+
+			PgoRomBuilder code(bench.Rom, 0, 0);
+			code.SetAddr(0x150);
+			uint16_t sub = code.GetAddr();
+			code.Emit({ 0xC9 }); //RET
+			uint16_t entry = code.GetAddr();
+			code.Emit({ 0xF3 }); //DI
+			code.EmitWord(0x31, 0xDFFF); //LD SP, $DFFF
+			bench.InstructionsPerLoop = EmitGbBenchmarkLoop(code, sub);
+
+			code.SetAddr(0x100);
+			code.Emit({ 0x00 }); //NOP
+			code.EmitWord(0xC3, entry); //JP entry
+			benchmarks.push_back(bench);
+		}
+
+		{
+			//SNES SPC-700 - SPC file (header, 64KB of ram, dsp registers, extra ram), the main cpu stays halted
+			PgoCpuBenchmark bench = { "SNES SPC (SPC-700)", "CpuBenchmark.spc", vector<uint8_t>(0x10200, 0), MemoryType::SpcRam };
+			memcpy(bench.Rom.data(), "SNES-SPC700 Sound File Data v0.30\x1A\x1A", 35);
+
+			PgoRomBuilder code(bench.Rom, 0x100, 0);
+			code.SetAddr(0x200);
+			uint16_t sub = code.GetAddr();
+			code.Emit({ 0x6F }); //RET
+			uint16_t entry = code.GetAddr();
+			bench.InstructionsPerLoop = EmitSpcBenchmarkLoop(code, sub);
+
+			bench.Rom[0x25] = (uint8_t)entry;
+			bench.Rom[0x26] = (uint8_t)(entry >> 8);
+			bench.Rom[0x2B] = 0xEF; //SP
+			bench.Rom[0x10100 + 0x6C] = 0xE0; //DSP FLG: soft reset, mute, disable echo writes (which would overwrite the counter)
+			benchmarks.push_back(bench);
+		}
+
+		return benchmarks;
+	}
+
+	//Runs a fixed instruction mix (loads/stores, alu ops, branches, calls) on each cpu and prints the number of instructions executed per second
+	DllExport void __stdcall PgoRunCpuBenchmark(uint32_t durationMs)
+	{
+		FolderUtilities::SetHomeFolder("../PGOMesenHome");
+		PgoKeyManager pgoKeyManager;
+		KeyManager::RegisterKeyManager(&pgoKeyManager);
+
+		auto readCounter = [](MemoryType memType) -> uint32_t {
+			uint8_t* counter = (uint8_t*)_emu->GetMemory(memType).Memory;
+			return counter ? (counter[0] | (counter[1] << 8) | (counter[2] << 16) | ((uint32_t)counter[3] << 24)) : 0;
+		};
+
+#ifdef MESEN_COMPUTED_GOTO
+		std::cout << "Opcode dispatch: computed goto" << std::endl;
+#else
+		std::cout << "Opcode dispatch: switch" << std::endl;
+#endif
+		std::cout << std::fixed << std::setprecision(2);
+		for(PgoCpuBenchmark& bench : GetCpuBenchmarks()) {
+			PgoLoadRom(VirtualFile(bench.Rom.data(), bench.Rom.size(), bench.Filename));
+
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(500));
+			uint32_t startCount = readCounter(bench.CounterMemType);
+			auto start = std::chrono::steady_clock::now();
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(durationMs));
+			uint32_t loopCount = readCounter(bench.CounterMemType) - startCount;
+			double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			std::cout << bench.Name << ": " << (loopCount * (double)bench.InstructionsPerLoop / elapsed / 1000000) << " million instructions/sec" << std::endl;
+
+			_emu->Stop(false);
+			_emu->Release();
+		}
+	}
+
+	DllExport void __stdcall PgoRunBenchmark(vector<string> testRoms, uint32_t durationMs)
+	{
+		FolderUtilities::SetHomeFolder("../PGOMesenHome");
+		PgoKeyManager pgoKeyManager;
+		KeyManager::RegisterKeyManager(&pgoKeyManager);
+
+		auto measureFps = [=]() {
+			//Skip the first frames (rom loading, debugger init, etc.)
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(500));
+			uint32_t startFrame = _emu->GetFrameCount();
+			auto start = std::chrono::steady_clock::now();
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(durationMs));
+			uint32_t frameCount = _emu->GetFrameCount() - startFrame;
+			double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			return frameCount / elapsed;
+		};
+
+		//Compares the emulation speed without the debugger, and with the debugger enabled but idle (no breakpoints, scripts, etc.)
+		std::cout << std::fixed << std::setprecision(1);
+		for(size_t i = 0; i < testRoms.size(); i++) {
+			PgoLoadRom(testRoms[i]);
+			double fps = measureFps();
+			_emu->GetDebugger(true);
+			double debuggerFps = measureFps();
+
+			std::cout << testRoms[i] << ": " << fps << " FPS, " << debuggerFps << " FPS with debugger (" << (debuggerFps / fps * 100) << "%)" << std::endl;
+
+			_emu->Stop(false);
+			_emu->Release();
+		}
+	}
+
+	//Runs each rom as a rollback netplay client, with a simulated host that sends its input with the specified latency/jitter
+	//Prints the number of rollbacks, their depth and the time spent saving snapshots and re-emulating frames
+	DllExport void __stdcall PgoRunRollbackTest(vector<string> testRoms, uint32_t latencyMs, uint32_t jitterMs, uint32_t durationMs)
+	{
+		FolderUtilities::SetHomeFolder("../PGOMesenHome");
+		PgoKeyManager pgoKeyManager;
+		KeyManager::RegisterKeyManager(&pgoKeyManager);
+
+		RollbackManager* rollback = _emu->GetRollbackManager();
+
+		std::cout << "Latency: " << latencyMs << "ms, jitter: " << jitterMs << "ms" << std::endl;
+		std::cout << std::fixed << std::setprecision(2);
+		for(size_t i = 0; i < testRoms.size(); i++) {
+			PgoLoadRom(testRoms[i]);
+			_emu->GetSettings()->ClearFlag(EmulationFlags::MaximumSpeed);
+
+			vector<shared_ptr<BaseControlDevice>> devices;
+			double fps;
+			uint32_t startFrameCount;
+			{
+				auto lock = _emu->AcquireLock();
+				devices = _emu->GetConsole()->GetControlManager()->GetControlDevices();
+				fps = _emu->GetFps();
+				startFrameCount = _emu->GetFrameCount();
+				rollback->Start();
+				_emu->RegisterInputProvider(rollback);
+			}
+
+			//Simulated host: generates one input per frame for each device (buttons change every few frames, at random)
+			//and delivers it in order, after the network latency + a random amount of jitter
+			//The first device is the local player's: its input is sent to the host (with the same latency/jitter) when it changes,
+			//and the host applies it on the frame it's stamped with, or on the host's current frame when it arrives too late
+			struct SentInput
+			{
+				uint32_t FrameCount;
+				ControlDeviceState State;
+				std::chrono::steady_clock::time_point Arrival;
+			};
+			std::mutex sentLock;
+			std::deque<SentInput> sentInputs;
+
+			atomic<bool> stopFlag(false);
+			auto frameDuration = std::chrono::duration<double, std::milli>(1000.0 / fps);
+			auto start = std::chrono::steady_clock::now();
+			auto getFrameTime = [&](uint32_t frame) {
+				return start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameDuration * frame);
+			};
+			auto updateState = [](std::mt19937& rng, ControlDeviceState& state) {
+				if(rng() % 6 == 0) {
+					for(uint8_t& value : state.State) {
+						value = (uint8_t)rng();
+					}
+				}
+			};
+
+			//Local player
+			thread localThread([&]() {
+				if(devices.empty()) {
+					return;
+				}
+
+				std::mt19937 rng(5678);
+				auto lastArrival = start;
+				ControlDeviceState state = devices[0]->GetRawState();
+				ControlDeviceState lastSent;
+				for(uint32_t frame = 0; !stopFlag; frame++) {
+					updateState(rng, state);
+					std::this_thread::sleep_until(getFrameTime(frame));
+					if(state != lastSent) {
+						uint32_t frameCount = rollback->SetLocalInput(devices[0]->GetPort(), devices[0]->GetControllerType(), state);
+						auto delay = std::chrono::milliseconds(latencyMs + (jitterMs ? rng() % (jitterMs + 1) : 0));
+						lastArrival = std::max(lastArrival, std::chrono::steady_clock::now() + delay);
+
+						std::lock_guard<std::mutex> lock(sentLock);
+						sentInputs.push_back({ frameCount, state, lastArrival });
+						lastSent = state;
+					}
+				}
+			});
+
+			thread hostThread([&]() {
+				std::mt19937 rng(1234);
+				auto lastDelivery = start;
+				vector<ControlDeviceState> states(devices.size());
+				for(size_t j = 0; j < devices.size(); j++) {
+					states[j] = devices[j]->GetRawState();
+				}
+
+				for(uint32_t frame = 0; !stopFlag; frame++) {
+					//Only the local player's and the player 2 controllers' states change, other devices keep sending the same state
+					if(states.size() > 0) {
+						std::this_thread::sleep_until(getFrameTime(frame));
+						std::lock_guard<std::mutex> lock(sentLock);
+						while(!sentInputs.empty() && sentInputs.front().Arrival <= getFrameTime(frame) && sentInputs.front().FrameCount <= startFrameCount + frame) {
+							states[0] = sentInputs.front().State;
+							sentInputs.pop_front();
+						}
+					}
+					if(states.size() > 1) {
+						updateState(rng, states[1]);
+					}
+
+					auto delay = std::chrono::milliseconds(latencyMs + (jitterMs ? rng() % (jitterMs + 1) : 0));
+					auto delivery = std::max(lastDelivery, getFrameTime(frame) + delay);
+					lastDelivery = delivery;
+					std::this_thread::sleep_until(delivery);
+
+					for(size_t j = 0; j < devices.size(); j++) {
+						rollback->AddInput(devices[j]->GetPort(), states[j]);
+					}
+				}
+			});
+
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(durationMs));
+			stopFlag = true;
+			localThread.join();
+			hostThread.join();
+
+			{
+				auto lock = _emu->AcquireLock();
+				_emu->UnregisterInputProvider(rollback);
+				rollback->Stop();
+			}
+
+			RollbackStats stats = rollback->GetStats();
+			std::cout << testRoms[i] << ": " << stats.FrameCount << " frames (" << stats.PredictedFrameCount << " predicted), ";
+			std::cout << stats.RollbackCount << " rollbacks (avg " << stats.AvgRollbackDepth << ", max " << stats.MaxRollbackDepth << " frames), ";
+			std::cout << stats.StallCount << " stalls, " << stats.LateInputCount << " late local inputs (input delay: " << stats.InputDelay << " frames)" << std::endl;
+			std::cout << "  Snapshot: " << stats.AvgSnapshotTime << "ms/frame, rollback: " << stats.AvgRollbackTime << "ms avg, " << stats.MaxRollbackTime << "ms max" << std::endl;
+
+			_emu->Stop(false);
+			_emu->Release();
+		}
+	}
+
+	//Netplay spectator that records when the host's movie data is received
+	class PgoNetplayClient final : public GameConnection
+	{
+	public:
+		vector<std::chrono::steady_clock::time_point> ReceiveTimes;
+
+		PgoNetplayClient(unique_ptr<Socket> socket) : GameConnection(::_emu.get(), std::move(socket)) {}
+
+	protected:
+		void ProcessMessage(NetMessage* message) override
+		{
+			if(message->GetType() == MessageType::ServerInformation) {
+				string hash = HandShakeMessage::GetPasswordHash("", ((ServerInformationMessage*)message)->GetHashSalt());
+				HandShakeMessage handshake(hash, true, _emu->GetSettings()->GetVersion());
+				SendNetMessage(handshake);
+			} else if(message->GetType() == MessageType::MovieData) {
+				ReceiveTimes.push_back(std::chrono::steady_clock::now());
+			}
+		}
+	};
+
+	class PgoFrameRecorder : public IInputRecorder
+	{
+	public:
+		std::mutex Lock;
+		vector<std::chrono::steady_clock::time_point> FrameTimes;
+		size_t DeviceCount = 0;
+
+		void RecordInput(vector<shared_ptr<BaseControlDevice>> devices) override
+		{
+			std::lock_guard<std::mutex> lock(Lock);
+			FrameTimes.push_back(std::chrono::steady_clock::now());
+			DeviceCount = devices.size();
+		}
+	};
+
+	//Hosts a netplay game on the local machine, with spectators connected to it, and prints the delay between the end of
+	//each of the host's frames and the reception of the frame's input data by the clients
+	DllExport void __stdcall PgoRunNetplayBenchmark(vector<string> testRoms, uint32_t clientCount, uint32_t durationMs)
+	{
+		FolderUtilities::SetHomeFolder("../PGOMesenHome");
+		PgoKeyManager pgoKeyManager;
+		KeyManager::RegisterKeyManager(&pgoKeyManager);
+
+		constexpr uint16_t port = 8888;
+
+		std::cout << std::fixed << std::setprecision(3);
+		for(size_t i = 0; i < testRoms.size(); i++) {
+			PgoLoadRom(testRoms[i]);
+			_emu->GetSettings()->ClearFlag(EmulationFlags::MaximumSpeed);
+
+			//Registered before the server, to get the time at which the frame's input is sent to the clients
+			PgoFrameRecorder recorder;
+			_emu->RegisterInputRecorder(&recorder);
+			_emu->GetGameServer()->StartServer(port, "");
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(200));
+
+			vector<unique_ptr<PgoNetplayClient>> clients;
+			for(uint32_t j = 0; j < clientCount; j++) {
+				unique_ptr<Socket> socket(new Socket());
+				if(socket->Connect("127.0.0.1", port)) {
+					clients.push_back(unique_ptr<PgoNetplayClient>(new PgoNetplayClient(std::move(socket))));
+				}
+			}
+
+			//All clients are processed by a single thread
+			atomic<bool> stopFlag(false);
+			thread clientThread([&]() {
+				SocketPoller poller;
+				while(!stopFlag) {
+					poller.Clear();
+					for(unique_ptr<PgoNetplayClient>& client : clients) {
+						poller.AddSocket(client->GetSocket(), client->HasPendingData());
+					}
+					poller.Wait(1);
+
+					for(size_t j = 0; j < clients.size(); j++) {
+						if(poller.IsReadable(j)) {
+							clients[j]->ProcessMessages();
+						}
+						clients[j]->WriteSocket();
+					}
+				}
+			});
+
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(durationMs));
+
+			//Stop sending new frames and give the clients time to receive the remaining data
+			_emu->Pause();
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(500));
+			stopFlag = true;
+			clientThread.join();
+
+			_emu->GetGameServer()->StopServer();
+			_emu->UnregisterInputRecorder(&recorder);
+
+			//Clients only receive data after their handshake, match their data with the host's frames starting from the end
+			double totalDelay = 0;
+			double maxDelay = 0;
+			size_t sampleCount = 0;
+			size_t deviceCount = std::max<size_t>(recorder.DeviceCount, 1);
+			for(unique_ptr<PgoNetplayClient>& client : clients) {
+				vector<std::chrono::steady_clock::time_point>& times = client->ReceiveTimes;
+				size_t frameCount = std::min(times.size() / deviceCount, recorder.FrameTimes.size());
+				for(size_t j = 0; j < frameCount; j++) {
+					auto received = times[times.size() - 1 - j * deviceCount];
+					auto sent = recorder.FrameTimes[recorder.FrameTimes.size() - 1 - j];
+					double delay = std::chrono::duration<double, std::milli>(received - sent).count();
+					totalDelay += delay;
+					maxDelay = std::max(maxDelay, delay);
+					sampleCount++;
+				}
+			}
+			clients.clear();
+
+			std::cout << testRoms[i] << ": " << clientCount << " clients, " << recorder.FrameTimes.size() << " frames, ";
+			std::cout << "delay: " << (sampleCount ? totalDelay / sampleCount : 0) << "ms avg, " << maxDelay << "ms max" << std::endl;
+
+			_emu->Stop(false);
+			_emu->Release();
+		}
+	}
+
+	//Measures the cost of the netplay desync detection's state hashing, compared to the time needed to emulate a frame
+	DllExport void __stdcall PgoRunStateHashBenchmark(vector<string> testRoms, uint32_t durationMs)
+	{
+		FolderUtilities::SetHomeFolder("../PGOMesenHome");
+		PgoKeyManager pgoKeyManager;
+		KeyManager::RegisterKeyManager(&pgoKeyManager);
+
+		std::cout << std::fixed << std::setprecision(3);
+		for(size_t i = 0; i < testRoms.size(); i++) {
+			PgoLoadRom(testRoms[i]);
+
+			//Emulation speed (maximum speed)
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(500));
+			uint32_t startFrame = _emu->GetFrameCount();
+			auto start = std::chrono::steady_clock::now();
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(durationMs));
+			uint32_t frameCount = _emu->GetFrameCount() - startFrame;
+			double frameTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / std::max<uint32_t>(frameCount, 1);
+
+			//Hash the memory as if frames were being emulated (while the emulation is paused)
+			double hashTime;
+			uint64_t hashedSize;
+			{
+				auto lock = _emu->AcquireLock();
+				StateHasher hasher(_emu.get());
+				uint32_t frame = 0;
+				uint32_t hash;
+				uint32_t hashCount = 0;
+				auto hashStart = std::chrono::steady_clock::now();
+				for(; frame < StateHasher::HashInterval * 100; frame++) {
+					hashCount += hasher.ProcessFrame(frame, hash) ? 1 : 0;
+				}
+				hashTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - hashStart).count() / frame;
+				hashedSize = hasher.GetHashedSize();
+			}
+
+			std::cout << testRoms[i] << ": " << (hashedSize / 1024) << " KB hashed every " << StateHasher::HashInterval << " frames, ";
+			std::cout << hashTime << " us/frame (" << (hashTime / frameTime * 100) << "% of the emulation time per frame, " << frameTime << " us)" << std::endl;
+
+			_emu->Stop(false);
+			_emu->Release();
+		}
+	}
+
+	//Hashes the SPC's ram and the main cpu's work ram at the end of each frame
+	class PgoSpcStateRecorder : public IInputRecorder
+	{
+	public:
+		vector<uint32_t> Hashes;
+		uint32_t FirstFrame = 0;
+
+		//Number of recorded frames after which the debugger is started (from the emulation thread, in the middle of RunFrame)
+		size_t DebuggerFrame = SIZE_MAX;
+
+		void RecordInput(vector<shared_ptr<BaseControlDevice>> devices) override
+		{
+			//The SPC thread has caught up with the main cpu at this point (end of frame)
+			vector<uint8_t> data;
+			for(MemoryType memType : { MemoryType::SpcRam, MemoryType::SnesWorkRam }) {
+				ConsoleMemoryInfo mem = _emu->GetMemory(memType);
+				data.insert(data.end(), (uint8_t*)mem.Memory, (uint8_t*)mem.Memory + mem.Size);
+			}
+
+			if(Hashes.empty()) {
+				FirstFrame = _emu->GetFrameCount();
+			}
+			Hashes.push_back(CRC32::GetCRC(data));
+
+			if(Hashes.size() == DebuggerFrame) {
+				_emu->GetDebugger(true);
+			}
+		}
+	};
+
+	//SNES rom that uploads a small program to the SPC through the IPL rom and then keeps exchanging values with it through the APU ports
+	static vector<uint8_t> GetSpcPortTestRom()
+	{
+		vector<uint8_t> rom(0x8000, 0);
+
+		//SPC program (stored at $9000, uploaded to $0200): echoes port 0 (+1) each time it changes, and sums the values written to port 1
+		PgoRomBuilder spc(rom, 0x1000, 0x200);
+		spc.Emit({ 0x8F, 0x00, 0x00 }); //MOV $00, #$00
+		uint16_t spcLoop = spc.GetAddr();
+		spc.Emit({ 0xE4, 0xF4, 0x64, 0x00 }); //MOV A, $F4, CMP A, $00
+		spc.EmitBranch(0xF0, spcLoop); //BEQ loop
+		spc.Emit({ 0xC4, 0x00, 0xBC, 0x2D }); //MOV $00, A, INC A, PUSH A
+		spc.Emit({ 0xE4, 0xF5, 0x60, 0x84, 0x01, 0xC4, 0x01, 0xAB, 0x02 }); //MOV A, $F5, CLRC, ADC A, $01, MOV $01, A, INC $02
+		spc.Emit({ 0xAE, 0xC4, 0xF4 }); //POP A, MOV $F4, A
+		spc.EmitBranch(0x2F, spcLoop); //BRA loop
+		uint8_t spcLength = (uint8_t)(spc.GetAddr() - 0x200);
+
+		PgoRomBuilder cpu(rom, 0, 0x8000);
+		cpu.SetAddr(0x8000);
+		cpu.Emit({ 0x78 }); //SEI
+		uint16_t waitIpl = cpu.GetAddr();
+		cpu.Emit({ 0xA9, 0xAA }); cpu.EmitWord(0xCD, 0x2140); cpu.EmitBranch(0xD0, waitIpl); //LDA #$AA, CMP $2140, BNE
+		cpu.Emit({ 0xA9, 0xBB }); cpu.EmitWord(0xCD, 0x2141); cpu.EmitBranch(0xD0, waitIpl); //LDA #$BB, CMP $2141, BNE
+
+		//Transfer the program to $0200
+		cpu.Emit({ 0xA9, 0x00 }); cpu.EmitWord(0x8D, 0x2142); //LDA #$00, STA $2142
+		cpu.Emit({ 0xA9, 0x02 }); cpu.EmitWord(0x8D, 0x2143); //LDA #$02, STA $2143
+		cpu.Emit({ 0xA9, 0x01 }); cpu.EmitWord(0x8D, 0x2141); //LDA #$01, STA $2141
+		cpu.Emit({ 0xA9, 0xCC }); cpu.EmitWord(0x8D, 0x2140); //LDA #$CC, STA $2140
+		uint16_t waitAck = cpu.GetAddr();
+		cpu.EmitWord(0xCD, 0x2140); cpu.EmitBranch(0xD0, waitAck); //CMP $2140, BNE
+		cpu.Emit({ 0xA2, 0x00 }); //LDX #$00
+		uint16_t upload = cpu.GetAddr();
+		cpu.EmitWord(0xBD, 0x9000); cpu.EmitWord(0x8D, 0x2141); cpu.EmitWord(0x8E, 0x2140); //LDA $9000,X, STA $2141, STX $2140
+		uint16_t waitByte = cpu.GetAddr();
+		cpu.EmitWord(0xEC, 0x2140); cpu.EmitBranch(0xD0, waitByte); //CPX $2140, BNE
+		cpu.Emit({ 0xE8, 0xE0, spcLength }); cpu.EmitBranch(0xD0, upload); //INX, CPX #length, BNE
+
+		//Jump to $0200 (the IPL rom echoes the value written to port 0 before jumping)
+		cpu.EmitWord(0x9C, 0x2141); cpu.Emit({ 0xE8 }); cpu.EmitWord(0x8E, 0x2140); //STZ $2141, INX, STX $2140
+		uint16_t waitStart = cpu.GetAddr();
+		cpu.EmitWord(0xEC, 0x2140); cpu.EmitBranch(0xD0, waitStart); //CPX $2140, BNE
+
+		//Wait for the echo, write the next values to ports 1 and 0, then wait for a variable amount of time
+		uint16_t mainLoop = cpu.GetAddr();
+		cpu.Emit({ 0xE8 }); //INX
+		uint16_t waitEcho = cpu.GetAddr();
+		cpu.EmitWord(0xEC, 0x2140); cpu.EmitBranch(0xD0, waitEcho); //CPX $2140, BNE
+		cpu.EmitWord(0xEE, 0x0000); cpu.EmitWord(0xAD, 0x0000); cpu.EmitWord(0x8D, 0x2141); //INC $0000, LDA $0000, STA $2141
+		cpu.Emit({ 0xE8 }); cpu.EmitWord(0x8E, 0x2140); //INX, STX $2140
+		cpu.EmitWord(0xAC, 0x0000); //LDY $0000
+		uint16_t delay = cpu.GetAddr();
+		cpu.Emit({ 0x88 }); cpu.EmitBranch(0xD0, delay); //DEY, BNE
+		cpu.EmitBranch(0x80, mainLoop); //BRA
+
+		//LoROM header
+		memcpy(rom.data() + 0x7FC0, "SPC THREAD TEST      ", 21);
+		rom[0x7FD5] = 0x20;
+		rom[0x7FD7] = 0x05;
+		rom[0x7FFC] = 0x00;
+		rom[0x7FFD] = 0x80;
+		rom[0x7FDC] = rom[0x7FDD] = 0xFF;
+		uint16_t checksum = 0;
+		for(uint8_t value : rom) {
+			checksum += value;
+		}
+		rom[0x7FDC] = (uint8_t)~checksum;
+		rom[0x7FDD] = (uint8_t)(~checksum >> 8);
+		rom[0x7FDE] = (uint8_t)checksum;
+		rom[0x7FDF] = (uint8_t)(checksum >> 8);
+		return rom;
+	}
+
+	//Runs each SNES rom from the same save state with the SPC in lockstep, on its own thread, and on its own thread with the debugger
+	//started during the run, and compares the SPC/work ram at the end of each frame. Also prints the emulation speed in each mode.
+	DllExport void __stdcall PgoRunSpcThreadTest(vector<string> testRoms, uint32_t durationMs)
+	{
+		FolderUtilities::SetHomeFolder("../PGOMesenHome");
+		PgoKeyManager pgoKeyManager;
+		KeyManager::RegisterKeyManager(&pgoKeyManager);
+
+		vector<uint8_t> portTestRom = GetSpcPortTestRom();
+		vector<VirtualFile> roms = { VirtualFile(portTestRom.data(), portTestRom.size(), "SpcPortTest.sfc") };
+		for(string& rom : testRoms) {
+			roms.push_back(rom);
+		}
+
+		if(std::thread::hardware_concurrency() < 2) {
+			std::cout << "Single-core host: the SPC thread is never used, all modes run in lockstep" << std::endl;
+		}
+
+		SnesConfig& snesCfg = _emu->GetSettings()->GetSnesConfig();
+		bool runSpcOnSeparateThread = snesCfg.RunSpcOnSeparateThread;
+
+		std::cout << std::fixed << std::setprecision(1);
+		for(VirtualFile& rom : roms) {
+			snesCfg.RunSpcOnSeparateThread = false;
+			PgoLoadRom(rom);
+			if(_emu->GetConsoleType() != ConsoleType::Snes) {
+				_emu->Stop(false);
+				_emu->Release();
+				continue;
+			}
+
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(500));
+			std::stringstream state;
+			{
+				auto lock = _emu->AcquireLock();
+				_emu->GetSaveStateManager()->SaveState(state);
+			}
+
+			//Lockstep, SPC thread, SPC thread + debugger started after 60 frames
+			PgoSpcStateRecorder recorders[3];
+			double fps[3] = {};
+			for(int mode = 0; mode < 3; mode++) {
+				PgoSpcStateRecorder& recorder = recorders[mode];
+				recorder.DebuggerFrame = mode == 2 ? 60 : SIZE_MAX;
+				{
+					auto lock = _emu->AcquireLock();
+					snesCfg.RunSpcOnSeparateThread = mode > 0;
+					state.seekg(0);
+					_emu->GetSaveStateManager()->LoadState(state);
+					_emu->RegisterInputRecorder(&recorder);
+				}
+
+				auto start = std::chrono::steady_clock::now();
+				std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(durationMs));
+				{
+					auto lock = _emu->AcquireLock();
+					_emu->UnregisterInputRecorder(&recorder);
+				}
+				fps[mode] = recorder.Hashes.size() / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				_emu->StopDebugger();
+			}
+
+			std::cout << rom.GetFileName() << ": " << fps[0] << " FPS, " << fps[1] << " FPS with the SPC thread (" << (fps[1] / fps[0] * 100) << "%)" << std::endl;
+			for(int mode = 1; mode < 3; mode++) {
+				PgoSpcStateRecorder& ref = recorders[0];
+				PgoSpcStateRecorder& recorder = recorders[mode];
+				size_t frameCount = 0;
+				size_t mismatchFrame = SIZE_MAX;
+				for(size_t j = 0; j < recorder.Hashes.size(); j++) {
+					size_t refIndex = recorder.FirstFrame + j - ref.FirstFrame;
+					if(refIndex < ref.Hashes.size()) {
+						frameCount++;
+						if(recorder.Hashes[j] != ref.Hashes[refIndex] && mismatchFrame == SIZE_MAX) {
+							mismatchFrame = recorder.FirstFrame + j;
+						}
+					}
+				}
+
+				std::cout << "  " << (mode == 1 ? "SPC thread" : "SPC thread, debugger started on the 60th frame") << ": " << frameCount << " frames compared, ";
+				if(recorder.FirstFrame != ref.FirstFrame || frameCount == 0) {
+					std::cout << "FAILED (no frames in common)" << std::endl;
+				} else if(mismatchFrame != SIZE_MAX) {
+					std::cout << "FAILED (mismatch on frame " << mismatchFrame << ")" << std::endl;
+				} else {
+					std::cout << "OK" << std::endl;
+				}
+			}
+
+			_emu->Stop(false);
+			_emu->Release();
+		}
+
+		snesCfg.RunSpcOnSeparateThread = runSpcOnSeparateThread;
+	}
 }
\ No newline at end of file
@@ -21,4 +21,6 @@ extern "C"
 	DllExport bool __stdcall MoviePlaying() { return _emu->GetMovieManager()->Playing(); }
 	DllExport bool __stdcall MovieRecording() { return _emu->GetMovieManager()->Recording(); }
 	DllExport void __stdcall MovieRecord(RecordMovieOptions options) { _emu->GetMovieManager()->Record(options); }
+	DllExport bool __stdcall MovieSeek(uint32_t frame) { return _emu->GetMovieManager()->Seek(frame); }
+	DllExport bool __stdcall MovieConvert(char* filename, char* outputFilename) { return _emu->GetMovieManager()->Convert(string(filename), string(outputFilename)); }
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "Common.h"
 #include "Core/Shared/RecordedRomTest.h"
+#include "Core/Shared/Movies/MovieVerifier.h"
 #include "Core/Shared/Emulator.h"
 #include "Core/Shared/EmuSettings.h"
+#include "Utilities/StringUtilities.h"
 
 extern unique_ptr<Emulator> _emu;
 shared_ptr<RecordedRomTest> _recordedRomTest;
@@ -55,6 +57,12 @@ extern "C"
 		return result;
 	}
 
+	DllExport void __stdcall VerifyMovie(char* romFile, char* movieFile, uint32_t timeoutSeconds, char* outJson, uint32_t maxLength)
+	{
+		shared_ptr<MovieVerifier> verifier(new MovieVerifier(_emu.get()));
+		StringUtilities::CopyToBuffer(verifier->Run(romFile, movieFile, timeoutSeconds), outJson, maxLength);
+	}
+
 	DllExport void __stdcall RomTestRecord(char* filename, bool reset)
 	{
 		_recordedRomTest.reset(new RecordedRomTest(_emu.get(), false));
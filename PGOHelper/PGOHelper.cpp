@@ -15,6 +15,12 @@ using std::vector;
 
 extern "C" {
 	void __stdcall PgoRunTest(vector<string> testRoms, bool enableDebugger);
+	void __stdcall PgoRunBenchmark(vector<string> testRoms, uint32_t durationMs);
+	void __stdcall PgoRunCpuBenchmark(uint32_t durationMs);
+	void __stdcall PgoRunRollbackTest(vector<string> testRoms, uint32_t latencyMs, uint32_t jitterMs, uint32_t durationMs);
+	void __stdcall PgoRunNetplayBenchmark(vector<string> testRoms, uint32_t clientCount, uint32_t durationMs);
+	void __stdcall PgoRunStateHashBenchmark(vector<string> testRoms, uint32_t durationMs);
+	void __stdcall PgoRunSpcThreadTest(vector<string> testRoms, uint32_t durationMs);
 }
 
 vector<string> GetFilesInFolder(string rootFolder, std::unordered_set<string> extensions)
@@ -43,12 +49,53 @@ vector<string> GetFilesInFolder(string rootFolder, std::unordered_set<string> ex
 int main(int argc, char* argv[])
 {
 	string romFolder = "../PGOGames";
-	if(argc >= 2) {
-		romFolder = argv[1];
+	bool benchmark = false;
+	bool rollbackTest = false;
+	bool netplayBenchmark = false;
+	bool hashBenchmark = false;
+	bool spcThreadTest = false;
+	for(int i = 1; i < argc; i++) {
+		if(string(argv[i]) == "--benchmark") {
+			//Prints the emulation speed of each rom, with and without the debugger
+			benchmark = true;
+		} else if(string(argv[i]) == "--cpubench") {
+			//Prints the number of instructions executed per second by each cpu core, using generated test roms
+			PgoRunCpuBenchmark(5000);
+			return 0;
+		} else if(string(argv[i]) == "--rollbacktest") {
+			//Runs each rom as a rollback netplay client (100ms latency, 30ms jitter) and prints rollback statistics
+			rollbackTest = true;
+		} else if(string(argv[i]) == "--netplaybench") {
+			//Hosts each rom with 1, 8 and 32 local spectators and prints the delay between the host's frames and the reception of their input
+			netplayBenchmark = true;
+		} else if(string(argv[i]) == "--hashbench") {
+			//Prints the cost of the netplay desync detection's state hashing, relative to the emulation time per frame
+			hashBenchmark = true;
+		} else if(string(argv[i]) == "--spcthreadtest") {
+			//Checks that running the SPC on its own thread (and starting the debugger while it runs) gives the same results as running it in lockstep
+			//Uses a generated test rom along with the SNES roms in the folder, and prints the emulation speed with and without the SPC thread
+			spcThreadTest = true;
+		} else {
+			romFolder = argv[i];
+		}
 	}
 
 	vector<string> testRoms = GetFilesInFolder(romFolder, { ".sfc", ".gb", ".gbc", ".gbx", ".nes", ".pce", ".cue", ".sms", ".gg", ".sg", ".gba", ".col", ".ws", ".wsc" });
-	PgoRunTest(testRoms, true);
+	if(benchmark) {
+		PgoRunBenchmark(testRoms, 5000);
+	} else if(rollbackTest) {
+		PgoRunRollbackTest(testRoms, 100, 30, 10000);
+	} else if(netplayBenchmark) {
+		for(uint32_t clientCount : { 1, 8, 32 }) {
+			PgoRunNetplayBenchmark(testRoms, clientCount, 5000);
+		}
+	} else if(hashBenchmark) {
+		PgoRunStateHashBenchmark(testRoms, 3000);
+	} else if(spcThreadTest) {
+		PgoRunSpcThreadTest(testRoms, 3000);
+	} else {
+		PgoRunTest(testRoms, true);
+	}
 	return 0;
 }
 
@@ -53,6 +53,7 @@ namespace Mesen.Config
 				ShowMemoryValues = Debugger.ShowMemoryValues,
 
 				AutoResetCdl = Debugger.AutoResetCdl,
+				DisableCdlLogging = Debugger.DisableCdlLogging,
 
 				UsePredictiveBreakpoints = Debugger.UsePredictiveBreakpoints,
 				SingleBreakpointPerInstruction = Debugger.SingleBreakpointPerInstruction,
@@ -125,6 +126,7 @@ namespace Mesen.Config
 		[MarshalAs(UnmanagedType.I1)] public bool ShowMemoryValues;
 
 		[MarshalAs(UnmanagedType.I1)] public bool AutoResetCdl;
+		[MarshalAs(UnmanagedType.I1)] public bool DisableCdlLogging;
 
 		[MarshalAs(UnmanagedType.I1)] public bool UsePredictiveBreakpoints;
 		[MarshalAs(UnmanagedType.I1)] public bool SingleBreakpointPerInstruction;
@@ -39,6 +39,7 @@ namespace Mesen.Config
 		[Reactive] public bool BreakOnPowerCycleReset { get; set; } = true;
 
 		[Reactive] public bool AutoResetCdl { get; set; } = true;
+		[Reactive] public bool DisableCdlLogging { get; set; } = false;
 		[Reactive] public bool DisableDefaultLabels { get; set; } = false;
 
 		[Reactive] public bool UsePredictiveBreakpoints { get; set; } = true;
@@ -52,6 +52,9 @@ namespace Mesen.Config
 		[Reactive] public bool EnableAutoSaveState { get; set; } = true;
 		[Reactive] public UInt32 AutoSaveStateDelay { get; set; } = 5;
 
+		[Reactive] public bool EnableBatteryFlush { get; set; } = true;
+		[Reactive] public UInt32 BatteryFlushDelay { get; set; } = 10;
+
 		[Reactive] public bool EnableRewind { get; set; } = true;
 		[Reactive] public UInt32 RewindBufferSize { get; set; } = 300;
 
@@ -248,7 +251,8 @@ namespace Mesen.Config
 				SaveStateFolderOverride = OverrideSaveStateFolder ? SaveStateFolder : "",
 				ScreenshotFolderOverride = OverrideScreenshotFolder ? ScreenshotFolder : "",
 				RewindBufferSize = EnableRewind ? RewindBufferSize : 0,
-				AutoSaveStateDelay = EnableAutoSaveState ? AutoSaveStateDelay : 0
+				AutoSaveStateDelay = EnableAutoSaveState ? AutoSaveStateDelay : 0,
+				BatteryFlushDelay = EnableBatteryFlush ? BatteryFlushDelay : 0
 			});
 		}
 	}
@@ -297,6 +301,7 @@ namespace Mesen.Config
 
 		public UInt32 AutoSaveStateDelay;
 		public UInt32 RewindBufferSize;
+		public UInt32 BatteryFlushDelay;
 
 		public string SaveFolderOverride;
 		public string SaveStateFolderOverride;
@@ -58,6 +58,7 @@ namespace Mesen.Config
 		//Emulation
 		[Reactive] public bool EnableRandomPowerOnState { get; set; } = false;
 		[Reactive] public bool EnableStrictBoardMappings { get; set; } = false;
+		[Reactive] public bool RunSpcOnSeparateThread { get; set; } = false;
 		[Reactive] public RamState RamPowerOnState { get; set; } = RamState.Random;
 		[Reactive] [MinMax(-999, 999)] public Int32 SpcClockSpeedAdjustment { get; set; } = 40;
 
@@ -117,6 +118,7 @@ namespace Mesen.Config
 
 				EnableRandomPowerOnState = this.EnableRandomPowerOnState,
 				EnableStrictBoardMappings = this.EnableStrictBoardMappings,
+				RunSpcOnSeparateThread = this.RunSpcOnSeparateThread,
 				PpuExtraScanlinesBeforeNmi = this.PpuExtraScanlinesBeforeNmi,
 				PpuExtraScanlinesAfterNmi = this.PpuExtraScanlinesAfterNmi,
 				GsuClockSpeed = this.GsuClockSpeed,
@@ -174,6 +176,7 @@ namespace Mesen.Config
 
 		[MarshalAs(UnmanagedType.I1)] public bool EnableRandomPowerOnState;
 		[MarshalAs(UnmanagedType.I1)] public bool EnableStrictBoardMappings;
+		[MarshalAs(UnmanagedType.I1)] public bool RunSpcOnSeparateThread;
 		public RamState RamPowerOnState;
 		public Int32 SpcClockSpeedAdjustment;
 
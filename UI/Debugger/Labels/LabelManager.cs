@@ -75,6 +75,7 @@ namespace Mesen.Debugger.Labels
 		public static void SetLabels(IEnumerable<CodeLabel> labels, bool raiseEvents = true)
 		{
 			Dictionary<MemoryType, bool> isAvailable = new();
+			List<CodeLabel> addedLabels = new();
 
 			foreach(CodeLabel label in labels) {
 				//Check if label memory type is valid before adding it to the list
@@ -84,9 +85,21 @@ namespace Mesen.Debugger.Labels
 				}
 
 				if(available) {
-					SetLabel(label, false);
+					SetLabel(label, false, false);
+					addedLabels.Add(label);
 				}
 			}
+
+			//Send all the labels to the core in a single call (labels replaced by another label in the same batch are skipped)
+			InteropCodeLabel[] interopLabels = addedLabels.Where(lbl => _labels.Contains(lbl)).Select(lbl => new InteropCodeLabel() {
+				Address = lbl.Address,
+				MemoryType = lbl.MemoryType,
+				Length = lbl.Length,
+				Label = lbl.Label,
+				Comment = lbl.Comment.Replace(Environment.NewLine, "\n")
+			}).ToArray();
+			DebugApi.SetLabels(interopLabels, (UInt32)interopLabels.Length);
+
 			if(raiseEvents) {
 				ProcessLabelUpdate();
 			}
@@ -117,7 +130,7 @@ namespace Mesen.Debugger.Labels
 			}, false);
 		}
 
-		public static bool SetLabel(CodeLabel label, bool raiseEvent)
+		public static bool SetLabel(CodeLabel label, bool raiseEvent, bool updateCore = true)
 		{
 			if(_reverseLookup.ContainsKey(label.Label)) {
 				//Another identical label exists, we need to remove it
@@ -135,6 +148,10 @@ namespace Mesen.Debugger.Labels
 
 				_labelsByKey[key] = label;
 
+				if(!updateCore) {
+					continue;
+				}
+
 				if(label.Length == 1) {
 					DebugApi.SetLabel(i, label.MemoryType, label.Label, comment.Replace(Environment.NewLine, "\n"));
 				} else {
@@ -221,6 +221,7 @@ namespace Mesen.Interop
 		[DllImport(DllPath)] public static extern AddressInfo GetRelativeAddress(AddressInfo absAddress, CpuType cpuType);
 
 		[DllImport(DllPath)] public static extern void SetLabel(uint address, MemoryType memType, [MarshalAs(UnmanagedType.LPUTF8Str)] string label, [MarshalAs(UnmanagedType.LPUTF8Str)] string comment);
+		[DllImport(DllPath)] public static extern void SetLabels([MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)] InteropCodeLabel[] labels, UInt32 count);
 		[DllImport(DllPath)] public static extern void ClearLabels();
 
 		[DllImport(DllPath)] public static extern void SetBreakpoints([MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)] InteropBreakpoint[] breakpoints, UInt32 length);
@@ -449,6 +450,11 @@ namespace Mesen.Interop
 			return (int)functionCount;
 		}
 
+		[DllImport(DllPath)] public static extern void SetSamplingProfilerOptions(CpuType type, InteropSamplingProfilerOptions options);
+		[DllImport(DllPath)] public static extern void ResetSamplingProfiler(CpuType type);
+		[DllImport(DllPath)] public static extern UInt64 GetSamplingProfilerSampleCount(CpuType type);
+		[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool ExportSamplingProfilerData(CpuType type, [MarshalAs(UnmanagedType.LPUTF8Str)] string filename);
+
 		[DllImport(DllPath, EntryPoint = "GetTokenList")] private static extern void GetTokenListWrapper(CpuType cpuType, IntPtr tokenListBuffer);
 		public static unsafe string[] GetTokenList(CpuType type)
 		{
@@ -467,6 +473,9 @@ namespace Mesen.Interop
 		}
 
 		[DllImport(DllPath)] public static extern void ResetMemoryAccessCounts();
+		[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool StartMemoryAccessHeatmapCapture([MarshalAs(UnmanagedType.LPUTF8Str)] string filename, UInt32 frameCount);
+		[DllImport(DllPath)] public static extern void StopMemoryAccessHeatmapCapture();
+		[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool IsMemoryAccessHeatmapCaptureRunning();
 		public static unsafe void GetMemoryAccessCounts(MemoryType type, ref AddressCounters[] counts)
 		{
 			int size = DebugApi.GetMemorySize(type);
@@ -1439,6 +1448,23 @@ namespace Mesen.Interop
 		public byte[] Format;
 	}
 
+	public struct InteropCodeLabel
+	{
+		public UInt32 Address;
+		public MemoryType MemoryType;
+		public UInt32 Length;
+		[MarshalAs(UnmanagedType.LPUTF8Str)] public string Label;
+		[MarshalAs(UnmanagedType.LPUTF8Str)] public string Comment;
+	}
+
+	public struct InteropSamplingProfilerOptions
+	{
+		[MarshalAs(UnmanagedType.I1)] public bool Enabled;
+		[MarshalAs(UnmanagedType.I1)] public bool IncludeProgramCounter;
+		public UInt32 SampleInterval;
+		public UInt32 StackDepth;
+	}
+
 	public enum VectorType
 	{
 		Indirect,
@@ -99,10 +99,13 @@ namespace Mesen.Interop
 
 		[DllImport(DllPath)] public static extern IntPtr GetArchiveRomList([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, IntPtr outFileList, Int32 maxLength);
 
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool CompressDiscImage([MarshalAs(UnmanagedType.LPUTF8Str)]string cueFile, [MarshalAs(UnmanagedType.LPUTF8Str)]string outputFile);
+
 		[DllImport(DllPath)] public static extern void SaveState(UInt32 stateIndex);
 		[DllImport(DllPath)] public static extern void LoadState(UInt32 stateIndex);
 		[DllImport(DllPath)] public static extern void SaveStateFile([MarshalAs(UnmanagedType.LPUTF8Str)]string filepath);
 		[DllImport(DllPath)] public static extern void LoadStateFile([MarshalAs(UnmanagedType.LPUTF8Str)]string filepath);
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool HasPendingSaveStateWrites();
 
 		[DllImport(DllPath, EntryPoint = "GetSaveStatePreview")] private static extern Int32 GetSaveStatePreviewWrapper([MarshalAs(UnmanagedType.LPUTF8Str)]string saveStatePath, [Out]byte[] imgData);
 		public static Bitmap? GetSaveStatePreview(string saveStatePath)
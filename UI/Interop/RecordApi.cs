@@ -25,6 +25,8 @@ namespace Mesen.Interop
 		[DllImport(DllPath)] public static extern void MovieStop();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MoviePlaying();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MovieRecording();
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MovieSeek(UInt32 frame);
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MovieConvert([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, [MarshalAs(UnmanagedType.LPUTF8Str)]string outputFilename);
 	}
 
 	public enum RecordMovieFrom
@@ -4,6 +4,7 @@ using System.Linq;
 using System.Runtime.InteropServices;
 using System.Text;
 using System.Threading.Tasks;
+using Mesen.Utilities;
 
 namespace Mesen.Interop
 {
@@ -13,6 +14,11 @@ namespace Mesen.Interop
 
 		[DllImport(DllPath)] public static extern RomTestResult RunRecordedTest([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, [MarshalAs(UnmanagedType.I1)]bool inBackground);
 		[DllImport(DllPath)] public static extern UInt64 RunTest([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, int address, MemoryType memType);
+		[DllImport(DllPath, EntryPoint = "VerifyMovie")] private static extern void VerifyMovieWrapper([MarshalAs(UnmanagedType.LPUTF8Str)]string romFile, [MarshalAs(UnmanagedType.LPUTF8Str)]string movieFile, UInt32 timeoutSeconds, IntPtr outJson, Int32 maxLength);
+		public static string VerifyMovie(string romFile, string movieFile, UInt32 timeoutSeconds) { return Utf8Utilities.CallStringApi((IntPtr outJson, Int32 maxLength) => {
+			VerifyMovieWrapper(romFile, movieFile, timeoutSeconds, outJson, maxLength);
+		}, 10000000); }
+
 		[DllImport(DllPath)] public static extern void RomTestRecord([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, [MarshalAs(UnmanagedType.I1)]bool reset);
 		[DllImport(DllPath)] public static extern void RomTestStop();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool RomTestRecording();
@@ -75,6 +75,14 @@ namespace Mesen
 				return TestRunner.Run(args);
 			}
 
+			if(CommandLineHelper.IsCompressDisc(args)) {
+				return DiscCompressor.Run(args);
+			}
+
+			if(CommandLineHelper.IsVerifyMovie(args)) {
+				return MovieVerifier.Run(args);
+			}
+
 			using SingleInstance instance = SingleInstance.Instance;
 			instance.Init(args);
 			if(instance.FirstInstance) {
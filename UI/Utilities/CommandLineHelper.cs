@@ -128,6 +128,16 @@ public class CommandLineHelper
 		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant() == "testrunner");
 	}
 
+	public static bool IsCompressDisc(string[] args)
+	{
+		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant() == "compressdisc");
+	}
+
+	public static bool IsVerifyMovie(string[] args)
+	{
+		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant() == "verifymovie");
+	}
+
 	public void ProcessPostLoadCommandSwitches(MainWindow wnd)
 	{
 		if(LuaScriptsToLoad.Count > 0) {
@@ -187,6 +197,8 @@ public class CommandLineHelper
 --loadLastSession - Resumes the game in the state it was left in when it was last played.
 --recordMovie=""filename.mmo"" - Start recording a movie after the specified game is loaded.
 --testRunner [lua script] [rom file] - Runs a Lua script in headless mode (use emu.exit(...) to stop execution)
+--compressDisc [cue file] - Converts a CD image (.cue/.bin) to a compressed .cdz image, in the same folder
+--verifyMovie [rom file] [movie files] - Plays the movies at maximum speed without video/audio output, and writes the results (memory hashes) to stdout as JSON, one line per movie (use --jobs=N to set the number of movies played in parallel, and --timeout=N to set the timeout in seconds for each movie)
 ";
 
 		result["General"] = general;
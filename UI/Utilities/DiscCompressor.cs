@@ -0,0 +1,29 @@
+﻿using Mesen.Interop;
+using System;
+using System.IO;
+using System.Linq;
+
+namespace Mesen.Utilities
+{
+	internal class DiscCompressor
+	{
+		internal static int Run(string[] args)
+		{
+			//Relative paths are relative to the folder the process was started from (like in CommandLineHelper)
+			string? cueFile = args
+				.Select(arg => Path.GetFullPath(arg, Program.OriginalFolder))
+				.FirstOrDefault(path => Path.GetExtension(path).ToLowerInvariant() == ".cue" && File.Exists(path));
+
+			if(cueFile == null) {
+				//No cue file specified
+				Console.WriteLine("Error: no .cue file found in the command line arguments");
+				return -1;
+			}
+
+			string outputFile = Path.ChangeExtension(cueFile, ".cdz");
+			bool result = EmuApi.CompressDiscImage(cueFile, outputFile);
+			Console.WriteLine(EmuApi.GetLog());
+			return result ? 0 : -1;
+		}
+	}
+}
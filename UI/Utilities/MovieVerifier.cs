@@ -0,0 +1,95 @@
+﻿using Mesen.Config;
+using Mesen.Interop;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
+
+namespace Mesen.Utilities
+{
+	internal class MovieVerifier
+	{
+		internal static int Run(string[] args)
+		{
+			ConfigManager.DisableSaveSettings = true;
+
+			int jobs = Environment.ProcessorCount;
+			uint timeout = 0;
+			string? romFile = null;
+			List<string> movieFiles = new();
+			foreach(string arg in args) {
+				string lowerArg = arg.ToLowerInvariant();
+				if(lowerArg.StartsWith("--jobs=") && int.TryParse(arg.Substring(7), out int jobCount) && jobCount > 0) {
+					jobs = jobCount;
+				} else if(lowerArg.StartsWith("--timeout=") && uint.TryParse(arg.Substring(10), out uint seconds)) {
+					timeout = seconds;
+				} else {
+					//Relative paths are relative to the folder the process was started from (like in CommandLineHelper)
+					string absPath = Path.GetFullPath(arg, Program.OriginalFolder);
+					if(File.Exists(absPath)) {
+						string ext = Path.GetExtension(absPath).ToLowerInvariant();
+						if(ext == "." + FileDialogHelper.MesenMovieExt || ext == ".mmb") {
+							movieFiles.Add(absPath);
+						} else {
+							romFile = absPath;
+						}
+					}
+				}
+			}
+
+			if(romFile == null || movieFiles.Count == 0) {
+				//No rom or movie specified
+				Console.WriteLine("Error: " + (romFile == null ? "no ROM file found" : "no movie file found") + " in the command line arguments");
+				return -1;
+			}
+
+			if(movieFiles.Count == 1) {
+				return VerifyMovie(romFile, movieFiles[0], timeout) ? 0 : -1;
+			}
+
+			//Play each movie in a separate process (an emulator instance can only play one movie at a time)
+			bool allCompleted = true;
+			object outputLock = new();
+			Parallel.ForEach(movieFiles, new ParallelOptions() { MaxDegreeOfParallelism = jobs }, (movieFile) => {
+				ProcessStartInfo startInfo = new(Program.ExePath) {
+					UseShellExecute = false,
+					RedirectStandardOutput = true
+				};
+				startInfo.ArgumentList.Add("--verifyMovie");
+				startInfo.ArgumentList.Add("--timeout=" + timeout);
+				startInfo.ArgumentList.Add(romFile);
+				startInfo.ArgumentList.Add(movieFile);
+
+				using Process? process = Process.Start(startInfo);
+				string output = process?.StandardOutput.ReadToEnd().Trim() ?? "";
+				process?.WaitForExit();
+
+				lock(outputLock) {
+					if(process == null || process.ExitCode != 0) {
+						allCompleted = false;
+					}
+					if(!string.IsNullOrWhiteSpace(output)) {
+						Console.WriteLine(output);
+					}
+				}
+			});
+
+			return allCompleted ? 0 : -1;
+		}
+
+		private static bool VerifyMovie(string romFile, string movieFile, uint timeout)
+		{
+			EmuApi.InitDll();
+			ConfigManager.Config.ApplyConfig();
+			EmuApi.InitializeEmu(ConfigManager.HomeFolder, IntPtr.Zero, IntPtr.Zero, true, true, true, true);
+
+			string result = TestApi.VerifyMovie(romFile, movieFile, timeout);
+			Console.WriteLine(result);
+
+			EmuApi.Release();
+			return result.Contains("\"result\":\"completed\"");
+		}
+	}
+}
@@ -34,7 +34,7 @@ namespace Mesen.Windows
 			Close(true);
 
 			Task.Run(() => {
-				NetplayApi.Connect(cfg.Host, cfg.Port, cfg.Password, false);
+				NetplayApi.Connect(cfg.Host, cfg.Port, cfg.Password, false, cfg.UseRollback);
 			});
 		}
 
@@ -6,6 +6,7 @@
 #include "FolderUtilities.h"
 #include "ZipReader.h"
 #include "SZReader.h"
+#include "RomMetadataCache.h"
 
 ArchiveReader::~ArchiveReader()
 {
@@ -25,15 +26,20 @@ bool ArchiveReader::GetStream(string filename, std::stringstream &stream)
 }
 
 vector<string> ArchiveReader::GetFileList(std::initializer_list<string> extensions)
+{
+	return FilterFileList(InternalGetFileList(), extensions);
+}
+
+vector<string> ArchiveReader::FilterFileList(vector<string> files, std::initializer_list<string> extensions)
 {
 	if(extensions.size() == 0) {
-		return InternalGetFileList();
+		return files;
 	}
 
 	std::unordered_set<string> extMap(extensions);
 
 	vector<string> filenames;
-	for(string filename : InternalGetFileList()) {
+	for(string filename : files) {
 		string lcFilename = filename;
 		std::transform(lcFilename.begin(), lcFilename.end(), lcFilename.begin(), ::tolower);
 	
@@ -115,4 +121,18 @@ unique_ptr<ArchiveReader> ArchiveReader::GetReader(string filepath)
 		return GetReader(in);
 	}
 	return nullptr;
+}
+
+vector<string> ArchiveReader::GetCachedFileList(string filepath, std::initializer_list<string> extensions)
+{
+	vector<string> files;
+	if(!RomMetadataCache::GetFileList(filepath, files)) {
+		unique_ptr<ArchiveReader> reader = GetReader(filepath);
+		if(!reader) {
+			return {};
+		}
+		files = reader->InternalGetFileList();
+		RomMetadataCache::SetFileList(filepath, files);
+	}
+	return FilterFileList(files, extensions);
 }
\ No newline at end of file
@@ -8,6 +8,8 @@ protected:
 	uint8_t* _buffer = nullptr;
 	virtual bool InternalLoadArchive(void* buffer, size_t size) = 0;
 	virtual vector<string> InternalGetFileList() = 0;
+
+	static vector<string> FilterFileList(vector<string> files, std::initializer_list<string> extensions);
 public:
 	virtual ~ArchiveReader();
 
@@ -25,4 +27,7 @@ public:
 
 	static unique_ptr<ArchiveReader> GetReader(std::istream &in);
 	static unique_ptr<ArchiveReader> GetReader(string filepath);
+
+	//Returns the archive's file list without opening the archive, when it's available in RomMetadataCache
+	static vector<string> GetCachedFileList(string filepath, std::initializer_list<string> extensions = {});
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "pch.h"
+#include "AsyncFileWriter.h"
+#include "FolderUtilities.h"
+
+AsyncFileWriter::AsyncFileWriter()
+{
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+	Flush();
+
+	if(_thread) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_stopFlag = true;
+			_signal.notify_all();
+		}
+		_thread->join();
+		_thread.reset();
+	}
+}
+
+void AsyncFileWriter::Write(string filepath, WriteCallback write, DoneCallback done)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	for(auto it = _queue.rbegin(); it != _queue.rend(); it++) {
+		if(it->Filepath == filepath) {
+			if(it->UseTempFile) {
+				//The previous request was never started, its file would be overwritten anyway
+				it->Write = write;
+				it->Done = done;
+				return;
+			}
+			break;
+		}
+	}
+
+	Queue({ filepath, write, done, true });
+}
+
+void AsyncFileWriter::Update(string filepath, WriteCallback write, DoneCallback done)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	Queue({ filepath, write, done, false });
+}
+
+void AsyncFileWriter::Queue(WriteRequest&& request)
+{
+	//Called with the mutex held
+	_queue.push_back(std::move(request));
+
+	if(!_thread) {
+		_thread.reset(new std::thread(&AsyncFileWriter::ThreadLoop, this));
+	}
+	_signal.notify_all();
+}
+
+bool AsyncFileWriter::HasPendingWrites()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	return _writing || !_queue.empty();
+}
+
+void AsyncFileWriter::Flush()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_idleSignal.wait(lock, [this] { return !_writing && _queue.empty(); });
+}
+
+void AsyncFileWriter::ThreadLoop()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while(true) {
+		_signal.wait(lock, [this] { return _stopFlag || !_queue.empty(); });
+		if(_queue.empty()) {
+			//Only stop once everything has been written
+			break;
+		}
+
+		WriteRequest request = std::move(_queue.front());
+		_queue.pop_front();
+		_writing = true;
+		lock.unlock();
+
+		bool success;
+		if(request.UseTempFile) {
+			string tmpPath = request.Filepath + ".tmp";
+			success = request.Write(tmpPath) && FolderUtilities::RenameFile(tmpPath, request.Filepath);
+			if(!success) {
+				FolderUtilities::RemoveFile(tmpPath);
+			}
+		} else {
+			success = request.Write(request.Filepath);
+		}
+
+		if(request.Done) {
+			request.Done(success);
+		}
+
+		lock.lock();
+		_writing = false;
+		if(_queue.empty()) {
+			_idleSignal.notify_all();
+		}
+	}
+}
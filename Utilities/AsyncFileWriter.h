@@ -0,0 +1,54 @@
+#pragma once
+#include "pch.h"
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+//Writes files on a background thread (compression, encoding and file I/O are all done by the callback)
+//Each file is written to a temporary file first and then renamed, so a crash can't leave a partially written file behind
+class AsyncFileWriter
+{
+public:
+	//Writes the file's content to the given temporary path, returns false on failure
+	typedef std::function<bool(const string& tmpPath)> WriteCallback;
+	//Called on the writer thread once the file has been written (must not call Flush)
+	typedef std::function<void(bool success)> DoneCallback;
+
+private:
+	struct WriteRequest
+	{
+		string Filepath;
+		WriteCallback Write;
+		DoneCallback Done;
+		bool UseTempFile;
+	};
+
+	std::deque<WriteRequest> _queue;
+	std::mutex _mutex;
+	std::condition_variable _signal;
+	std::condition_variable _idleSignal;
+	bool _writing = false;
+	bool _stopFlag = false;
+	unique_ptr<std::thread> _thread;
+
+	void ThreadLoop();
+	void Queue(WriteRequest&& request);
+
+public:
+	AsyncFileWriter();
+	~AsyncFileWriter();
+
+	//A pending write to the same file is replaced by the new one (e.g when saving to the same slot repeatedly)
+	void Write(string filepath, WriteCallback write, DoneCallback done = nullptr);
+
+	//Calls the callback with the file's actual path (no temporary file), e.g to append data to the file
+	//These requests are never merged with other requests, and run in the same order as all other requests
+	void Update(string filepath, WriteCallback write, DoneCallback done = nullptr);
+
+	bool HasPendingWrites();
+
+	//Blocks until all queued writes have been completed
+	void Flush();
+};
@@ -4,6 +4,8 @@
 #include "pch.h"
 
 #include "CRC32.h"
+#include <algorithm>
+#include <thread>
 
 const size_t MaxSlice = 16;
 extern const uint32_t Crc32Lookup[MaxSlice][256];
@@ -37,12 +39,12 @@ extern const uint32_t Crc32Lookup[MaxSlice][256];
 
 uint32_t CRC32::GetCRC(uint8_t* buffer, std::streamoff length)
 {
-	return crc32_16bytes(buffer, length, 0);
+	return crc32_parallel(buffer, (size_t)length);
 }
 
 uint32_t CRC32::GetCRC(vector<uint8_t>& data)
 {
-	return crc32_16bytes(data.data(), (std::streamoff)data.size(), 0);
+	return crc32_parallel(data.data(), data.size());
 }
 
 uint32_t CRC32::GetCRC(string filename)
@@ -60,13 +62,102 @@ uint32_t CRC32::GetCRC(string filename)
 		file.read((char*)buffer, fileSize);
 		file.close();
 
-		crc = crc32_16bytes(buffer, fileSize, 0);
+		crc = crc32_parallel(buffer, (size_t)fileSize);
 
 		delete[] buffer;
 	}
 	return crc;
 }
 
+uint32_t CRC32::crc32_parallel(const uint8_t* data, size_t length)
+{
+	if(length < CRC32::ParallelMinSize) {
+		return crc32_16bytes(data, length, 0);
+	}
+
+	uint32_t threadCount = std::min<uint32_t>(std::thread::hardware_concurrency(), CRC32::MaxThreads);
+	threadCount = (uint32_t)std::min<size_t>(threadCount, length / CRC32::MinChunkSize);
+	if(threadCount < 2) {
+		return crc32_16bytes(data, length, 0);
+	}
+
+	//Calculate the CRC of each chunk separately, and then combine them (the result is identical to the CRC of the whole buffer)
+	size_t chunkSize = (length / threadCount) & ~(size_t)0x3F;
+	vector<uint32_t> chunkCrc(threadCount);
+	vector<std::thread> threads;
+	for(uint32_t i = 1; i < threadCount; i++) {
+		size_t chunkLength = i == threadCount - 1 ? length - chunkSize * i : chunkSize;
+		threads.emplace_back([=, &chunkCrc]() {
+			chunkCrc[i] = crc32_16bytes(data + chunkSize * i, chunkLength, 0);
+		});
+	}
+	chunkCrc[0] = crc32_16bytes(data, chunkSize, 0);
+
+	uint32_t crc = chunkCrc[0];
+	for(uint32_t i = 1; i < threadCount; i++) {
+		threads[i - 1].join();
+		size_t chunkLength = i == threadCount - 1 ? length - chunkSize * i : chunkSize;
+		crc = crc32_combine(crc, chunkCrc[i], chunkLength);
+	}
+	return crc;
+}
+
+//zlib's crc32_combine: computes crc32(A+B) based on crc32(A), crc32(B) and length(B)
+uint32_t CRC32::crc32_combine(uint32_t crcA, uint32_t crcB, size_t lengthB)
+{
+	auto gf2MatrixTimes = [](const uint32_t* matrix, uint32_t vec) {
+		uint32_t sum = 0;
+		for(; vec; vec >>= 1, matrix++) {
+			if(vec & 1) {
+				sum ^= *matrix;
+			}
+		}
+		return sum;
+	};
+
+	auto gf2MatrixSquare = [&](uint32_t* square, const uint32_t* matrix) {
+		for(int n = 0; n < 32; n++) {
+			square[n] = gf2MatrixTimes(matrix, matrix[n]);
+		}
+	};
+
+	if(lengthB == 0) {
+		return crcA;
+	}
+
+	uint32_t even[32]; // even-power-of-two zeros operator
+	uint32_t odd[32];  // odd-power-of-two zeros operator
+
+	// put operator for one zero bit in odd
+	odd[0] = 0xEDB88320; // CRC-32 polynomial
+	for(int n = 1; n < 32; n++) {
+		odd[n] = 1u << (n - 1);
+	}
+
+	gf2MatrixSquare(even, odd); // put operator for two zero bits in even
+	gf2MatrixSquare(odd, even); // put operator for four zero bits in odd
+
+	// apply lengthB zeros to crcA (first square will put the operator for one zero byte, eight zero bits, in even)
+	do {
+		gf2MatrixSquare(even, odd);
+		if(lengthB & 1) {
+			crcA = gf2MatrixTimes(even, crcA);
+		}
+		lengthB >>= 1;
+		if(lengthB == 0) {
+			break;
+		}
+
+		gf2MatrixSquare(odd, even);
+		if(lengthB & 1) {
+			crcA = gf2MatrixTimes(odd, crcA);
+		}
+		lengthB >>= 1;
+	} while(lengthB != 0);
+
+	return crcA ^ crcB;
+}
+
 uint32_t CRC32::crc32_16bytes(const void* data, size_t length, uint32_t previousCrc32)
 {
 	uint32_t crc = ~previousCrc32; // same as previousCrc32 ^ 0xFFFFFFFF
@@ -4,7 +4,14 @@
 class CRC32
 {
 private:
+	//Buffers larger than this are split into chunks that are processed in parallel
+	static constexpr size_t ParallelMinSize = 4 * 1024 * 1024;
+	static constexpr size_t MinChunkSize = 1024 * 1024;
+	static constexpr uint32_t MaxThreads = 8;
+
 	static uint32_t crc32_16bytes(const void* data, size_t length, uint32_t previousCrc32);
+	static uint32_t crc32_parallel(const uint8_t* data, size_t length);
+	static uint32_t crc32_combine(uint32_t crcA, uint32_t crcB, size_t lengthB);
 
 public:
 	static uint32_t GetCRC(uint8_t* buffer, std::streamoff length);
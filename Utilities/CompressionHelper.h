@@ -5,7 +5,7 @@
 class CompressionHelper
 {
 public:
-	static void Compress(string data, int compressionLevel, vector<uint8_t>& output)
+	static void Compress(const string& data, int compressionLevel, vector<uint8_t>& output)
 	{
 		unsigned long compressedSize = compressBound((unsigned long)data.size());
 		uint8_t* compressedData = new uint8_t[compressedSize];
@@ -19,7 +19,7 @@ public:
 		delete[] compressedData;
 	}
 
-	static bool Decompress(vector<uint8_t>& input, vector<uint8_t>& output)
+	static bool Decompress(const vector<uint8_t>& input, vector<uint8_t>& output)
 	{
 		uint32_t decompressedSize;
 		uint32_t compressedSize;
@@ -0,0 +1,88 @@
+#include "pch.h"
+#include "MemoryMappedFile.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFile::MemoryMappedFile(const string& path)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileW(utf8::utf8::decode(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(file == INVALID_HANDLE_VALUE) {
+		return;
+	}
+	_fileHandle = file;
+
+	LARGE_INTEGER fileSize = {};
+	if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0 || (uint64_t)fileSize.QuadPart > SIZE_MAX) {
+		//Empty files can't be mapped
+		Close();
+		return;
+	}
+
+	_mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if(!_mappingHandle) {
+		Close();
+		return;
+	}
+
+	_data = (uint8_t*)MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	if(!_data) {
+		Close();
+		return;
+	}
+	_size = (size_t)fileSize.QuadPart;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return;
+	}
+
+	struct stat fileInfo = {};
+	if(fstat(fd, &fileInfo) == 0 && S_ISREG(fileInfo.st_mode) && fileInfo.st_size > 0) {
+		void* data = mmap(nullptr, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data != MAP_FAILED) {
+			_data = (uint8_t*)data;
+			_size = (size_t)fileInfo.st_size;
+		}
+	}
+
+	//The mapping remains valid after the file descriptor is closed
+	close(fd);
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	Close();
+}
+
+void MemoryMappedFile::Close()
+{
+#ifdef _WIN32
+	if(_data) {
+		UnmapViewOfFile(_data);
+	}
+	if(_mappingHandle) {
+		CloseHandle(_mappingHandle);
+		_mappingHandle = nullptr;
+	}
+	if(_fileHandle) {
+		CloseHandle(_fileHandle);
+		_fileHandle = nullptr;
+	}
+#else
+	if(_data) {
+		munmap(_data, _size);
+	}
+#endif
+
+	_data = nullptr;
+	_size = 0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "pch.h"
+
+//Read-only memory mapping of a file on disk
+//The file stays open (and can't be modified on Windows) for as long as the mapping exists
+class MemoryMappedFile
+{
+private:
+	uint8_t* _data = nullptr;
+	size_t _size = 0;
+
+#ifdef _WIN32
+	void* _fileHandle = nullptr;
+	void* _mappingHandle = nullptr;
+#endif
+
+	void Close();
+
+public:
+	MemoryMappedFile(const string& path);
+	~MemoryMappedFile();
+
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	bool IsValid() { return _data != nullptr; }
+	const uint8_t* GetData() { return _data; }
+	size_t GetSize() { return _size; }
+};
@@ -0,0 +1,396 @@
+#include "pch.h"
+
+#if __has_include(<filesystem>)
+	#include <filesystem>
+	namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+	#include <experimental/filesystem>
+	namespace fs = std::experimental::filesystem;
+#endif
+
+#include "Utilities/RomMetadataCache.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/StringUtilities.h"
+#include "Utilities/HexUtilities.h"
+
+std::mutex RomMetadataCache::_lock;
+std::unordered_map<string, RomMetadataCache::Entry> RomMetadataCache::_entries;
+bool RomMetadataCache::_loaded = false;
+string RomMetadataCache::_cacheFile;
+uint32_t RomMetadataCache::_lineCount = 0;
+uint64_t RomMetadataCache::_readPosition = 0;
+uint64_t RomMetadataCache::_useCounter = 0;
+
+bool RomMetadataCache::GetFileInfo(const string& path, FileInfo& info)
+{
+	std::error_code errorCode;
+	fs::path filePath = fs::u8path(path);
+	uintmax_t size = fs::file_size(filePath, errorCode);
+	if(errorCode) {
+		return false;
+	}
+
+	fs::file_time_type modifiedTime = fs::last_write_time(filePath, errorCode);
+	if(errorCode) {
+		return false;
+	}
+
+	info.Size = (uint64_t)size;
+	info.ModifiedTime = (int64_t)modifiedTime.time_since_epoch().count();
+	return true;
+}
+
+bool RomMetadataCache::IsValidKey(const string& key)
+{
+	//Tabs and line breaks are used as separators in the cache file
+	return !key.empty() && key.find_first_of("\t\r\n") == string::npos;
+}
+
+void RomMetadataCache::LoadCache()
+{
+	_loaded = true;
+
+	try {
+		_cacheFile = FolderUtilities::CombinePath(FolderUtilities::GetHomeFolder(), "RomMetadataCache.txt");
+	} catch(std::exception&) {
+		//No home folder (e.g when used by a tool), only keep the cache in memory
+		_cacheFile.clear();
+		return;
+	}
+
+	ReadNewLines();
+
+	if(_lineCount > _entries.size() * 3 + RomMetadataCache::CompactThreshold || _entries.size() > RomMetadataCache::MaxEntries) {
+		//Most of the file consists of entries that were replaced by newer ones (or the cache is too large), rewrite it
+		SaveCache();
+	}
+}
+
+void RomMetadataCache::ReadNewLines()
+{
+	//Reads the lines added to the file (by this process or others) since the last call
+	ifstream file(_cacheFile, std::ios::in | std::ios::binary);
+	if(!file) {
+		return;
+	}
+
+	file.seekg(0, std::ios::end);
+	uint64_t fileSize = (uint64_t)file.tellg();
+	if(fileSize < _readPosition) {
+		//File was replaced by a smaller one (compacted by another process), read it again
+		_readPosition = 0;
+	}
+	file.seekg(_readPosition, std::ios::beg);
+
+	string line;
+	while(std::getline(file, line)) {
+		if(file.eof()) {
+			//Last line wasn't fully written (no line break at the end), ignore it
+			break;
+		}
+
+		_readPosition += line.size() + 1;
+
+		//Lines that can't be parsed are ignored
+		if(ParseLine(line)) {
+			_lineCount++;
+		}
+	}
+}
+
+bool RomMetadataCache::ParseLine(const string& line)
+{
+	//Format: [field]\t[file size]\t[modification time]\t[key]\t[value]
+	vector<string> tokens = StringUtilities::Split(line, '\t');
+	if(tokens.size() != 5 || tokens[0].size() != 1 || !IsValidKey(tokens[3])) {
+		return false;
+	}
+
+	FileInfo info;
+	try {
+		info.Size = std::stoull(tokens[1]);
+		info.ModifiedTime = std::stoll(tokens[2]);
+	} catch(std::exception&) {
+		return false;
+	}
+
+	Entry& entry = _entries[tokens[3]];
+	if(entry.Info != info) {
+		//File was modified, previous values are no longer valid
+		entry = {};
+		entry.Info = info;
+	}
+	entry.LastUsed = ++_useCounter;
+
+	string& value = tokens[4];
+	switch(tokens[0][0]) {
+		case 'C':
+			if(value.size() != 8) {
+				return false;
+			}
+			try {
+				entry.Crc32 = (uint32_t)std::stoul(value, nullptr, 16);
+				entry.HasCrc32 = true;
+			} catch(std::exception&) {
+				return false;
+			}
+			break;
+
+		case 'S':
+			if(value.size() != 40) {
+				return false;
+			}
+			entry.Sha1 = value;
+			break;
+
+		case 'A':
+			entry.FileList = value.empty() ? vector<string>() : StringUtilities::Split(value, '\x1e');
+			entry.HasFileList = true;
+			break;
+
+		default:
+			return false;
+	}
+	return true;
+}
+
+string RomMetadataCache::GetLine(char field, const string& key, Entry& entry)
+{
+	string value;
+	switch(field) {
+		case 'C': value = HexUtilities::ToHex32(entry.Crc32); break;
+		case 'S': value = entry.Sha1; break;
+		case 'A':
+			for(size_t i = 0; i < entry.FileList.size(); i++) {
+				value += (i > 0 ? "\x1e" : "") + entry.FileList[i];
+			}
+			break;
+	}
+
+	return string(1, field) + "\t" + std::to_string(entry.Info.Size) + "\t" + std::to_string(entry.Info.ModifiedTime) + "\t" + key + "\t" + value + "\n";
+}
+
+void RomMetadataCache::RemoveOldEntries()
+{
+	if(_entries.size() <= RomMetadataCache::MaxEntries) {
+		return;
+	}
+
+	//Keep the most recently used entries
+	vector<uint64_t> lastUsed;
+	lastUsed.reserve(_entries.size());
+	for(auto& [key, entry] : _entries) {
+		lastUsed.push_back(entry.LastUsed);
+	}
+
+	size_t removeCount = _entries.size() - RomMetadataCache::MaxEntries;
+	std::nth_element(lastUsed.begin(), lastUsed.begin() + removeCount, lastUsed.end());
+	uint64_t minLastUsed = lastUsed[removeCount];
+
+	for(auto itr = _entries.begin(); itr != _entries.end();) {
+		if(itr->second.LastUsed < minLastUsed) {
+			itr = _entries.erase(itr);
+		} else {
+			itr++;
+		}
+	}
+}
+
+void RomMetadataCache::SaveCache()
+{
+	if(_cacheFile.empty()) {
+		RemoveOldEntries();
+		return;
+	}
+
+	std::error_code errorCode;
+	fs::path cachePath = fs::u8path(_cacheFile);
+	string tmpFile = _cacheFile + ".tmp";
+
+	//Other processes can append lines to the file at any time - the file's content is read again right before it gets replaced,
+	//and the file is written again if lines were added while it was being written, to avoid dropping them
+	for(int attempt = 0; attempt < 3; attempt++) {
+		ReadNewLines();
+		RemoveOldEntries();
+
+		//Write to a temporary file first, to avoid losing the cache if the process is interrupted
+		ofstream file(tmpFile, std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!file) {
+			return;
+		}
+
+		uint32_t lineCount = 0;
+		for(auto& [key, entry] : _entries) {
+			if(entry.HasCrc32) {
+				file << GetLine('C', key, entry);
+				lineCount++;
+			}
+			if(!entry.Sha1.empty()) {
+				file << GetLine('S', key, entry);
+				lineCount++;
+			}
+			if(entry.HasFileList) {
+				file << GetLine('A', key, entry);
+				lineCount++;
+			}
+		}
+		uint64_t writtenSize = (uint64_t)file.tellp();
+		file.close();
+
+		if(!file) {
+			break;
+		}
+
+		uintmax_t fileSize = fs::file_size(cachePath, errorCode);
+		if(!errorCode && fileSize != _readPosition) {
+			//Lines were added while the temporary file was being written, try again
+			continue;
+		}
+
+		fs::rename(fs::u8path(tmpFile), cachePath, errorCode);
+		if(!errorCode) {
+			_lineCount = lineCount;
+			_readPosition = writtenSize;
+			return;
+		}
+		break;
+	}
+
+	//Keep the existing file
+	fs::remove(fs::u8path(tmpFile), errorCode);
+}
+
+void RomMetadataCache::AppendLine(const string& line)
+{
+	if(_cacheFile.empty()) {
+		return;
+	}
+
+	//Each line is written with a single call, so other processes appending to the same file at the same time
+	//can't interleave their own data in the middle of it
+	ofstream file(_cacheFile, std::ios::out | std::ios::binary | std::ios::app);
+	if(file) {
+		file.write(line.c_str(), line.size());
+		_lineCount++;
+	}
+}
+
+RomMetadataCache::Entry* RomMetadataCache::GetEntry(const string& key, const string& path)
+{
+	if(!_loaded) {
+		LoadCache();
+	}
+
+	auto result = _entries.find(key);
+	if(result == _entries.end()) {
+		return nullptr;
+	}
+
+	FileInfo info;
+	if(!GetFileInfo(path, info) || info != result->second.Info) {
+		return nullptr;
+	}
+	result->second.LastUsed = ++_useCounter;
+	return &result->second;
+}
+
+RomMetadataCache::Entry* RomMetadataCache::AddEntry(const string& key, const string& path)
+{
+	if(!IsValidKey(key)) {
+		return nullptr;
+	}
+
+	if(!_loaded) {
+		LoadCache();
+	}
+
+	FileInfo info;
+	if(!GetFileInfo(path, info)) {
+		return nullptr;
+	}
+
+	if(_entries.size() >= RomMetadataCache::MaxEntries + RomMetadataCache::CompactThreshold && _entries.find(key) == _entries.end()) {
+		//Too many entries, remove the least recently used ones
+		SaveCache();
+	}
+
+	Entry& entry = _entries[key];
+	if(entry.Info != info) {
+		entry = {};
+		entry.Info = info;
+	}
+	entry.LastUsed = ++_useCounter;
+	return &entry;
+}
+
+bool RomMetadataCache::GetCrc32(const string& key, const string& path, uint32_t& crc)
+{
+	std::lock_guard<std::mutex> lock(_lock);
+	Entry* entry = GetEntry(key, path);
+	if(entry && entry->HasCrc32) {
+		crc = entry->Crc32;
+		return true;
+	}
+	return false;
+}
+
+void RomMetadataCache::SetCrc32(const string& key, const string& path, uint32_t crc)
+{
+	std::lock_guard<std::mutex> lock(_lock);
+	Entry* entry = AddEntry(key, path);
+	if(entry) {
+		entry->Crc32 = crc;
+		entry->HasCrc32 = true;
+		AppendLine(GetLine('C', key, *entry));
+	}
+}
+
+bool RomMetadataCache::GetSha1(const string& key, const string& path, string& sha1)
+{
+	std::lock_guard<std::mutex> lock(_lock);
+	Entry* entry = GetEntry(key, path);
+	if(entry && !entry->Sha1.empty()) {
+		sha1 = entry->Sha1;
+		return true;
+	}
+	return false;
+}
+
+void RomMetadataCache::SetSha1(const string& key, const string& path, string sha1)
+{
+	std::lock_guard<std::mutex> lock(_lock);
+	Entry* entry = AddEntry(key, path);
+	if(entry && !sha1.empty()) {
+		entry->Sha1 = sha1;
+		AppendLine(GetLine('S', key, *entry));
+	}
+}
+
+bool RomMetadataCache::GetFileList(const string& archivePath, vector<string>& fileList)
+{
+	std::lock_guard<std::mutex> lock(_lock);
+	Entry* entry = GetEntry(archivePath, archivePath);
+	if(entry && entry->HasFileList) {
+		fileList = entry->FileList;
+		return true;
+	}
+	return false;
+}
+
+void RomMetadataCache::SetFileList(const string& archivePath, vector<string> fileList)
+{
+	for(string& filename : fileList) {
+		if(filename.find_first_of("\t\r\n\x1e") != string::npos) {
+			//Can't be stored in the cache file
+			return;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(_lock);
+	Entry* entry = AddEntry(archivePath, archivePath);
+	if(entry) {
+		entry->FileList = fileList;
+		entry->HasFileList = true;
+		AppendLine(GetLine('A', archivePath, *entry));
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "pch.h"
+#include <mutex>
+#include <unordered_map>
+
+//Persistent cache of the metadata that is computed every time a ROM is loaded (CRC32/SHA1 hashes and the
+//list of files contained in archives), to avoid having to read/decompress/hash the same files every time.
+//Entries are keyed by the file's path (and the file's name inside the archive, for archives) and are only
+//used if the file's size and modification time haven't changed since the entry was added.
+//The cache is stored as a text file in the home folder - new entries are appended to it, and the file is
+//compacted when it contains too many outdated entries. The least recently used entries are removed when
+//the cache contains more than MaxEntries entries.
+class RomMetadataCache
+{
+private:
+	static constexpr uint32_t CompactThreshold = 1000;
+	static constexpr uint32_t MaxEntries = 10000;
+
+	struct FileInfo
+	{
+		uint64_t Size = 0;
+		int64_t ModifiedTime = 0;
+
+		bool operator==(const FileInfo& other) const { return Size == other.Size && ModifiedTime == other.ModifiedTime; }
+		bool operator!=(const FileInfo& other) const { return !(*this == other); }
+	};
+
+	struct Entry
+	{
+		FileInfo Info;
+		bool HasCrc32 = false;
+		uint32_t Crc32 = 0;
+		string Sha1;
+		bool HasFileList = false;
+		vector<string> FileList;
+
+		//Value of _useCounter the last time the entry was read or updated, the entries with the lowest values are removed first
+		//(entries loaded from the file are ordered by the last time they were written to it)
+		uint64_t LastUsed = 0;
+	};
+
+	static std::mutex _lock;
+	static std::unordered_map<string, Entry> _entries;
+	static bool _loaded;
+	static string _cacheFile;
+	static uint32_t _lineCount;
+	static uint64_t _readPosition;
+	static uint64_t _useCounter;
+
+	static bool GetFileInfo(const string& path, FileInfo& info);
+	static bool IsValidKey(const string& key);
+
+	static void LoadCache();
+	static void ReadNewLines();
+	static bool ParseLine(const string& line);
+	static void RemoveOldEntries();
+	static void SaveCache();
+	static void AppendLine(const string& line);
+	static string GetLine(char field, const string& key, Entry& entry);
+
+	static Entry* GetEntry(const string& key, const string& path);
+	static Entry* AddEntry(const string& key, const string& path);
+
+public:
+	//"key" identifies the content (e.g VirtualFile's string representation), "path" is the file on the disk that contains it
+	static bool GetCrc32(const string& key, const string& path, uint32_t& crc);
+	static void SetCrc32(const string& key, const string& path, uint32_t crc);
+
+	static bool GetSha1(const string& key, const string& path, string& sha1);
+	static void SetSha1(const string& key, const string& path, string sha1);
+
+	static bool GetFileList(const string& archivePath, vector<string>& fileList);
+	static void SetFileList(const string& archivePath, vector<string> fileList);
+};
@@ -213,22 +213,38 @@ void Serializer::SaveTo(ostream& file, int compressionLevel)
 		file.put((char)isCompressed);
 
 		if(isCompressed) {
-			unsigned long compressedSize = compressBound((unsigned long)_data.size());
-			uint8_t* compressedData = new uint8_t[compressedSize];
-			compress2(compressedData, &compressedSize, (unsigned char*)_data.data(), (unsigned long)_data.size(), compressionLevel);
-
-			uint32_t size = (uint32_t)compressedSize;
-			uint32_t originalSize = (uint32_t)_data.size();
-			file.write((char*)&originalSize, sizeof(uint32_t));
-			file.write((char*)&size, sizeof(uint32_t));
-			file.write((char*)compressedData, compressedSize);
-			delete[] compressedData;
+			WriteCompressed(file, _data.data(), (uint32_t)_data.size(), compressionLevel);
 		} else {
 			file.write((char*)_data.data(), _data.size());
 		}
 	}
 }
 
+void Serializer::CompressTo(const string& uncompressedData, ostream& file, int compressionLevel)
+{
+	if(uncompressedData.empty() || uncompressedData[0] != 0) {
+		//Already compressed
+		file.write(uncompressedData.data(), uncompressedData.size());
+		return;
+	}
+
+	file.put((char)1);
+	WriteCompressed(file, (const uint8_t*)uncompressedData.data() + 1, (uint32_t)uncompressedData.size() - 1, compressionLevel);
+}
+
+void Serializer::WriteCompressed(ostream& file, const uint8_t* data, uint32_t size, int compressionLevel)
+{
+	unsigned long compressedSize = compressBound((unsigned long)size);
+	uint8_t* compressedData = new uint8_t[compressedSize];
+	compress2(compressedData, &compressedSize, (const unsigned char*)data, (unsigned long)size, compressionLevel);
+
+	uint32_t outSize = (uint32_t)compressedSize;
+	file.write((char*)&size, sizeof(uint32_t));
+	file.write((char*)&outSize, sizeof(uint32_t));
+	file.write((char*)compressedData, compressedSize);
+	delete[] compressedData;
+}
+
 void Serializer::LoadFromMap(unordered_map<string, SerializeMapValue>& map)
 {
 	_mapValues = map;
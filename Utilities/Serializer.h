@@ -455,6 +455,12 @@ public:
 	void SaveTo(ostream &file, int compressionLevel = 1);
 	bool LoadFrom(istream& file);
 	void LoadFromMap(unordered_map<string, SerializeMapValue>& map);
+
+	//Converts the output of SaveTo (with a compression level of 0) to its compressed form (used to compress save states outside of the emulation thread)
+	static void CompressTo(const string& uncompressedData, ostream& file, int compressionLevel = 1);
+
+private:
+	static void WriteCompressed(ostream& file, const uint8_t* data, uint32_t size, int compressionLevel);
 };
 
 template<> inline void Serializer::Stream(string& value, const char* name, int index)
@@ -21,6 +21,7 @@ using namespace std;
 	#include <netinet/tcp.h>
 	#include <netdb.h>
 	#include <unistd.h>
+	#include <sys/uio.h>
 
 	#define INVALID_SOCKET (uintptr_t)-1
 	#define SOCKET_ERROR -1
@@ -244,6 +245,69 @@ int Socket::Send(char *buf, int len, int flags)
 	return returnVal;
 }
 
+int Socket::TrySend(char *buf, int len)
+{
+	//Sends as much data as possible without blocking, returns the number of bytes sent
+	#ifdef MSG_NOSIGNAL
+		int returnVal = send(_socket, buf, len, MSG_NOSIGNAL);
+	#else
+		int returnVal = send(_socket, buf, len, 0);
+	#endif
+
+	if(returnVal == SOCKET_ERROR) {
+		int nError = WSAGetLastError();
+		if(nError && !WouldBlock(nError)) {
+			std::cout << "send failed: nError " << std::to_string(nError) << std::endl;
+			SetConnectionErrorFlag();
+		}
+		return 0;
+	}
+	return returnVal;
+}
+
+int Socket::TrySend(const SocketBuffer* buffers, int count)
+{
+	//Sends as much data as possible from several buffers with a single call (gather write), without blocking
+	constexpr int MaxBufferCount = 64;
+	count = std::min(count, MaxBufferCount);
+
+	#ifdef _WIN32
+		WSABUF wsaBuffers[MaxBufferCount];
+		for(int i = 0; i < count; i++) {
+			wsaBuffers[i].buf = (CHAR*)buffers[i].Data;
+			wsaBuffers[i].len = (ULONG)buffers[i].Length;
+		}
+
+		DWORD bytesSent = 0;
+		int returnVal = WSASend(_socket, wsaBuffers, (DWORD)count, &bytesSent, 0, nullptr, nullptr) == 0 ? (int)bytesSent : SOCKET_ERROR;
+	#else
+		iovec ioBuffers[MaxBufferCount];
+		for(int i = 0; i < count; i++) {
+			ioBuffers[i].iov_base = (void*)buffers[i].Data;
+			ioBuffers[i].iov_len = (size_t)buffers[i].Length;
+		}
+
+		msghdr msg = {};
+		msg.msg_iov = ioBuffers;
+		msg.msg_iovlen = count;
+		#ifdef MSG_NOSIGNAL
+			int returnVal = (int)sendmsg(_socket, &msg, MSG_NOSIGNAL);
+		#else
+			int returnVal = (int)sendmsg(_socket, &msg, 0);
+		#endif
+	#endif
+
+	if(returnVal == SOCKET_ERROR) {
+		int nError = WSAGetLastError();
+		if(nError && !WouldBlock(nError)) {
+			std::cout << "send failed: nError " << std::to_string(nError) << std::endl;
+			SetConnectionErrorFlag();
+		}
+		return 0;
+	}
+	return returnVal;
+}
+
 int Socket::Recv(char *buf, int len, int flags)
 {
 	int returnVal = recv(_socket, buf, len, flags);
@@ -2,6 +2,12 @@
 
 #include "pch.h"
 
+struct SocketBuffer
+{
+	const char* Data;
+	int Length;
+};
+
 class Socket
 {
 private:
@@ -23,6 +29,7 @@ public:
 
 	void Close();
 	bool ConnectionError();
+	uintptr_t GetHandle() { return _socket; }
 
 	void Bind(uint16_t port);
 	bool Connect(const char* hostname, uint16_t port);
@@ -30,6 +37,8 @@ public:
 	unique_ptr<Socket> Accept();
 
 	int Send(char *buf, int len, int flags);
+	int TrySend(char *buf, int len);
+	int TrySend(const SocketBuffer* buffers, int count);
 	void BufferedSend(char *buf, int len);
 	void SendBuffer();
 	int Recv(char *buf, int len, int flags);
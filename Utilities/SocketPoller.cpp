@@ -0,0 +1,173 @@
+#include "pch.h"
+#include <cstring>
+#include "Utilities/SocketPoller.h"
+#include "Utilities/Socket.h"
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <winsock2.h>
+	#include <Ws2tcpip.h>
+	#include <Windows.h>
+
+	#define poll WSAPoll
+	typedef int socklen_t;
+#else
+	#include <sys/types.h>
+	#include <sys/socket.h>
+	#include <sys/ioctl.h>
+	#include <netinet/in.h>
+	#include <arpa/inet.h>
+	#include <poll.h>
+	#include <unistd.h>
+
+	#define INVALID_SOCKET (uintptr_t)-1
+	#define SOCKET_ERROR -1
+	#define SOCKADDR_IN sockaddr_in
+	#define SOCKADDR sockaddr
+	#define closesocket close
+	#define ioctlsocket ioctl
+	typedef int SOCKET;
+	typedef unsigned long u_long;
+#endif
+
+SocketPoller::SocketPoller()
+{
+	_wakePending = false;
+
+	#ifdef _WIN32
+		WSADATA wsaDat;
+		if(WSAStartup(MAKEWORD(2, 2), &wsaDat) != 0) {
+			return;
+		}
+		_cleanupWSA = true;
+	#endif
+
+	InitWakeSocket();
+}
+
+SocketPoller::~SocketPoller()
+{
+	if(_wakeSocket != INVALID_SOCKET) {
+		closesocket((SOCKET)_wakeSocket);
+	}
+
+	#ifdef _WIN32
+		if(_cleanupWSA) {
+			WSACleanup();
+		}
+	#endif
+}
+
+void SocketPoller::InitWakeSocket()
+{
+	uintptr_t wakeSocket = (uintptr_t)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if(wakeSocket == INVALID_SOCKET) {
+		return;
+	}
+
+	//Bind to a random port on the loopback interface, and connect the socket to itself
+	SOCKADDR_IN addr = {};
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = 0;
+
+	socklen_t addrLength = sizeof(addr);
+	if(
+		::bind((SOCKET)wakeSocket, (SOCKADDR*)&addr, sizeof(addr)) == SOCKET_ERROR ||
+		getsockname((SOCKET)wakeSocket, (SOCKADDR*)&addr, &addrLength) == SOCKET_ERROR ||
+		connect((SOCKET)wakeSocket, (SOCKADDR*)&addr, sizeof(addr)) == SOCKET_ERROR
+	) {
+		std::cout << "Unable to create poller wake socket." << std::endl;
+		closesocket((SOCKET)wakeSocket);
+		return;
+	}
+
+	u_long iMode = 1;
+	ioctlsocket((SOCKET)wakeSocket, FIONBIO, &iMode);
+	_wakeSocket = wakeSocket;
+}
+
+void SocketPoller::ClearWakeSocket()
+{
+	char buffer[64];
+	while(recv((SOCKET)_wakeSocket, buffer, sizeof(buffer), 0) > 0) {
+	}
+
+	//Only clear the flag once the socket is drained - clearing it first would allow a Wake() call to send
+	//a byte that gets drained here while the flag remains set, which would prevent any further wake ups.
+	//A Wake() call made before the flag is cleared doesn't send anything, but Wait() is about to return,
+	//so the caller still processes whatever was queued before that call.
+	_wakePending = false;
+}
+
+void SocketPoller::Clear()
+{
+	_entries.clear();
+}
+
+size_t SocketPoller::AddSocket(Socket* socket, bool waitForWrite)
+{
+	_entries.push_back({ socket->GetHandle(), waitForWrite, false, false });
+	return _entries.size() - 1;
+}
+
+bool SocketPoller::Wait(int timeout)
+{
+	vector<pollfd> fds;
+	fds.reserve(_entries.size() + 1);
+	for(PollEntry& entry : _entries) {
+		pollfd fd = {};
+		fd.fd = (SOCKET)entry.Socket;
+		fd.events = POLLIN | (entry.WaitForWrite ? POLLOUT : 0);
+		fds.push_back(fd);
+
+		entry.Readable = false;
+		entry.Writable = false;
+	}
+
+	if(_wakeSocket != INVALID_SOCKET) {
+		pollfd fd = {};
+		fd.fd = (SOCKET)_wakeSocket;
+		fd.events = POLLIN;
+		fds.push_back(fd);
+	}
+
+	if(fds.empty()) {
+		return false;
+	}
+
+	int result = poll(fds.data(), (unsigned long)fds.size(), timeout);
+	if(result <= 0) {
+		return false;
+	}
+
+	for(size_t i = 0; i < _entries.size(); i++) {
+		//Errors/hang ups are reported as readable, the following recv call will detect them
+		_entries[i].Readable = (fds[i].revents & (POLLIN | POLLERR | POLLHUP | POLLNVAL)) != 0;
+		_entries[i].Writable = (fds[i].revents & POLLOUT) != 0;
+	}
+
+	if(_wakeSocket != INVALID_SOCKET && fds.back().revents) {
+		ClearWakeSocket();
+	}
+	return true;
+}
+
+bool SocketPoller::IsReadable(size_t index)
+{
+	return _entries[index].Readable;
+}
+
+bool SocketPoller::IsWritable(size_t index)
+{
+	return _entries[index].Writable;
+}
+
+void SocketPoller::Wake()
+{
+	//Only one pending byte is needed to interrupt Wait()
+	if(_wakeSocket != INVALID_SOCKET && !_wakePending.exchange(true)) {
+		char value = 0;
+		send((SOCKET)_wakeSocket, &value, 1, 0);
+	}
+}
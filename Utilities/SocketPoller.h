@@ -0,0 +1,47 @@
+#pragma once
+#include "pch.h"
+
+class Socket;
+
+//Waits until one or more sockets can be read from/written to (poll/WSAPoll), or until another thread calls Wake()
+//The list of sockets is rebuilt by the caller before each call to Wait()
+class SocketPoller
+{
+private:
+	struct PollEntry
+	{
+		uintptr_t Socket;
+		bool WaitForWrite;
+		bool Readable;
+		bool Writable;
+	};
+
+	vector<PollEntry> _entries;
+
+	//Loopback UDP socket connected to itself, Wake() sends a byte to it to interrupt Wait()
+	uintptr_t _wakeSocket = (uintptr_t)~0;
+	atomic<bool> _wakePending;
+
+	#ifdef _WIN32
+	bool _cleanupWSA = false;
+	#endif
+
+	void InitWakeSocket();
+	void ClearWakeSocket();
+
+public:
+	SocketPoller();
+	~SocketPoller();
+
+	void Clear();
+	size_t AddSocket(Socket* socket, bool waitForWrite);
+
+	//Returns false when the timeout expires without any socket being ready (a negative timeout waits forever)
+	bool Wait(int timeout);
+
+	bool IsReadable(size_t index);
+	bool IsWritable(size_t index);
+
+	//Can be called from any thread
+	void Wake();
+};
@@ -10,12 +10,13 @@
 #include "Utilities/Patches/IpsPatcher.h"
 #include "Utilities/Patches/UpsPatcher.h"
 #include "Utilities/CRC32.h"
+#include "Utilities/RomMetadataCache.h"
 
 const std::initializer_list<string> VirtualFile::RomExtensions = {
 	".nes", ".fds", ".qd", ".unif", ".unf", ".nsf", ".nsfe", ".studybox",
 	".sfc", ".swc", ".fig", ".smc", ".bs", ".st", ".spc",
 	".gb", ".gbc", ".gbx", ".gbs",
-	".pce", ".sgx", ".cue", ".hes",
+	".pce", ".sgx", ".cue", ".cdz", ".hes",
 	".sms", ".gg", ".sg", ".col",
 	".gba",
 	".ws", ".wsc"
@@ -29,6 +30,7 @@ VirtualFile::VirtualFile(const string& archivePath, const string innerFile)
 {
 	_path = archivePath;
 	_innerFile = innerFile;
+	_useMetadataCache = true;
 }
 
 VirtualFile::VirtualFile(const string& file)
@@ -43,6 +45,7 @@ VirtualFile::VirtualFile(const string& file)
 			} catch(std::exception&) {}
 		}
 	}
+	_useMetadataCache = true;
 }
 
 VirtualFile::VirtualFile(const void* buffer, size_t bufferSize, string fileName)
@@ -108,6 +111,36 @@ void VirtualFile::LoadFile()
 	}
 }
 
+bool VirtualFile::MapFile()
+{
+	if(!_mappedFile && _data.empty() && !IsArchive()) {
+		shared_ptr<MemoryMappedFile> mappedFile(new MemoryMappedFile(_path));
+		if(mappedFile->IsValid()) {
+			_mappedFile = mappedFile;
+		}
+	}
+	return _mappedFile != nullptr;
+}
+
+VirtualFileSpan VirtualFile::GetReadSpan(unique_ptr<MemoryMappedFile>& tempMapping)
+{
+	//Used when the whole file is read once (e.g to copy or hash it): read from a temporary
+	//mapping instead of loading the file into _data, to avoid keeping an extra copy of it in memory
+	if(_data.empty() && !IsArchive()) {
+		if(_mappedFile) {
+			return { _mappedFile->GetData(), _mappedFile->GetSize() };
+		}
+
+		tempMapping.reset(new MemoryMappedFile(_path));
+		if(tempMapping->IsValid()) {
+			return { tempMapping->GetData(), tempMapping->GetSize() };
+		}
+	}
+
+	LoadFile();
+	return { _data.data(), _data.size() };
+}
+
 bool VirtualFile::IsValid()
 {
 	if(_data.size() > 0) {
@@ -115,16 +148,13 @@ bool VirtualFile::IsValid()
 	}
 
 	if(!_innerFile.empty()) {
-		unique_ptr<ArchiveReader> reader = ArchiveReader::GetReader(_path);
-		if(reader) {
-			vector<string> filelist = reader->GetFileList();
-			if(_innerFileIndex >= 0) {
-				if((int32_t)filelist.size() > _innerFileIndex) {
-					return true;
-				}
-			} else {
-				return std::find(filelist.begin(), filelist.end(), _innerFile) != filelist.end();
+		vector<string> filelist = ArchiveReader::GetCachedFileList(_path);
+		if(_innerFileIndex >= 0) {
+			if((int32_t)filelist.size() > _innerFileIndex) {
+				return true;
 			}
+		} else {
+			return std::find(filelist.begin(), filelist.end(), _innerFile) != filelist.end();
 		}
 	} else {
 		ifstream input(_path, std::ios::in | std::ios::binary);
@@ -162,20 +192,42 @@ string VirtualFile::GetFileExtension()
 
 string VirtualFile::GetSha1Hash()
 {
-	LoadFile();
-	return SHA1::GetHash(_data);
+	string sha1;
+	if(_useMetadataCache && RomMetadataCache::GetSha1(*this, _path, sha1)) {
+		return sha1;
+	}
+
+	unique_ptr<MemoryMappedFile> tempMapping;
+	VirtualFileSpan span = GetReadSpan(tempMapping);
+	sha1 = SHA1::GetHash((uint8_t*)span.Data, span.Size);
+	if(_useMetadataCache && span.Size > 0) {
+		RomMetadataCache::SetSha1(*this, _path, sha1);
+	}
+	return sha1;
 }
 
 uint32_t VirtualFile::GetCrc32()
 {
-	LoadFile();
-	return CRC32::GetCRC(_data);
+	uint32_t crc;
+	if(_useMetadataCache && RomMetadataCache::GetCrc32(*this, _path, crc)) {
+		return crc;
+	}
+
+	unique_ptr<MemoryMappedFile> tempMapping;
+	VirtualFileSpan span = GetReadSpan(tempMapping);
+	crc = CRC32::GetCRC((uint8_t*)span.Data, span.Size);
+	if(_useMetadataCache && span.Size > 0) {
+		RomMetadataCache::SetCrc32(*this, _path, crc);
+	}
+	return crc;
 }
 
 size_t VirtualFile::GetSize()
 {
 	if(_data.size() > 0) {
 		return _data.size();
+	} else if(_mappedFile) {
+		return _mappedFile->GetSize();
 	} else {
 		if(_fileSize >= 0) {
 			return _fileSize;
@@ -231,7 +283,11 @@ void VirtualFile::InitChunks()
 {
 	if(!_useChunks) {
 		_useChunks = true;
-		_chunks.resize(GetSize() / VirtualFile::ChunkSize + 1);
+
+		//Chunks are only needed when the file can't be memory-mapped
+		if(!MapFile()) {
+			_chunks.resize(GetSize() / VirtualFile::ChunkSize + 1);
+		}
 	}
 }
 
@@ -241,12 +297,22 @@ vector<uint8_t>& VirtualFile::GetData()
 	return _data;
 }
 
-bool VirtualFile::ReadFile(vector<uint8_t>& out)
+VirtualFileSpan VirtualFile::GetSpan()
 {
+	if(_data.empty() && MapFile()) {
+		return { _mappedFile->GetData(), _mappedFile->GetSize() };
+	}
+
 	LoadFile();
-	if(_data.size() > 0) {
-		out.resize(_data.size(), 0);
-		std::copy(_data.begin(), _data.end(), out.begin());
+	return { _data.data(), _data.size() };
+}
+
+bool VirtualFile::ReadFile(vector<uint8_t>& out)
+{
+	unique_ptr<MemoryMappedFile> tempMapping;
+	VirtualFileSpan span = GetReadSpan(tempMapping);
+	if(span.Size > 0) {
+		out.assign(span.begin(), span.end());
 		return true;
 	}
 	return false;
@@ -254,9 +320,10 @@ bool VirtualFile::ReadFile(vector<uint8_t>& out)
 
 bool VirtualFile::ReadFile(std::stringstream& out)
 {
-	LoadFile();
-	if(_data.size() > 0) {
-		out.write((char*)_data.data(), _data.size());
+	unique_ptr<MemoryMappedFile> tempMapping;
+	VirtualFileSpan span = GetReadSpan(tempMapping);
+	if(span.Size > 0) {
+		out.write((char*)span.Data, span.Size);
 		return true;
 	}
 	return false;
@@ -264,9 +331,10 @@ bool VirtualFile::ReadFile(std::stringstream& out)
 
 bool VirtualFile::ReadFile(uint8_t* out, uint32_t expectedSize)
 {
-	LoadFile();
-	if(_data.size() == expectedSize) {
-		memcpy(out, _data.data(), _data.size());
+	unique_ptr<MemoryMappedFile> tempMapping;
+	VirtualFileSpan span = GetReadSpan(tempMapping);
+	if(span.Size == expectedSize) {
+		memcpy(out, span.Data, span.Size);
 		return true;
 	}
 	return false;
@@ -274,7 +342,16 @@ bool VirtualFile::ReadFile(uint8_t* out, uint32_t expectedSize)
 
 uint8_t VirtualFile::ReadByte(uint32_t offset)
 {
+	if(!_data.empty()) {
+		//File was already loaded (and possibly patched)
+		return offset < _data.size() ? _data[offset] : 0;
+	}
+
 	InitChunks();
+	if(_mappedFile) {
+		return offset < _mappedFile->GetSize() ? _mappedFile->GetData()[offset] : 0;
+	}
+
 	if(offset < 0 || offset > GetSize()) {
 		//Out of bounds
 		return 0;
@@ -313,6 +390,12 @@ bool VirtualFile::ApplyPatch(VirtualFile& patch)
 			}
 			if(result) {
 				_data = patchedData;
+				_useMetadataCache = false;
+
+				//The mapping and chunks contain the unpatched file, stop using them
+				_mappedFile.reset();
+				_chunks.clear();
+				_useChunks = false;
 			}
 		}
 	}
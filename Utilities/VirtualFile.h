@@ -1,6 +1,17 @@
 #pragma once
 #include "pch.h"
 #include <sstream>
+#include "Utilities/MemoryMappedFile.h"
+
+//Read-only view of a file's content
+struct VirtualFileSpan
+{
+	const uint8_t* Data = nullptr;
+	size_t Size = 0;
+
+	const uint8_t* begin() const { return Data; }
+	const uint8_t* end() const { return Data + Size; }
+};
 
 class VirtualFile
 {
@@ -13,12 +24,21 @@ private:
 	vector<uint8_t> _data;
 	int64_t _fileSize = -1;
 
+	//Set when the content comes straight from a file on the disk (not a buffer/stream, and not patched), which
+	//allows its hashes to be stored in RomMetadataCache
+	bool _useMetadataCache = false;
+
 	vector<vector<uint8_t>> _chunks;
 	bool _useChunks = false;
 
+	//Shared between copies of the same VirtualFile
+	shared_ptr<MemoryMappedFile> _mappedFile;
+
 	void FromStream(std::istream &input, vector<uint8_t> &output);
 
 	void LoadFile();
+	bool MapFile();
+	VirtualFileSpan GetReadSpan(unique_ptr<MemoryMappedFile>& tempMapping);
 
 public:
 	static const std::initializer_list<string> RomExtensions;
@@ -46,6 +66,10 @@ public:
 
 	vector<uint8_t>& GetData();
 
+	//Returns the file's content without copying it (uncompressed files are memory-mapped, rather than loaded in memory)
+	//The span remains valid as long as this VirtualFile (or a copy of it) exists, and isn't modified (e.g by ApplyPatch)
+	VirtualFileSpan GetSpan();
+
 	bool ReadFile(vector<uint8_t> &out);
 	bool ReadFile(std::stringstream &out);
 	bool ReadFile(uint8_t* out, uint32_t expectedSize);
@@ -57,12 +81,24 @@ public:
 	template<typename T>
 	bool ReadChunk(T& container, int start, int length)
 	{
-		InitChunks();
 		if(start < 0 || start + length > GetSize()) {
 			//Out of bounds
 			return false;
 		}
 
+		if(!_data.empty()) {
+			//File was already loaded (and possibly patched)
+			container.insert(container.end(), _data.data() + start, _data.data() + start + length);
+			return true;
+		}
+
+		InitChunks();
+		if(_mappedFile) {
+			const uint8_t* data = _mappedFile->GetData() + start;
+			container.insert(container.end(), data, data + length);
+			return true;
+		}
+
 		for(int i = start, end = start + length; i < end; i++) {
 			container.push_back(ReadByte(i));
 		}